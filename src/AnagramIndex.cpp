@@ -0,0 +1,285 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : AnagramIndex.cpp
+/// @Brief : Implements the letter multiset index used by the bonus word modes.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "AnagramIndex.h"
+#include <algorithm>
+#include <array>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UE_ANAGRAM_SSE2 1
+#endif
+
+namespace Framework
+{
+    namespace
+    {
+        using LetterCounts = std::array<uint8_t, 26>;
+
+        bool IsLetter(unsigned char c)
+        {
+            return c >= 'a' && c <= 'z';
+        }
+
+        // Lowercase letters of the text in sorted order, other characters dropped
+        std::string SortedLetters(const std::string& text)
+        {
+            std::string letters;
+            letters.reserve(text.size());
+            for (unsigned char c : text)
+            {
+                if (c >= 'A' && c <= 'Z')
+                    c = static_cast<unsigned char>(c - 'A' + 'a');
+                if (IsLetter(c))
+                    letters.push_back(static_cast<char>(c));
+            }
+            std::sort(letters.begin(), letters.end());
+            return letters;
+        }
+
+        LetterCounts CountLetters(const std::string& sortedLetters)
+        {
+            LetterCounts counts{};
+            for (unsigned char c : sortedLetters)
+            {
+                if (counts[c - 'a'] < UINT8_MAX)
+                    ++counts[c - 'a'];
+            }
+            return counts;
+        }
+    }
+
+    uint32_t AnagramIndex::LetterMask(const std::string& text)
+    {
+        uint32_t mask = 0;
+        for (unsigned char c : text)
+        {
+            if (c >= 'A' && c <= 'Z')
+                c = static_cast<unsigned char>(c - 'A' + 'a');
+            if (IsLetter(c))
+                mask |= 1u << (c - 'a');
+        }
+        return mask;
+    }
+
+    void AnagramIndex::Clear()
+    {
+        masks.clear();
+        lengths.clear();
+        signatureOffsets.clear();
+        groupStarts.clear();
+        signaturePool.clear();
+        wordOffsets.clear();
+        wordPool.clear();
+    }
+
+    size_t AnagramIndex::MemoryUsage() const
+    {
+        return (masks.capacity() + lengths.capacity() + signatureOffsets.capacity() + groupStarts.capacity() + wordOffsets.capacity()) * sizeof(uint32_t)
+            + signaturePool.capacity() + wordPool.capacity();
+    }
+
+    void AnagramIndex::Build(const FrontCodedWordList& words)
+    {
+        Clear();
+
+        // Pair every plain a-z word with its signature, then group equal signatures
+        struct Entry
+        {
+            std::string signature;
+            std::string word;
+        };
+        std::vector<Entry> entries;
+        entries.reserve(words.size());
+        for (const std::string& word : words)
+        {
+            if (word.empty() || !std::all_of(word.begin(), word.end(), [](unsigned char c) { return IsLetter(c); }))
+            {
+                continue;
+            }
+            std::string signature = word;
+            std::sort(signature.begin(), signature.end());
+            entries.push_back({ std::move(signature), word });
+        }
+
+        // The list is sorted, so a stable sort on the signature keeps each group alphabetical
+        std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b)
+            {
+                return a.signature < b.signature;
+            });
+
+        for (const Entry& entry : entries)
+        {
+            const std::string& signature = entry.signature;
+            if (signatureOffsets.empty() || signature.size() != lengths.back()
+                || signaturePool.compare(signatureOffsets.back(), signature.size(), signature) != 0)
+            {
+                signatureOffsets.push_back(static_cast<uint32_t>(signaturePool.size()));
+                signaturePool += signature;
+                masks.push_back(LetterMask(signature));
+                lengths.push_back(static_cast<uint32_t>(signature.size()));
+                groupStarts.push_back(static_cast<uint32_t>(wordOffsets.size()));
+            }
+            wordOffsets.push_back(static_cast<uint32_t>(wordPool.size()));
+            wordPool += entry.word;
+        }
+        groupStarts.push_back(static_cast<uint32_t>(wordOffsets.size()));
+        wordOffsets.push_back(static_cast<uint32_t>(wordPool.size()));
+
+        // Padding entries can never pass the scan: every letter set and longer than any query
+        while (masks.size() % 4 != 0)
+        {
+            masks.push_back(~0u);
+            lengths.push_back(UINT32_MAX >> 1);
+        }
+
+        masks.shrink_to_fit();
+        lengths.shrink_to_fit();
+        signatureOffsets.shrink_to_fit();
+        groupStarts.shrink_to_fit();
+        signaturePool.shrink_to_fit();
+        wordOffsets.shrink_to_fit();
+        wordPool.shrink_to_fit();
+    }
+
+    std::string AnagramIndex::GetSignature(uint32_t signature) const
+    {
+        return signaturePool.substr(signatureOffsets[signature], lengths[signature]);
+    }
+
+    void AnagramIndex::AppendGroup(uint32_t signature, std::vector<std::string>& out) const
+    {
+        for (uint32_t word = groupStarts[signature]; word < groupStarts[signature + 1]; ++word)
+        {
+            out.emplace_back(wordPool, wordOffsets[word], wordOffsets[word + 1] - wordOffsets[word]);
+        }
+    }
+
+    void AnagramIndex::CollectSignatures(const std::string& letters, size_t minLength, std::vector<uint32_t>& result) const
+    {
+        const std::string query = SortedLetters(letters);
+        if (query.empty() || masks.empty())
+        {
+            return;
+        }
+
+        const LetterCounts available = CountLetters(query);
+        const uint32_t outside = ~LetterMask(query) & ((1u << 26) - 1);    // Letters the query does not have
+        const uint32_t maxLength = static_cast<uint32_t>(query.size());
+        const uint32_t minLen = static_cast<uint32_t>(std::max<size_t>(minLength, 1));
+
+        auto verify = [&](uint32_t signature)
+        {
+            // Mask and length passed, check that no letter is used more often than available
+            LetterCounts needed{};
+            const char* letter = signaturePool.data() + signatureOffsets[signature];
+            for (uint32_t i = 0; i < lengths[signature]; ++i)
+            {
+                const int index = letter[i] - 'a';
+                if (++needed[index] > available[index])
+                    return;
+            }
+            result.push_back(signature);
+        };
+
+        const size_t count = signatureOffsets.size();
+#if defined(UE_ANAGRAM_SSE2)
+        // Four signatures per step: (mask & outside) == 0 and minLen <= length <= maxLength
+        const __m128i outsideMask = _mm_set1_epi32(static_cast<int>(outside));
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i below = _mm_set1_epi32(static_cast<int>(minLen) - 1);
+        const __m128i above = _mm_set1_epi32(static_cast<int>(maxLength) + 1);
+        for (size_t base = 0; base < count; base += 4)
+        {
+            const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks.data() + base));
+            const __m128i length = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lengths.data() + base));
+
+            __m128i pass = _mm_cmpeq_epi32(_mm_and_si128(mask, outsideMask), zero);
+            pass = _mm_and_si128(pass, _mm_cmpgt_epi32(length, below));
+            pass = _mm_and_si128(pass, _mm_cmplt_epi32(length, above));
+
+            const int bits = _mm_movemask_ps(_mm_castsi128_ps(pass));
+            if (bits == 0)
+                continue;   // The common case, none of the four fit
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                if (bits & (1 << lane))
+                    verify(static_cast<uint32_t>(base + lane));
+            }
+        }
+#else
+        for (size_t signature = 0; signature < count; ++signature)
+        {
+            if ((masks[signature] & outside) == 0 && lengths[signature] >= minLen && lengths[signature] <= maxLength)
+                verify(static_cast<uint32_t>(signature));
+        }
+#endif
+    }
+
+    std::vector<std::string> AnagramIndex::FindAnagrams(const std::string& letters) const
+    {
+        std::vector<std::string> words;
+        const std::string query = SortedLetters(letters);
+        if (query.empty() || signatureOffsets.empty())
+        {
+            return words;
+        }
+
+        // Signatures are sorted, binary search for the exact one
+        size_t low = 0, high = signatureOffsets.size();
+        while (low < high)
+        {
+            const size_t mid = (low + high) / 2;
+            if (signaturePool.compare(signatureOffsets[mid], lengths[mid], query) < 0)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+
+        if (low < signatureOffsets.size() && GetSignature(static_cast<uint32_t>(low)) == query)
+        {
+            AppendGroup(static_cast<uint32_t>(low), words);
+            std::sort(words.begin(), words.end());
+        }
+        return words;
+    }
+
+    std::vector<std::string> AnagramIndex::FindWordsFromLetters(const std::string& letters, size_t minLength) const
+    {
+        std::vector<uint32_t> signatures;
+        CollectSignatures(letters, minLength, signatures);
+
+        std::vector<std::string> words;
+        for (uint32_t signature : signatures)
+        {
+            AppendGroup(signature, words);
+        }
+
+        std::sort(words.begin(), words.end(), [](const std::string& a, const std::string& b)
+            {
+                return a.size() != b.size() ? a.size() > b.size() : a < b;
+            });
+        return words;
+    }
+
+    size_t AnagramIndex::CountWordsFromLetters(const std::string& letters, size_t minLength) const
+    {
+        std::vector<uint32_t> signatures;
+        CollectSignatures(letters, minLength, signatures);
+
+        size_t count = 0;
+        for (uint32_t signature : signatures)
+        {
+            count += groupStarts[signature + 1] - groupStarts[signature];
+        }
+        return count;
+    }
+}
@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : AnagramIndex.h
+/// @Brief : Declares AnagramIndex, a letter multiset index over the dictionary
+///          used by the bonus word modes. Every word is filed under its
+///          signature (its letters sorted) together with a 26-bit mask of the
+///          letters it uses. "Which words can be made from these letters"
+///          first rejects signatures with an SSE2 scan over the masks and
+///          lengths, four at a time, and only counts letters for the few
+///          signatures that pass.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _ANAGRAM_INDEX_H_
+#define _ANAGRAM_INDEX_H_
+#include "FrontCodedWordList.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @class AnagramIndex
+     * @brief Finds anagrams and sub-words of a letter set. Only words made of the letters
+     *        a-z are indexed; query letters are case insensitive and other characters ignored.
+     */
+    class AnagramIndex
+    {
+    public:
+        /**
+         * @brief Indexes every word of the list.
+         */
+        void Build(const FrontCodedWordList& words);
+
+        /**
+         * @brief Words using exactly the given letters (each as many times as given).
+         * @return Matching words in alphabetical order.
+         */
+        std::vector<std::string> FindAnagrams(const std::string& letters) const;
+
+        /**
+         * @brief Words that can be formed from the given letters, each letter used at most
+         *        as many times as it appears.
+         * @param minLength Shortest word to return.
+         * @return Matching words, longest first and alphabetical within a length.
+         */
+        std::vector<std::string> FindWordsFromLetters(const std::string& letters, size_t minLength = 3) const;
+
+        /**
+         * @brief Number of words that can be formed, without building the strings.
+         */
+        size_t CountWordsFromLetters(const std::string& letters, size_t minLength = 3) const;
+
+        /**
+         * @brief 26-bit mask with bit (c - 'a') set for every letter in the text.
+         */
+        static uint32_t LetterMask(const std::string& text);
+
+        size_t GetWordCount() const { return wordOffsets.empty() ? 0 : wordOffsets.size() - 1; }
+        size_t GetSignatureCount() const { return signatureOffsets.size(); }
+        void Clear();
+
+        /**
+         * @brief Heap memory used by the index, in bytes.
+         */
+        size_t MemoryUsage() const;
+
+    private:
+        /**
+         * @brief Indices of the signatures whose letters fit in the query.
+         */
+        void CollectSignatures(const std::string& letters, size_t minLength, std::vector<uint32_t>& result) const;
+
+        void AppendGroup(uint32_t signature, std::vector<std::string>& out) const;
+        std::string GetSignature(uint32_t signature) const;
+
+        // One entry per distinct signature, stored as separate arrays so the scan streams through masks
+        std::vector<uint32_t> masks;                // Letters used, padded to a multiple of 4 with ~0
+        std::vector<uint32_t> lengths;              // Letter count, padded like masks
+        std::vector<uint32_t> signatureOffsets;     // Start of the sorted letters in signaturePool
+        std::vector<uint32_t> groupStarts;          // First word of each signature, plus an end marker
+        std::string signaturePool;
+
+        // Words, grouped by signature
+        std::vector<uint32_t> wordOffsets;          // Start of each word in wordPool, plus an end marker
+        std::string wordPool;
+    };
+}
+#endif // !_ANAGRAM_INDEX_H_
@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : AnimationClip.cpp
+/// @Brief : Implements compiling sprite sheet animations into frame tables
+///          and sampling them.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "AnimationClip.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+namespace Framework
+{
+    AnimationClipHandle AnimationClipLibrary::Add(const std::string& name, int rows, int cols, float framesPerSecond,
+        int frameCount, const std::vector<float>& frameDurations)
+    {
+        if (rows <= 0 || cols <= 0 || frameCount < 0 || frameCount > rows * cols)
+        {
+            std::cerr << "Error: Invalid sprite sheet layout for animation " << name << std::endl;
+            return InvalidAnimationClip;
+        }
+        if (frameCount == 0)
+        {
+            frameCount = rows * cols;
+        }
+        if (!frameDurations.empty() && frameDurations.size() != static_cast<size_t>(frameCount))
+        {
+            std::cerr << "Error: Animation " << name << " has " << frameDurations.size()
+                << " frame durations for " << frameCount << " frames." << std::endl;
+            return InvalidAnimationClip;
+        }
+
+        Clip clip;
+        clip.frameCount = static_cast<uint32_t>(frameCount);
+        clip.rows = rows;
+        clip.cols = cols;
+        clip.framesPerSecond = framesPerSecond;
+        clip.frameDuration = frameDurations.empty() && framesPerSecond > 0.0f ? 1.0f / framesPerSecond : 0.0f;
+
+        // Reloading a clip keeps its handle, and its frames too when the count did not change
+        auto existing = handles.find(name);
+        const bool reuseFrames = existing != handles.end() && clips[existing->second].frameCount == clip.frameCount;
+        if (existing != handles.end() && !reuseFrames)
+        {
+            ReleaseFrames(clips[existing->second]);
+        }
+        clip.firstFrame = reuseFrames ? clips[existing->second].firstFrame : static_cast<uint32_t>(frameUVs.size());
+        if (!reuseFrames)
+        {
+            frameUVs.resize(frameUVs.size() + clip.frameCount);
+            frameEndTimes.resize(frameEndTimes.size() + clip.frameCount);
+        }
+
+        const glm::vec2 scale(1.0f / static_cast<float>(cols), 1.0f / static_cast<float>(rows));
+        float endTime = 0.0f;
+        for (uint32_t i = 0; i < clip.frameCount; ++i)
+        {
+            FrameUV& uv = frameUVs[clip.firstFrame + i];
+            uv.offset = glm::vec2(static_cast<float>(i % cols), static_cast<float>(i / cols)) * scale;
+            uv.scale = scale;
+
+            endTime += frameDurations.empty() ? clip.frameDuration : std::max(frameDurations[i], 0.0f);
+            frameEndTimes[clip.firstFrame + i] = endTime;
+        }
+        clip.duration = endTime;
+
+        if (existing != handles.end())
+        {
+            clips[existing->second] = clip;
+            return existing->second;
+        }
+
+        const AnimationClipHandle handle = static_cast<AnimationClipHandle>(clips.size());
+        clips.push_back(clip);
+        names.push_back(name);
+        handles.emplace(name, handle);
+        return handle;
+    }
+
+    AnimationClipHandle AnimationClipLibrary::AddLayout(int rows, int cols, float framesPerSecond)
+    {
+        // '#' never starts a clip name in AnimationAsset.json, so layout keys cannot collide with it
+        const std::string key = "#" + std::to_string(rows) + "x" + std::to_string(cols) + "@" + std::to_string(framesPerSecond);
+        const AnimationClipHandle existing = Find(key);
+        if (existing != InvalidAnimationClip)
+        {
+            return existing;
+        }
+
+        const AnimationClipHandle handle = Add(key, rows, cols, framesPerSecond);
+        if (handle != InvalidAnimationClip)
+        {
+            names[handle].clear();
+        }
+        return handle;
+    }
+
+    void AnimationClipLibrary::ReleaseFrames(const Clip& clip)
+    {
+        const auto first = static_cast<std::ptrdiff_t>(clip.firstFrame);
+        const auto last = first + static_cast<std::ptrdiff_t>(clip.frameCount);
+        frameUVs.erase(frameUVs.begin() + first, frameUVs.begin() + last);
+        frameEndTimes.erase(frameEndTimes.begin() + first, frameEndTimes.begin() + last);
+
+        for (Clip& other : clips)
+        {
+            if (other.firstFrame > clip.firstFrame)
+            {
+                other.firstFrame -= clip.frameCount;
+            }
+        }
+    }
+
+    AnimationClipHandle AnimationClipLibrary::Find(const std::string& name) const
+    {
+        auto it = handles.find(name);
+        return it == handles.end() ? InvalidAnimationClip : it->second;
+    }
+
+    uint32_t AnimationClipLibrary::FrameAt(AnimationClipHandle handle, float time, bool loop) const
+    {
+        const Clip& clip = clips[handle];
+        if (clip.duration <= 0.0f || time <= 0.0f)
+        {
+            return clip.firstFrame;
+        }
+
+        if (loop)
+        {
+            time = std::fmod(time, clip.duration);
+        }
+        else if (time >= clip.duration)
+        {
+            return clip.firstFrame + clip.frameCount - 1;
+        }
+
+        // Evenly timed frames, the common case, need no search
+        if (clip.frameDuration > 0.0f)
+        {
+            const uint32_t frame = static_cast<uint32_t>(time / clip.frameDuration);
+            return clip.firstFrame + std::min(frame, clip.frameCount - 1);
+        }
+
+        const float* begin = frameEndTimes.data() + clip.firstFrame;
+        const float* end = begin + clip.frameCount;
+        const uint32_t frame = static_cast<uint32_t>(std::upper_bound(begin, end, time) - begin);
+        return clip.firstFrame + std::min(frame, clip.frameCount - 1);
+    }
+
+    /*******************/
+    //   Playback      //
+    /*******************/
+
+    void AnimationClipLibrary::Play(Entity entity, AnimationClipHandle handle)
+    {
+        if (!IsValid(handle))
+        {
+            playback.erase(entity);
+            return;
+        }
+        playback[entity] = Playback{ handle, 0.0f };
+    }
+
+    void AnimationClipLibrary::Advance(float deltaTime)
+    {
+        for (auto& [entity, state] : playback)
+        {
+            state.time += deltaTime;
+
+            // Keep the time within one pass so float precision holds up in long sessions
+            const float duration = clips[state.clip].duration;
+            if (duration > 0.0f && state.time >= duration)
+            {
+                state.time = std::fmod(state.time, duration);
+            }
+        }
+    }
+
+    AnimationClipHandle AnimationClipLibrary::GetPlaying(Entity entity) const
+    {
+        auto it = playback.find(entity);
+        return it == playback.end() ? InvalidAnimationClip : it->second.clip;
+    }
+
+    const FrameUV* AnimationClipLibrary::FindFrame(Entity entity) const
+    {
+        auto it = playback.find(entity);
+        return it == playback.end() ? nullptr : &Sample(it->second.clip, it->second.time);
+    }
+}
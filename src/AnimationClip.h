@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : AnimationClip.h
+/// @Brief : Declares AnimationClipLibrary, which compiles the sprite sheet
+///          animations of AnimationAsset.json into flat tables when they
+///          are loaded: one UV rectangle and one end time per frame, all
+///          clips stored back to back. A clip is referenced by a handle, and
+///          sampling a frame is an index computation plus a single read
+///          instead of recomputing the sheet divisions every frame.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _ANIMATION_CLIP_H_
+#define _ANIMATION_CLIP_H_
+#include "pch.h"
+#include "Coordinator.h"
+#include <glm.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework
+{
+    using AnimationClipHandle = uint32_t;
+    constexpr AnimationClipHandle InvalidAnimationClip = UINT32_MAX;
+
+    /**
+     * @brief Texture coordinates of one frame: the rectangle starting at offset with size scale.
+     *        Row 0 of the sheet is the first row of the image (v = 0).
+     */
+    struct FrameUV
+    {
+        glm::vec2 offset{ 0.0f, 0.0f };
+        glm::vec2 scale{ 1.0f, 1.0f };
+    };
+
+    /**
+     * @class AnimationClipLibrary
+     * @brief Every loaded animation clip, addressed by handle. Handles stay valid when a clip
+     *        is loaded again under the same name.
+     */
+    class AnimationClipLibrary
+    {
+    public:
+        struct Clip
+        {
+            uint32_t firstFrame = 0;        // Index of the clip's first frame in the flat tables
+            uint32_t frameCount = 0;
+            float frameDuration = 0.0f;     // Seconds per frame, 0 when frames have their own durations
+            float duration = 0.0f;          // Seconds for one pass through the clip
+            int rows = 1;
+            int cols = 1;
+            float framesPerSecond = 0.0f;
+        };
+
+        /**
+         * @brief Compiles a clip laid out row by row on a sheet of rows x cols frames.
+         * @param frameCount Frames used, 0 for the whole sheet.
+         * @param frameDurations Seconds of each frame, empty to play every frame for 1 / framesPerSecond.
+         * @return The clip's handle, InvalidAnimationClip if the layout is invalid.
+         */
+        AnimationClipHandle Add(const std::string& name, int rows, int cols, float framesPerSecond,
+            int frameCount = 0, const std::vector<float>& frameDurations = {});
+
+        /**
+         * @brief Unnamed clip for a sheet layout written inline in an AnimationComponent. Entities
+         *        with the same layout share it.
+         * @return The clip's handle, InvalidAnimationClip if the layout is invalid.
+         */
+        AnimationClipHandle AddLayout(int rows, int cols, float framesPerSecond);
+
+        /**
+         * @brief Handle of a clip by name, InvalidAnimationClip if it was never loaded.
+         */
+        AnimationClipHandle Find(const std::string& name) const;
+
+        /**
+         * @brief Name the clip was loaded under, empty for layout clips.
+         */
+        const std::string& GetName(AnimationClipHandle handle) const { return names[handle]; }
+
+        bool IsValid(AnimationClipHandle handle) const { return handle < clips.size(); }
+        const Clip& GetClip(AnimationClipHandle handle) const { return clips[handle]; }
+
+        /**
+         * @brief Index into the flat frame tables of the frame shown at a time since the clip started.
+         * @param loop Wraps around at the end of the clip, otherwise holds the last frame.
+         */
+        uint32_t FrameAt(AnimationClipHandle handle, float time, bool loop = true) const;
+
+        /**
+         * @brief Texture coordinates of the frame shown at a time since the clip started.
+         */
+        const FrameUV& Sample(AnimationClipHandle handle, float time, bool loop = true) const
+        {
+            return frameUVs[FrameAt(handle, time, loop)];
+        }
+
+        const FrameUV& GetFrameUV(uint32_t frame) const { return frameUVs[frame]; }
+
+        size_t size() const { return clips.size(); }
+        size_t GetFrameCount() const { return frameUVs.size(); }
+
+        /*******************/
+        //   Playback      //
+        /*******************/
+
+        /**
+         * @brief Plays a clip on an entity from its first frame, replacing the clip it played.
+         */
+        void Play(Entity entity, AnimationClipHandle handle);
+
+        void Stop(Entity entity) { playback.erase(entity); }
+
+        /**
+         * @brief Stops every clip, called when the scene is cleared.
+         */
+        void ClearPlayback() { playback.clear(); }
+
+        /**
+         * @brief Advances every playing clip by a frame of scaled game time.
+         */
+        void Advance(float deltaTime);
+
+        /**
+         * @brief Clip an entity plays, InvalidAnimationClip if none.
+         */
+        AnimationClipHandle GetPlaying(Entity entity) const;
+
+        /**
+         * @brief Texture coordinates of the frame an entity shows, nullptr if it plays no clip.
+         */
+        const FrameUV* FindFrame(Entity entity) const;
+
+    private:
+        struct Playback
+        {
+            AnimationClipHandle clip = InvalidAnimationClip;
+            float time = 0.0f;              // Seconds since the clip started
+        };
+
+        /**
+         * @brief Removes a clip's frames from the flat tables and moves the clips after them down.
+         */
+        void ReleaseFrames(const Clip& clip);
+
+        std::vector<Clip> clips;
+        std::vector<std::string> names;     // Same indexing as clips
+        std::vector<FrameUV> frameUVs;      // All clips' frames back to back
+        std::vector<float> frameEndTimes;   // Same indexing, seconds from the clip start to the frame's end
+        std::unordered_map<std::string, AnimationClipHandle> handles;
+        std::unordered_map<Entity, Playback> playback;
+    };
+}
+#endif // !_ANIMATION_CLIP_H_
@@ -17,17 +17,32 @@
 #include "AssetManager.h"
 #include "LogicManager.h"
 #include "FontSystem.h"
+#include "Metrics.h"
+#include "EntityPool.h"
+#include "ParticleSystem.h"
+#include "FileWatcher.h"
+#include "RenderQueue.h"
+#include "TextLayoutCache.h"
+#include "TextureImport.h"
+#include "VirtualFileSystem.h"
 #include <iostream>
 #include <filesystem>
 #include <string>
+#include <unordered_set>
 
 namespace Framework
 {
+    // Defined here rather than in VirtualFileSystem.cpp: globals of one file are constructed in
+    // order, and the AssetManager constructor below already reads through the mounts
+    VirtualFileSystem GlobalVirtualFileSystem;
+
     AssetManager GlobalAssetManager;        // Global instance of AssetManager.
     unsigned char* AssetManager::data{};    // Texture data buffer for loading textures.
 
     AssetManager::AssetManager()
     {
+        GlobalVirtualFileSystem.MountDefaults();
+
         // Initialization of Assets
         UE_LoadAudio("Assets/JsonData/AudioAsset.json");
         UE_LoadTexture("Assets/JsonData/TextureAsset.json");
@@ -51,160 +66,137 @@ namespace Framework
         return ref;		// Return a ref to the window
     }
 
-    void AssetManager::UE_LoadDictionary(const std::string& fileName) {
-        std::ifstream file(fileName);
-        if (!file.is_open()) {
-            std::cerr << "Could not open the words file!" << std::endl;
-            return;
-        }
+    std::vector<std::string> AssetManager::ParseWordArray(const std::string& fileName, const std::string& key, bool toLower)
+    {
+        std::vector<std::string> items;
 
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        file.close();
+        std::string jsonString;
+        if (!GlobalVirtualFileSystem.ReadFile(fileName, jsonString))
+        {
+            std::cerr << "Could not open the " << key << " file: " << fileName << std::endl;
+            return items;
+        }
 
-        std::string jsonString = buffer.str();
-        size_t keyPos = jsonString.find("\"words\":");
-        if (keyPos == std::string::npos) {
-            std::cerr << "Key \"words\" not found in JSON!" << std::endl;
-            return;
+        // Find the key in the JSON string
+        size_t keyPos = jsonString.find("\"" + key + "\":");
+        if (keyPos == std::string::npos)
+        {
+            std::cerr << "Key \"" << key << "\" not found in JSON!" << std::endl;
+            return items;
         }
 
+        // Locate the array start and end brackets
         size_t arrayStart = jsonString.find('[', keyPos);
         size_t arrayEnd = jsonString.find(']', arrayStart);
-        if (arrayStart == std::string::npos || arrayEnd == std::string::npos) {
-            std::cerr << "Invalid JSON array format!" << std::endl;
-            return;
+        if (arrayStart == std::string::npos || arrayEnd == std::string::npos)
+        {
+            std::cerr << "Invalid JSON array format for key \"" << key << "\"!" << std::endl;
+            return items;
         }
 
         std::string arrayContent = jsonString.substr(arrayStart + 1, arrayEnd - arrayStart - 1);
         std::stringstream ss(arrayContent);
-        std::string word;
-
-        dictionaryWords.clear();  // Clear previously loaded words
-
-        Framework::Trie& trie = Framework::Lexicon::GetInstance()->GetTrie();
+        std::string item;
 
-        while (std::getline(ss, word, ',')) {
-            word.erase(remove(word.begin(), word.end(), '"'), word.end());      // Remove quotes
-            word = trim(word);                                                  // Trim spaces
-            std::transform(word.begin(), word.end(), word.begin(), ::tolower);  // To lowercase
+        while (std::getline(ss, item, ','))
+        {
+            item.erase(remove(item.begin(), item.end(), '"'), item.end());          // Remove quotes
+            item = trim(item);                                                      // Trim spaces
+            if (toLower)
+            {
+                std::transform(item.begin(), item.end(), item.begin(), ::tolower);  // To lowercase
+            }
 
-            if (!word.empty()) {
-                dictionaryWords.push_back(word);  // Store sanitized word
-                trie.insert(word);
+            if (!item.empty())
+            {
+                items.push_back(item);
             }
         }
+        return items;
     }
 
-    void AssetManager::UE_LoadPrefixes(const std::string& fileName) {
-        std::ifstream file(fileName);
-        if (!file.is_open()) {
-            std::cerr << "Could not open the prefixes file!" << std::endl;
-            return;
-        }
-
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        file.close();
-
-        std::string jsonString = buffer.str();
-        size_t keyPos = jsonString.find("\"prefixes\":");
-        if (keyPos == std::string::npos) {
-            std::cerr << "Key \"prefixes\" not found in JSON!" << std::endl;
-            return;
-        }
+    void AssetManager::UE_LoadDictionary(const std::string& fileName) {
+        dictionaryPath = fileName;
 
-        size_t arrayStart = jsonString.find('[', keyPos);
-        size_t arrayEnd = jsonString.find(']', arrayStart);
-        if (arrayStart == std::string::npos || arrayEnd == std::string::npos) {
-            std::cerr << "Invalid JSON array format!" << std::endl;
-            return;
+        Framework::Trie& trie = Framework::Lexicon::GetInstance()->GetTrie();
+        for (const std::string& word : ParseWordArray(fileName, "words", true)) {
+            trie.insert(word);
         }
+        trie.finalize();    // Build the word list and membership index at load time
+        Framework::Lexicon::GetInstance()->GetAnagramIndex().Build(trie.getAllWords());
+    }
 
-        std::string arrayContent = jsonString.substr(arrayStart + 1, arrayEnd - arrayStart - 1);
-        std::stringstream ss(arrayContent);
-        std::string item;
-
-        prefixList.clear();  // Clear previously loaded prefixes
-
-        while (std::getline(ss, item, ',')) {
-            item.erase(remove(item.begin(), item.end(), '"'), item.end());  // Remove quotes
-            item = trim(item);                                              // Trim spaces
-
-            if (!item.empty()) {
-                prefixList.push_back(item);  // Add to prefixes
-            }
-        }
+    void AssetManager::UE_LoadPrefixes(const std::string& fileName) {
+        prefixPath = fileName;
+        std::vector<std::string> prefixes = ParseWordArray(fileName, "prefixes", false);
+        std::sort(prefixes.begin(), prefixes.end());   // Front coding needs sorted, unique words
+        prefixes.erase(std::unique(prefixes.begin(), prefixes.end()), prefixes.end());
+        prefixList = FrontCodedWordList::FromSorted(prefixes);
     }
 
     void AssetManager::UE_LoadNSFW(const std::string& fileName)
     {
-        std::ifstream file(fileName);
-        if (!file.is_open()) 
+        nsfwPath = fileName;
+
+        Framework::Trie& nsfwTrie = Framework::Lexicon::GetInstance()->GetNSFW();
+        for (const std::string& item : ParseWordArray(fileName, "nsfw", true))
         {
-            std::cerr << "Could not open the NSFW words file: " << fileName << std::endl;
-            return;
+            nsfwTrie.insert(item); // Insert into NSFW Trie
         }
+        nsfwTrie.finalize();
+    }
 
-        // Read the file contents into a string buffer
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        file.close();
+    const FrontCodedWordList& AssetManager::GetNSFWAssets() const
+    {
+        static const FrontCodedWordList noWords;
+        Lexicon* lexicon = Lexicon::GetInstance();
+        return lexicon ? lexicon->GetNSFWWords() : noWords;
+    }
 
-        // Find the "nsfw" key in the JSON string
-        std::string jsonString = buffer.str();
-        size_t keyPos = jsonString.find("\"nsfw\":");
-        if (keyPos == std::string::npos) 
-        {
-            std::cerr << "Key \"nsfw\" not found in JSON!" << std::endl;
-            return;
-        }
+    const FrontCodedWordList& AssetManager::GetDictionaryAssets() const
+    {
+        static const FrontCodedWordList noWords;
+        Lexicon* lexicon = Lexicon::GetInstance();
+        return lexicon ? lexicon->GetWords() : noWords;
+    }
 
-        // Locate the array start and end brackets
-        size_t arrayStart = jsonString.find('[', keyPos);
-        size_t arrayEnd = jsonString.find(']', arrayStart);
-        if (arrayStart == std::string::npos || arrayEnd == std::string::npos) 
+    const FrontCodedWordList& AssetManager::GetPrefixAssets() const
+    {
+        Lexicon* lexicon = Lexicon::GetInstance();
+        if (lexicon && lexicon->GetPack())
         {
-            std::cerr << "Invalid JSON array format for key \"nsfw\"!" << std::endl;
-            return;
+            return lexicon->GetPack()->GetPrefixes();
         }
+        return prefixList;
+    }
 
-        // Extract the array content
-        std::string arrayContent = jsonString.substr(arrayStart + 1, arrayEnd - arrayStart - 1);
-
-        // Parse the array and process each item
-        std::stringstream ss(arrayContent);
-        std::string item;
-
-        Framework::Trie& nsfwTrie = Framework::Lexicon::GetInstance()->GetNSFW();
-
-        nsfwList.clear(); // Clear the list if storing words there too
-
-        while (std::getline(ss, item, ',')) 
-        {
-            // Remove surrounding quotes
-            item.erase(remove(item.begin(), item.end(), '"'), item.end());
+    void AssetManager::UE_ReplaceDictionary(Trie& builtTrie, AnagramIndex&& builtAnagrams)
+    {
+        Framework::Lexicon::GetInstance()->GetTrie().swap(builtTrie);
+        Framework::Lexicon::GetInstance()->GetAnagramIndex() = std::move(builtAnagrams);
+        std::cout << "Dictionary reloaded: " << GetDictionaryAssets().size() << " words." << std::endl;
+    }
 
-            // Trim spaces
-            item.erase(item.begin(), std::find_if(item.begin(), item.end(), [](unsigned char ch) 
-                {
-                return !std::isspace(ch);
-                }));
-            item.erase(std::find_if(item.rbegin(), item.rend(), [](unsigned char ch) 
-                {
-                return !std::isspace(ch);
-                }).base(), item.end());
+    void AssetManager::UE_SetLexiconSources(const std::string& dictionaryFile, const std::string& prefixFile, const std::string& nsfwFile)
+    {
+        dictionaryPath = dictionaryFile;
+        prefixPath = prefixFile;
+        nsfwPath = nsfwFile;
+    }
 
-            // Convert to lowercase
-            std::transform(item.begin(), item.end(), item.begin(), ::tolower);
+    void AssetManager::UE_ReplacePrefixes(std::vector<std::string>&& prefixes)
+    {
+        // Front coding needs sorted, unique words; order does not matter for random picks
+        std::sort(prefixes.begin(), prefixes.end());
+        prefixes.erase(std::unique(prefixes.begin(), prefixes.end()), prefixes.end());
+        prefixList = FrontCodedWordList::FromSorted(prefixes);
+        std::cout << "Prefixes reloaded: " << GetPrefixAssets().size() << " prefixes." << std::endl;
+    }
 
-            // Insert into trie or list if not empty
-            if (!item.empty()) 
-            {
-                nsfwTrie.insert(item); // Insert into NSFW Trie
-                nsfwList.push_back(item); // Optional: Store in a list
-            }
-        }
+    void AssetManager::UE_ReplaceNSFW(Trie& builtTrie)
+    {
+        Framework::Lexicon::GetInstance()->GetNSFW().swap(builtTrie);
+        std::cout << "NSFW list reloaded: " << GetNSFWAssets().size() << " entries." << std::endl;
     }
 
     void AssetManager::UE_LoadEntities(const std::string& filePath)
@@ -214,18 +206,23 @@ namespace Framework
         entityAssets[filePath] = std::move(entityAsset);
     }
 
+    std::string AssetManager::UE_GetPrefabPath(const std::string& prefabName)
+    {
+        // A virtual path, so the same prefab resolves to the same key wherever it is mounted from
+        return VirtualFileSystem::Join("Assets/Prefabs", prefabName);
+    }
+
     void AssetManager::UE_LoadPrefab(const std::string& prefabName, glm::vec2 Location)
     {
         if (!prefabName.empty())
         {
-            // Get the current working directory (expected to be in 'src/')
-            std::string workingDir = std::filesystem::current_path().string();
-
-            // Go up one directory from 'src/' to project root and enter 'Assets/Prefabs/'
-            std::string prefabPath = workingDir + "/Assets/Prefabs/" + prefabName;
+            // Pooled instances that park themselves need no Despawn() from the caller
+            if (GlobalEntityPool.GetLifetime(prefabName) > 0.0f && GlobalEntityPool.Spawn(prefabName, Location) != EntityPool::InvalidEntity)
+            {
+                return;
+            }
 
-            // Normalize the path to avoid issues (C++17 feature)
-            prefabPath = std::filesystem::weakly_canonical(prefabPath).string();
+            std::string prefabPath = UE_GetPrefabPath(prefabName);
    
             // Load the prefab
                 // If not, load it and store it in the container
@@ -236,6 +233,15 @@ namespace Framework
         }
     }
 
+    void AssetManager::UE_SpawnPooledPrefab(const std::string& prefabName, glm::vec2 Location)
+    {
+        if (GlobalEntityPool.HasPool(prefabName) && GlobalEntityPool.Spawn(prefabName, Location) != EntityPool::InvalidEntity)
+        {
+            return;
+        }
+        UE_LoadPrefab(prefabName, Location);
+    }
+
 
 
     void AssetManager::UE_LoadAudio(const std::string& filePath)
@@ -244,6 +250,13 @@ namespace Framework
         AudioAsset::DeserializeAudio(filePath, audioAssets);
     }
 
+    void AssetManager::UE_ApplyAudioManifest(std::unordered_map<std::string, AudioAsset::MusicAsset>&& newAudioAssets)
+    {
+        // Sounds are created from their file path on every play, so swapping the map is enough
+        audioAssets = std::move(newAudioAssets);
+        std::cout << "Audio manifest reloaded: " << audioAssets.size() << " assets." << std::endl;
+    }
+
     AudioAsset::MusicAsset* AssetManager::UE_GetAudioAsset(const std::string& assetName)
     {
         auto it = audioAssets.find(assetName);
@@ -308,39 +321,21 @@ namespace Framework
 
     bool AssetManager::UE_CopyAudioToFolder(const std::string& sourceFilePath, const std::string& targetFolder)
     {
-        // Extract the filename from the source path
-        size_t pos = sourceFilePath.find_last_of("/\\");
-        std::string fileName = sourceFilePath.substr(pos + 1);
-
-        // Construct the target file path
-        std::string targetFilePath = targetFolder + "\\" + fileName;
-
-        // Open the source file for reading in binary mode
-        std::ifstream sourceFile(sourceFilePath, std::ios::binary);
-        if (!sourceFile.is_open())
-        {
-            std::cerr << "Failed to open source file: " << sourceFilePath << std::endl;
-            return false;
-        }
-
-        // Open the target file for writing in binary mode
-        std::ofstream targetFile(targetFilePath, std::ios::binary);
-        if (!targetFile.is_open())
+        // Copied into the writable mount, the index learns about the file immediately
+        std::string targetFilePath = GlobalVirtualFileSystem.CopyIn(sourceFilePath, targetFolder);
+        if (targetFilePath.empty())
         {
-            std::cerr << "Failed to create target file: " << targetFilePath << std::endl;
+            std::cerr << "Failed to copy " << sourceFilePath << " to " << targetFolder << std::endl;
             return false;
         }
 
-        // Copy the file contents
-        targetFile << sourceFile.rdbuf();
-
         std::cout << "Audio file copied successfully to: " << targetFilePath << std::endl;
         return true;
     }
 
     bool AssetManager::UE_DeleteAudioFile(const std::string& filePath)
     {
-        if (std::remove(filePath.c_str()) == 0)
+        if (GlobalVirtualFileSystem.Remove(filePath))
         {
             std::cout << "File deleted successfully: " << filePath << std::endl;
             return true;
@@ -425,7 +420,7 @@ namespace Framework
         std::string filePath = musicAsset.filePath;
 
         // (Optional) Remove the file from disk
-        if (std::remove(filePath.c_str()) != 0)
+        if (!GlobalVirtualFileSystem.Remove(filePath))
         {
             std::cerr << "Error: Failed to remove file '" << filePath << "' from disk." << std::endl;
         }
@@ -616,32 +611,14 @@ namespace Framework
 
     bool CopyTextureToFolder(const std::string& sourceFilePath, const std::string& targetFolder)
     {
-        // Extract the filename from the source path
-        size_t pos = sourceFilePath.find_last_of("/\\");
-        std::string fileName = sourceFilePath.substr(pos + 1);
-
-        // Construct the target file path
-        std::string targetFilePath = targetFolder + "\\" + fileName;
-
-        // Open the source file for reading in binary mode
-        std::ifstream sourceFile(sourceFilePath, std::ios::binary);
-        if (!sourceFile.is_open())
-        {
-            std::cerr << "Failed to open source file: " << sourceFilePath << std::endl;
-            return false;
-        }
-
-        // Open the target file for writing in binary mode
-        std::ofstream targetFile(targetFilePath, std::ios::binary);
-        if (!targetFile.is_open())
+        // Copied into the writable mount, the index learns about the file immediately
+        std::string targetFilePath = GlobalVirtualFileSystem.CopyIn(sourceFilePath, targetFolder);
+        if (targetFilePath.empty())
         {
-            std::cerr << "Failed to create target file: " << targetFilePath << std::endl;
+            std::cerr << "Failed to copy " << sourceFilePath << " to " << targetFolder << std::endl;
             return false;
         }
 
-        // Copy the file contents
-        targetFile << sourceFile.rdbuf();
-
         std::cout << "File copied successfully to: " << targetFilePath << std::endl;
         return true;
     }
@@ -664,6 +641,14 @@ namespace Framework
         }
         std::cout << "Texture successfully copied to target folder." << std::endl;
 
+        // Compress on import so the loader never has to decode this image at runtime
+        const std::string containerPath = CompressedTexture::ContainerPathFor(targetPath);
+        if (CompressedTexture::Compile(GlobalVirtualFileSystem.RealPath(targetPath), GlobalVirtualFileSystem.WritePath(containerPath)).empty())
+        {
+            std::cerr << "Warning: " << targetPath << " was not compressed, it will be decoded when loaded." << std::endl;
+        }
+        GlobalVirtualFileSystem.Refresh(containerPath);
+
         // Check if a Texture already exists for this name
         auto it = textureAssets.find(name);
         if (it == textureAssets.end())
@@ -709,7 +694,7 @@ namespace Framework
             textureAssets.erase(it);
 
             // Attempt to delete the file from the folder
-            if (std::remove(filePath.c_str()) == 0)
+            if (GlobalVirtualFileSystem.Remove(filePath))
             {
                 std::cout << "File " << filePath << " deleted successfully." << std::endl;
             }
@@ -717,6 +702,7 @@ namespace Framework
             {
                 std::cerr << "Failed to delete file " << filePath << "! Please check permissions or path." << std::endl;
             }
+            GlobalVirtualFileSystem.Remove(CompressedTexture::ContainerPathFor(filePath));  // Not every texture has one
 
             // Re-serialize the entire set of textures
             TextureAsset::Serialize("Assets/JsonData/TextureAsset.json", textureAssets);
@@ -764,42 +750,232 @@ namespace Framework
             return it->second.textureID;  // Return the existing textureID
         }
 
-        // Use stb_image to load the texture from file
+        static Histogram& loadLatency = GlobalMetrics.GetHistogram("ue_texture_load_us", "Texture decode and upload time in microseconds");
+        static Counter& loadCount = GlobalMetrics.GetCounter("ue_textures_loaded_total", "Textures uploaded to OpenGL");
+        const auto loadStart = std::chrono::steady_clock::now();
+
+        // Prefer the compressed container: no decode, no conversion, no mipmap generation and a fraction of the upload
+        // The container has to sit next to the image it was built from, not under another mount's override
+        VirtualFileSystem::FileInfo sourceInfo, containerInfo;
+        const std::string containerFile = CompressedTexture::ContainerPathFor(textureFilePath);
+        const std::string sourcePath = GlobalVirtualFileSystem.RealPath(textureFilePath);
+        const std::string containerPath = GlobalVirtualFileSystem.RealPath(containerFile);
+        if (!sourcePath.empty() && !containerPath.empty()
+            && GlobalVirtualFileSystem.Stat(textureFilePath, sourceInfo) && GlobalVirtualFileSystem.Stat(containerFile, containerInfo)
+            && sourceInfo.mountSource == containerInfo.mountSource && !CompressedTexture::IsStale(sourcePath, containerPath))
+        {
+            std::shared_ptr<CompressedTexture> compressed = CompressedTexture::Open(containerPath);
+            if (compressed && compressed->GetLayout() == GlobalTextureLayout)
+            {
+                GLuint textureID = 0;
+                GlobalRenderQueue.Execute([&]()
+                    {
+                        // Drivers without the format get the decoded image below instead
+                        if (CompressedTexture::IsSupportedByGL(compressed->GetCodec(), compressed->GetLayout()))
+                        {
+                            glGenTextures(1, &textureID);
+                            if (textureID != 0)
+                            {
+                                UploadCompressedLevels(textureID, *compressed);
+                            }
+                        }
+                    });
+                if (textureID != 0)
+                {
+                    it->second.textureID = textureID;
+                    loadLatency.RecordMicroseconds(std::chrono::steady_clock::now() - loadStart);
+                    loadCount.Increment();
+                    return textureID;
+                }
+            }
+        }
+
+        // Use stb_image to load the texture from file, expanded to RGBA and converted to the renderer's layout
+        std::vector<uint8_t> encoded;
+        if (!GlobalVirtualFileSystem.ReadFile(textureFilePath, encoded))
+        {
+            return 0;
+        }
         int width, height, nrChannels;
-        data = stbi_load(textureFilePath.c_str(), &width, &height, &nrChannels, 0);
+        data = stbi_load_from_memory(encoded.data(), static_cast<int>(encoded.size()), &width, &height, &nrChannels, 4);
         if (!data)
         {
             //std::cerr << "Failed to load texture at path: " << textureFilePath << std::endl;
             return 0;  // Return 0 if loading fails
         }
+        nrChannels = 4;
+        TextureImport::Normalize(data, static_cast<size_t>(width) * height);
 
-        // If not loaded, generate a new texture ID and load the texture from the file
-        GLuint textureID;
-        glGenTextures(1, &textureID);
+        // If not loaded, generate a new texture ID and load the texture from the file.
+        // GL calls go to the render thread when it owns the context, decoding stays here
+        GLuint textureID = 0;
+        GlobalRenderQueue.Execute([&]()
+            {
+                glGenTextures(1, &textureID);
+                if (textureID != 0)
+                {
+                    UploadTexturePixels(textureID, data, width, height, nrChannels);
+                }
+            });
         if (textureID == 0)
         {
             std::cerr << "Failed to generate texture ID" << std::endl;
             stbi_image_free(data);
             return 0;
         }
+
+        // Free image memory
+        stbi_image_free(data);
+
+        // Store the generated textureID in the texture map for future use
+        it->second.textureID = textureID;  // Store the textureID in the Texture object
+
+        loadLatency.RecordMicroseconds(std::chrono::steady_clock::now() - loadStart);
+        loadCount.Increment();
+
+        //std::cout << "Loaded texture with name '" << textureName << "' and ID: " << textureID << std::endl;
+
+        return textureID;
+    }
+
+    void AssetManager::UploadTexturePixels(GLuint textureID, const unsigned char* pixels, int width, int height, int nrChannels)
+    {
         glBindTexture(GL_TEXTURE_2D, textureID);
 
         // Determine texture format based on channels
         GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
+        GLenum internalFormat = (nrChannels == 4) ? GlobalTextureLayout.InternalFormat() : (GlobalTextureLayout.srgb ? GL_SRGB8 : GL_RGB8);
+
+        // RGB rows are only 4 byte aligned when the width is a multiple of 4
+        glPixelStorei(GL_UNPACK_ALIGNMENT, (nrChannels == 4) ? 4 : 1);
 
         // Generate the texture and load the image into OpenGL
-        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, pixels);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
         glGenerateMipmap(GL_TEXTURE_2D);
+    }
 
-        // Free image memory
-        stbi_image_free(data);
+    void AssetManager::UploadCompressedLevels(GLuint textureID, const CompressedTexture& texture)
+    {
+        glBindTexture(GL_TEXTURE_2D, textureID);
 
-        // Store the generated textureID in the texture map for future use
-        it->second.textureID = textureID;  // Store the textureID in the Texture object
+        const GLenum format = CompressedTexture::GLFormat(texture.GetCodec(), texture.GetLayout());
+        const std::vector<CompressedTexture::Level>& levels = texture.GetLevels();
+        for (size_t level = 0; level < levels.size(); ++level)
+        {
+            const GLsizei width = static_cast<GLsizei>(levels[level].width);
+            const GLsizei height = static_cast<GLsizei>(levels[level].height);
+            if (texture.GetCodec() == TextureCodec::RGBA8)
+            {
+                // Already in the final layout: the driver copies the mapped texels as they are
+                glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), format, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, levels[level].data);
+            }
+            else
+            {
+                glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), format, width, height, 0,
+                    static_cast<GLsizei>(levels[level].size), levels[level].data);
+            }
+        }
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levels.size() - 1));
+    }
 
-        //std::cout << "Loaded texture with name '" << textureName << "' and ID: " << textureID << std::endl;
+    void AssetManager::UE_CompressTextures(TextureCodec codec, bool force)
+    {
+        // Several texture names may share one image
+        std::unordered_set<std::string> compressedPaths;
+        size_t uncompressedBytes = 0, compressedBytes = 0, compressedCount = 0, skippedCount = 0;
+        double seconds = 0.0;
 
-        return textureID;
+        for (const auto& [name, texture] : textureAssets)
+        {
+            if (!compressedPaths.insert(texture.path).second)
+            {
+                continue;
+            }
+
+            // Images packed in an archive are compressed when the archive is built, not here
+            const std::string sourcePath = GlobalVirtualFileSystem.RealPath(texture.path);
+            if (sourcePath.empty())
+            {
+                ++skippedCount;
+                continue;
+            }
+            const std::string containerFile = CompressedTexture::ContainerPathFor(texture.path);
+            const std::string containerPath = GlobalVirtualFileSystem.WritePath(containerFile);
+            if (containerPath.empty())
+            {
+                continue;
+            }
+            if (!force && !CompressedTexture::IsStale(sourcePath, containerPath))
+            {
+                // Containers written for another layout are rebuilt too
+                std::shared_ptr<CompressedTexture> existing = CompressedTexture::Open(containerPath);
+                if (existing && existing->GetLayout() == GlobalTextureLayout)
+                {
+                    ++skippedCount;
+                    continue;
+                }
+            }
+
+            CompressedTexture::Report report;
+            const bool compiled = !CompressedTexture::Compile(sourcePath, containerPath, codec, 0, &report).empty();
+            GlobalVirtualFileSystem.Refresh(containerFile);
+            if (!compiled)
+            {
+                continue;
+            }
+            uncompressedBytes += report.uncompressedBytes;
+            compressedBytes += report.compressedBytes;
+            seconds += report.seconds;
+            ++compressedCount;
+        }
+
+        std::cout << "Textures compressed: " << compressedCount << " (" << skippedCount << " up to date), "
+            << uncompressedBytes / 1024 << " KB -> " << compressedBytes / 1024 << " KB in " << seconds << " s" << std::endl;
+    }
+
+    void AssetManager::UE_ReloadTextureFile(const std::string& filePath, const unsigned char* pixels, int width, int height, int nrChannels)
+    {
+        // Several texture names may point at the same image file
+        for (auto& [name, texture] : textureAssets)
+        {
+            if (texture.textureID != 0 && std::filesystem::path(texture.path).lexically_normal() == std::filesystem::path(filePath).lexically_normal())
+            {
+                const GLuint textureID = texture.textureID;
+                GlobalRenderQueue.Execute([&]() { UploadTexturePixels(textureID, pixels, width, height, nrChannels); });
+                std::cout << "Texture reloaded: " << name << std::endl;
+            }
+        }
+        GlobalParticleSystem.InvalidateTextures();
+    }
+
+    void AssetManager::UE_ApplyTextureManifest(std::unordered_map<std::string, TextureAsset::Texture>&& newTextures)
+    {
+        for (auto& [name, texture] : newTextures)
+        {
+            // Keep the uploaded texture if the entry still points at the same file
+            auto it = textureAssets.find(name);
+            if (it != textureAssets.end() && it->second.path == texture.path)
+            {
+                texture.textureID = it->second.textureID;
+                it->second.textureID = 0;
+            }
+        }
+
+        // Release textures that were removed or repointed, they reload lazily on next use
+        for (auto& [name, texture] : textureAssets)
+        {
+            if (texture.textureID != 0)
+            {
+                // Frames already built may still draw with it
+                GlobalRenderQueue.ReleaseAfterFrame([textureID = texture.textureID]() { glDeleteTextures(1, &textureID); });
+            }
+        }
+
+        textureAssets = std::move(newTextures);
+        GlobalParticleSystem.InvalidateTextures();  // Names may now point at other textures
+        std::cout << "Texture manifest reloaded: " << textureAssets.size() << " textures." << std::endl;
     }
 
     std::string AssetManager::UE_LoadGraphicsShader(const std::string& filePath)
@@ -810,16 +986,14 @@ namespace Framework
             return graphicShaderSources[filePath]; // Shader already loaded, no need to load again
         }
 
-        std::ifstream shaderFile(filePath);
-        if (!shaderFile.is_open())
+        std::string shaderCode;
+        if (!GlobalVirtualFileSystem.ReadFile(filePath, shaderCode))
         {
             throw std::runtime_error("Failed to open shader file: " + filePath);
         }
 
-        std::ostringstream shaderStream;
-        shaderStream << shaderFile.rdbuf(); // Read the file buffer into the stream
-        graphicShaderSources[filePath] = shaderStream.str(); // Store the shader code in the container
-        return shaderStream.str();
+        graphicShaderSources[filePath] = shaderCode; // Store the shader code in the container
+        return shaderCode;
     }
 
     const std::string& AssetManager::UE_GetShaderSource(const std::string& shaderKey) const
@@ -836,6 +1010,27 @@ namespace Framework
         }
     }
 
+    bool AssetManager::UE_ReplaceShaderSource(const std::string& filePath, const std::string& source)
+    {
+        bool replaced = false;
+
+        auto graphicIt = graphicShaderSources.find(filePath);
+        if (graphicIt != graphicShaderSources.end())
+        {
+            graphicIt->second = source;
+            replaced = true;
+        }
+
+        auto fontIt = fontShaderSources.find(filePath);
+        if (fontIt != fontShaderSources.end())
+        {
+            fontIt->second = source;
+            replaced = true;
+        }
+
+        return replaced;
+    }
+
     std::string AssetManager::UE_LoadFontShader(const std::string& filePath)
     {
         // Check if the shader is already loaded
@@ -844,19 +1039,14 @@ namespace Framework
             return fontShaderSources[filePath]; // Shader already loaded, return it
         }
 
-        // Try to open the shader file
-        std::ifstream shaderFile(filePath);
-        if (!shaderFile.is_open()) 
+        // Read the shader file through the mounts
+        std::string shaderCode;
+        if (!GlobalVirtualFileSystem.ReadFile(filePath, shaderCode))
         {
             std::cerr << "Failed to open shader file: " << filePath << std::endl;
             return ""; // Return empty string if the file can't be opened
         }
 
-        // Read the content of the file into a stringstream
-        std::stringstream buffer;
-        buffer << shaderFile.rdbuf();
-        std::string shaderCode = buffer.str();
-
         // Store the shader code in the container (fontShaderSources)
         fontShaderSources[filePath] = shaderCode;
 
@@ -930,9 +1120,49 @@ namespace Framework
         }
 
         fontCacheAssets[fontName] = characters; 
+        const bool newFont = fontSources.find(fontName) == fontSources.end();
+        fontSources[fontName] = FontSource{ fontPath, fontSize };
+        if (newFont)
+        {
+            GlobalFileWatcher.RebuildPathMap();     // Watch the font file for hot reload
+        }
         FT_Done_Face(face); // Frees face resources
         std::cout << "Font " << fontName << " loaded successfully." << std::endl;
         std::cout << "Current font assets: " << fontCacheAssets.size() << std::endl;
+        GlobalMetrics.GetGauge("ue_font_assets", "Fonts loaded into the glyph cache").Set(static_cast<double>(fontCacheAssets.size()));
+        return true;
+    }
+
+    bool AssetManager::UE_ReloadFont(const std::string& fontName)
+    {
+        auto source = fontSources.find(fontName);
+        if (source == fontSources.end())
+        {
+            return false;
+        }
+        const FontSource reloaded = source->second;
+
+        // UE_LoadFont skips fonts already in the cache, so take the old glyphs out first
+        std::unordered_map<char, Character> previous;
+        auto cached = fontCacheAssets.find(fontName);
+        if (cached != fontCacheAssets.end())
+        {
+            previous = std::move(cached->second);
+            fontCacheAssets.erase(cached);
+        }
+
+        if (!UE_LoadFont(reloaded.path, reloaded.fontSize, fontName))
+        {
+            fontCacheAssets[fontName] = std::move(previous);
+            return false;
+        }
+
+        // Frames already built may still draw the old glyphs
+        for (const auto& [c, character] : previous)
+        {
+            GlobalRenderQueue.ReleaseAfterFrame([textureID = character.TextureID]() { glDeleteTextures(1, &textureID); });
+        }
+        GlobalTextLayoutCache.InvalidateFont(fontName);
         return true;
     }
 }
\ No newline at end of file
@@ -32,6 +32,7 @@
 #include "EntityAsset.h"
 #include "AudioAsset.h"
 #include "TextureAsset.h"
+#include "CompressedTexture.h"
 #include "lexicon.h"
 
 // Forward declaration of asset types here
@@ -69,9 +70,7 @@ namespace Framework
             audioAssets.clear();
             entityAssets.clear();
             windowAssets.clear();
-            nsfwList.clear();
-            dictionaryWords.clear();
-            prefixList.clear();
+            prefixList = FrontCodedWordList();
             bulletDataMap.clear();
             animationDataMap.clear();
             // delete data; // Removed
@@ -112,21 +111,58 @@ namespace Framework
 
         /**
          * @brief Retrieves the list of NSFW assets.
-         * @return A constant reference to the vector containing NSFW-related asset names.
+         * @return The sorted NSFW list, read from the active lexicon pack when one is loaded.
          */
-        const std::vector<std::string>& GetNSFWAssets() const { return nsfwList; }
+        const FrontCodedWordList& GetNSFWAssets() const;
 
         /**
          * @brief Retrieves the list of dictionary words.
-         * @return A constant reference to the vector containing dictionary words.
+         * @return The sorted dictionary, read from the active lexicon pack when one is loaded.
          */
-        const std::vector<std::string>& GetDictionaryAssets() const { return dictionaryWords; }
+        const FrontCodedWordList& GetDictionaryAssets() const;
 
         /**
          * @brief Retrieves the list of prefix assets.
-         * @return A constant reference to the vector containing prefix words.
+         * @return The sorted prefixes, read from the active lexicon pack when one is loaded.
          */
-        const std::vector<std::string>& GetPrefixAssets() const { return prefixList; }
+        const FrontCodedWordList& GetPrefixAssets() const;
+
+        /**
+         * @brief Extracts and sanitizes the string array stored under a key of a word list file.
+         * @param fileName Path to the JSON word list.
+         * @param key Name of the array (e.g. "words", "prefixes", "nsfw").
+         * @param toLower Whether entries are converted to lowercase.
+         * @return The trimmed, non-empty entries in file order.
+         */
+        static std::vector<std::string> ParseWordArray(const std::string& fileName, const std::string& key, bool toLower);
+
+        /**
+         * @brief Swaps in a dictionary that was parsed and built off the main thread.
+         * @param builtTrie Trie already filled with the words, swapped into the Lexicon.
+         * @param builtAnagrams Anagram index built from the trie's word list.
+         */
+        void UE_ReplaceDictionary(Trie& builtTrie, AnagramIndex&& builtAnagrams);
+
+        /**
+         * @brief Records the word list files of a locale served from a lexicon pack, so hot
+         *        reload watches them.
+         */
+        void UE_SetLexiconSources(const std::string& dictionaryFile, const std::string& prefixFile, const std::string& nsfwFile);
+
+        /**
+         * @brief Swaps in a prefix list that was parsed off the main thread. The list is sorted here.
+         */
+        void UE_ReplacePrefixes(std::vector<std::string>&& prefixes);
+
+        /**
+         * @brief Swaps in an NSFW trie that was built off the main thread.
+         */
+        void UE_ReplaceNSFW(Trie& builtTrie);
+
+        // Paths of the word lists currently loaded, used for hot reload
+        const std::string& GetDictionaryPath() const { return dictionaryPath; }
+        const std::string& GetPrefixPath() const { return prefixPath; }
+        const std::string& GetNSFWPath() const { return nsfwPath; }
 
         /***************/
         //   Entities  //
@@ -140,12 +176,28 @@ namespace Framework
         void UE_LoadEntities(const std::string& filePath);                     // Load ECS Objects
 
         /**
-         * @brief Loads ECS entities from a specified file in nested prefab folder.
+         * @brief Loads ECS entities from a specified file in nested prefab folder. Prefabs
+         *        whose pool has a lifetime (popups) are spawned from the pool instead and park
+         *        themselves when it runs out.
          * @param filePath Path to the file containing ECS entity data.
          * @return A reference to the loaded EntityAsset object.
          */
         void UE_LoadPrefab(const std::string& filePath, glm::vec2 Location = glm::vec2(-1,-1));                     // Load ECS Objects
 
+        /**
+         * @brief Spawns a prefab from its entity pool if one is configured, otherwise loads
+         *        it like UE_LoadPrefab. Pooled instances must be returned with
+         *        GlobalEntityPool.Despawn() rather than destroyed.
+         * @param prefabName File name of the prefab inside Assets/Prefabs.
+         * @param Location Spawn position, (-1, -1) to keep the prefab's own positions.
+         */
+        void UE_SpawnPooledPrefab(const std::string& prefabName, glm::vec2 Location = glm::vec2(-1, -1));
+
+        /**
+         * @brief Full, normalized path of a prefab file inside Assets/Prefabs.
+         */
+        static std::string UE_GetPrefabPath(const std::string& prefabName);
+
         /**
          * @brief Retrieves all loaded ECS entities.
          * @return A reference to an unordered map containing all EntityAssets.
@@ -162,6 +214,12 @@ namespace Framework
          * @return A shared pointer to the loaded AudioAsset object.
          */
         void UE_LoadAudio(const std::string& filePath);         // Load Audio
+
+        /**
+         * @brief Replaces all audio assets with a freshly deserialized manifest.
+         * @param newAudioAssets Audio assets deserialized off the main thread.
+         */
+        void UE_ApplyAudioManifest(std::unordered_map<std::string, AudioAsset::MusicAsset>&& newAudioAssets);
         
         /**
          * @brief Retrieves a loaded audio asset by name.
@@ -299,7 +357,8 @@ namespace Framework
         std::string UE_GetTexturePath(const std::string& textureName);
 
         /**
-         * @brief Loads a texture into OpenGL and returns its ID.
+         * @brief Loads a texture into OpenGL and returns its ID. A fresh compressed container next
+         *        to the image is uploaded as is, mip chain included; otherwise the image is decoded.
          * @param textureName Name of the texture asset.
          * @return The OpenGL texture ID.
          */
@@ -312,6 +371,28 @@ namespace Framework
          */
         void UE_AddTexture(const std::string& name, const std::string& path);
 
+        /**
+         * @brief Compresses every texture whose container is missing or older than its image and
+         *        prints the size and quality of each, for use before shipping or after bulk imports.
+         * @param codec Block format, Auto picks BC1 for opaque images and BC7 for the rest.
+         * @param force Recompresses up to date textures too, e.g. to change the codec.
+         */
+        void UE_CompressTextures(TextureCodec codec = TextureCodec::Auto, bool force = false);
+
+        /**
+         * @brief Re-uploads decoded pixels to every loaded texture that uses the given file.
+         * @param filePath Image file that changed on disk.
+         * @param pixels Decoded image data.
+         */
+        void UE_ReloadTextureFile(const std::string& filePath, const unsigned char* pixels, int width, int height, int nrChannels);
+
+        /**
+         * @brief Replaces the texture table with a freshly deserialized manifest. Entries whose
+         *        path is unchanged keep their OpenGL texture, others reload lazily.
+         * @param newTextures Textures deserialized off the main thread.
+         */
+        void UE_ApplyTextureManifest(std::unordered_map<std::string, TextureAsset::Texture>&& newTextures);
+
         /********************************/
         //   Graphics Shader Functions  //
         /********************************/
@@ -330,6 +411,24 @@ namespace Framework
          */
         const std::string& UE_GetShaderSource(const std::string& shaderKey) const;
 
+        /**
+         * @brief Replaces the cached source of an already loaded graphics or font shader.
+         * @param filePath Path the shader was loaded from.
+         * @param source New shader source code.
+         * @return True if a cached shader was replaced.
+         */
+        bool UE_ReplaceShaderSource(const std::string& filePath, const std::string& source);
+
+        /**
+         * @brief Retrieves all cached graphics shader sources keyed by file path.
+         */
+        const std::unordered_map<std::string, std::string>& GetGraphicShaderSources() const { return graphicShaderSources; }
+
+        /**
+         * @brief Retrieves all cached font shader sources keyed by file path.
+         */
+        const std::unordered_map<std::string, std::string>& GetFontShaderSources() const { return fontShaderSources; }
+
         /*********************/
         //   Font Functions  //
         /*********************/
@@ -356,6 +455,27 @@ namespace Framework
          * @return A pointer to the loaded FontAsset object.
          */
         bool UE_LoadFont(const std::string& filePath, int fontSize, const std::string& fontName);             // Load Font
+
+        /**
+         * @struct FontSource
+         * @brief File and pixel size a font was loaded from, kept for hot reload.
+         */
+        struct FontSource
+        {
+            std::string path;
+            int fontSize = 0;
+        };
+
+        /**
+         * @brief Loads a font again from its file, e.g. after it changed on disk. Cached text
+         *        layouts using it are dropped; the old glyphs stay if the file cannot be loaded.
+         */
+        bool UE_ReloadFont(const std::string& fontName);
+
+        /**
+         * @brief Retrieves the file and size of every loaded font, keyed by font name.
+         */
+        const std::unordered_map<std::string, FontSource>& GetFontSources() const { return fontSources; }
         
         /**
          * @brief Retrieves the font cache assets.
@@ -398,21 +518,39 @@ namespace Framework
             return animationDataMap;
         }
 
+        /**
+         * @brief Frame tables of every animation in AnimationAsset.json.
+         */
+        AnimationClipLibrary& GetAnimationClips() { return animationClips; }
+
         static unsigned char* data;     // Static data buffer used for image loading
 
     private:
+        /**
+         * @brief Uploads decoded image data into an existing OpenGL texture and builds its mipmaps.
+         */
+        static void UploadTexturePixels(GLuint textureID, const unsigned char* pixels, int width, int height, int nrChannels);
+
+        /**
+         * @brief Uploads every level of a compressed texture into an existing OpenGL texture.
+         */
+        static void UploadCompressedLevels(GLuint textureID, const CompressedTexture& texture);
+
         std::unordered_map<std::string, std::unique_ptr<Window>> windowAssets;                          // Container for Windowconfig
-        std::vector<std::string> dictionaryWords;
-        std::vector<std::string> prefixList;
-        std::vector<std::string> nsfwList;
+        FrontCodedWordList prefixList;                                                                  // Prefixes loaded from JSON; the dictionary and NSFW list live in the Lexicon tries
+        std::string dictionaryPath;                                                                     // Word list files last loaded
+        std::string prefixPath;
+        std::string nsfwPath;
         std::unordered_map<std::string, std::unique_ptr<EntityAsset>> entityAssets;                     // Container for EntityAsset
         std::unordered_map<std::string, AudioAsset::MusicAsset> audioAssets;                            // Container for AudioAsset
         std::unordered_map<std::string, TextureAsset::Texture> textureAssets;                           // Container for TextureAsset
         std::unordered_map<std::string, std::string> graphicShaderSources;                              // Container for Graphics Shader
         std::unordered_map<std::string, std::unordered_map<char, Character>> fontCacheAssets;           // Container for Font Assets
+        std::unordered_map<std::string, FontSource> fontSources;                                        // Font files, for hot reload
         std::unordered_map<std::string, std::string> fontShaderSources;                                 // Container for Font Shader
         std::unordered_map<std::string, EntityAsset::BulletData> bulletDataMap;                         // Container for Bullet Data
         std::unordered_map<std::string, EntityAsset::Animation> animationDataMap;
+        AnimationClipLibrary animationClips;                                                            // Compiled animation frame tables
     };
     extern AssetManager GlobalAssetManager;  // Global instance of AssetManager, defined in AssetManager.cpp
 }
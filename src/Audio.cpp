@@ -14,12 +14,41 @@
 #include "pch.h"
 #include "AssetManager.h"
 #include "PlayerSystem.h"
+#include "Metrics.h"
+#include "SerializedEnums.h"
+#include "VirtualFileSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 namespace Framework
 {
     // Define the global Audio Instance
     Audio GlobalAudio;
 
+    namespace
+    {
+        // Loose files are opened by FMOD itself, files packed in an archive are handed over as memory
+        FMOD_RESULT CreateSoundFromMounts(System* system, const std::string& filePath, FMOD_MODE mode, Sound** sound)
+        {
+            const std::string realPath = GlobalVirtualFileSystem.RealPath(filePath);
+            if (!realPath.empty())
+            {
+                return system->createSound(realPath.c_str(), mode, nullptr, sound);
+            }
+
+            std::vector<uint8_t> contents;
+            if (!GlobalVirtualFileSystem.ReadFile(filePath, contents))
+            {
+                return FMOD_ERR_FILE_NOTFOUND;
+            }
+            FMOD_CREATESOUNDEXINFO info{};
+            info.cbsize = sizeof(info);
+            info.length = static_cast<unsigned int>(contents.size());
+            return system->createSound(reinterpret_cast<const char*>(contents.data()), mode | FMOD_OPENMEMORY, &info, sound);   // FMOD copies the bytes
+        }
+    }
+
     // Constructor
     Audio::Audio()
     {
@@ -80,18 +109,12 @@ namespace Framework
     // Function to change from String to FMOD_MODE
     FMOD_MODE Audio::UE_GetModeFromString(const std::string& mode)
     {
-        if (mode == "loop")
+        PlaybackMode playback = PlaybackMode::OneShot;
+        if (!TryEnumFromString(mode, playback))
         {
-            return FMOD_LOOP_NORMAL;        // Looping Mode
-        }
-        else if (mode == "oneshot")
-        {
-            return FMOD_DEFAULT;            // One-shot playback
-        }
-        else
-        {
-            throw std::runtime_error("Invalid sound mode : " + mode);
+            std::cerr << "Warning: Invalid sound mode '" << mode << "', playing as oneshot." << std::endl;
         }
+        return playback == PlaybackMode::Loop ? FMOD_LOOP_NORMAL : FMOD_DEFAULT;   // Looping or one-shot playback
     }
 
     Sound* Audio::UE_LoadSound(const std::string& customName)
@@ -118,7 +141,7 @@ namespace Framework
         std::string filePath = musicAsset->filePath;
         std::string modeString = musicAsset->mode;
         FMOD_MODE mode = UE_GetModeFromString(modeString);                                                  // Convert the string mode to FMOD_MODE
-        FMOD_RESULT result = pSystem->createSound(filePath.c_str(), FMOD_IGNORETAGS | mode, 0, &pSound);    // Create Sound
+        FMOD_RESULT result = CreateSoundFromMounts(pSystem, filePath, FMOD_IGNORETAGS | mode, &pSound);    // Create Sound
 
         if (result != FMOD_OK)
         {
@@ -626,5 +649,74 @@ namespace Framework
                 ++it;
             }
         }
+
+        static Gauge& activeChannelCount = GlobalMetrics.GetGauge("ue_audio_active_channels", "Audio channels currently tracked");
+        activeChannelCount.Set(static_cast<double>(activeChannels.size()));
+    }
+
+    std::vector<float> Audio::UE_ReadWaveformPeaks(const std::string& filePath, size_t binCount)
+    {
+        std::vector<float> peaks;
+        Sound* pSound = nullptr;
+        if (binCount == 0 || CreateSoundFromMounts(pSystem, filePath, FMOD_OPENONLY | FMOD_IGNORETAGS, &pSound) != FMOD_OK)
+        {
+            return peaks;
+        }
+
+        FMOD_SOUND_FORMAT format = FMOD_SOUND_FORMAT_NONE;
+        int channels = 0, bits = 0;
+        unsigned int frameCount = 0;
+        pSound->getFormat(nullptr, &format, &channels, &bits);
+        pSound->getLength(&frameCount, FMOD_TIMEUNIT_PCM);
+        const bool readable = format == FMOD_SOUND_FORMAT_PCM8 || format == FMOD_SOUND_FORMAT_PCM16 || format == FMOD_SOUND_FORMAT_PCMFLOAT;
+        if (!readable || channels <= 0 || frameCount == 0)
+        {
+            pSound->release();
+            return peaks;
+        }
+
+        peaks.assign(binCount, 0.0f);
+        const unsigned int frameBytes = static_cast<unsigned int>(channels * bits / 8);
+        std::vector<uint8_t> buffer(frameBytes * 4096);
+        uint64_t frame = 0;
+        for (;;)
+        {
+            // readData decodes compressed formats to PCM with FMOD's own codecs
+            unsigned int bytesRead = 0;
+            const FMOD_RESULT result = pSound->readData(buffer.data(), static_cast<unsigned int>(buffer.size()), &bytesRead);
+            for (unsigned int offset = 0; offset + frameBytes <= bytesRead; offset += frameBytes, ++frame)
+            {
+                float loudest = 0.0f;
+                for (int channel = 0; channel < channels; ++channel)
+                {
+                    const uint8_t* sample = buffer.data() + offset + channel * bits / 8;
+                    float value = 0.0f;
+                    if (format == FMOD_SOUND_FORMAT_PCM8)
+                    {
+                        value = static_cast<int8_t>(*sample) / 128.0f;
+                    }
+                    else if (format == FMOD_SOUND_FORMAT_PCM16)
+                    {
+                        int16_t pcm = 0;
+                        std::memcpy(&pcm, sample, sizeof(pcm));
+                        value = pcm / 32768.0f;
+                    }
+                    else
+                    {
+                        std::memcpy(&value, sample, sizeof(value));
+                    }
+                    loudest = std::max(loudest, std::abs(value));
+                }
+                float& peak = peaks[std::min<size_t>(static_cast<size_t>(frame * binCount / frameCount), binCount - 1)];
+                peak = std::max(peak, std::min(loudest, 1.0f));
+            }
+            if (result != FMOD_OK || bytesRead == 0)
+            {
+                break;
+            }
+        }
+
+        pSound->release();
+        return peaks;
     }
-}
\ No newline at end of file
+}
@@ -44,6 +44,16 @@ namespace Framework
             SOUND_EFFECT        // Sound effect type
         };
 
+        /**
+        *   @enum PlaybackMode
+        *   @brief How a sound plays, stored as "mode" in the audio manifest.
+        */
+        enum class PlaybackMode
+        {
+            OneShot,            // Plays once
+            Loop                // Repeats until stopped
+        };
+
         /**
         *   @brief Constructor for Audio system.
         *   @param AssetManager Pointer to the asset manager to load sound assets.
@@ -81,7 +91,7 @@ namespace Framework
         /**
          * @brief Converts a string representing a mode (e.g., "loop") to an FMOD_MODE.
          * @param mode The mode as a string.
-         * @return FMOD_MODE corresponding to the string.
+         * @return FMOD_MODE corresponding to the string, one-shot for unknown modes.
          */
         FMOD_MODE UE_GetModeFromString(const std::string& mode);
 
@@ -194,6 +204,16 @@ namespace Framework
 
         void UE_CleanupDeadChannels();
 
+        /**
+         * @brief Decodes an audio file and returns the loudest sample of each bin, 0 to 1, for
+         *        waveform previews. The file is opened on its own instead of through the loaded
+         *        sounds, so worker threads may call this.
+         * @param filePath Audio file to read.
+         * @param binCount Number of peaks to return, spread evenly over the whole file.
+         * @return The peaks, or an empty vector if the file could not be decoded.
+         */
+        std::vector<float> UE_ReadWaveformPeaks(const std::string& filePath, size_t binCount);
+
         void DebugChannelState()
         {
             std::cout << "=== AUDIO DEBUG ===" << std::endl;
@@ -16,23 +16,22 @@
 #include "pch.h"
 #include "AudioAsset.h"
 #include "Audio.h"
+#include "SerializedEnums.h"
+#include "VirtualFileSystem.h"
+#include "JsonWriter.h"
 
 // Deserialize audio assets from a JSON file
 void AudioAsset::DeserializeAudio(const std::string& filePath, std::unordered_map<std::string, MusicAsset>& musicAssets)
 {
-    std::ifstream file(filePath);
-    if (!file.is_open())
+    std::string jsonString;
+    if (!Framework::GlobalVirtualFileSystem.ReadFile(filePath, jsonString))
     {
         std::cerr << "Error: Could not open JSON file: " << filePath << std::endl;
         throw std::runtime_error("Could not open JSON file.");
     }
 
-    std::stringstream buffer;
-    buffer << file.rdbuf(); // Read the entire file into the buffer
-    std::string jsonString = buffer.str(); // Get the content as a string
-
     rapidjson::Document document; // Parse the JSON string
-    document.Parse(jsonString.c_str());
+    Framework::ParseJson(document, jsonString);
 
     if (document.HasParseError())
     {
@@ -78,43 +77,35 @@ void AudioAsset::DeserializeAudio(const std::string& filePath, std::unordered_ma
     {
         std::cerr << "Invalid JSON structure: 'musicAssets' array not found." << std::endl;
     }
-    file.close();
 }
 
 // Serialize audio assets to a JSON file
 void AudioAsset::SerializeAudio(const std::string& filePath, const std::unordered_map<std::string, MusicAsset>& musicAssets)
 {
-    rapidjson::Document document;
-    document.SetObject();
-
-    rapidjson::Value musicArray(rapidjson::kArrayType);
-    rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
+    Framework::JsonWriter writer(filePath, Framework::GlobalJsonStyle);
+    if (!writer.IsOpen())
+    {
+        std::cerr << "Error: Could not open file for writing: " << filePath << std::endl;
+        return;
+    }
 
+    writer.StartObject();
+    writer.Key("musicAssets");
+    writer.StartArray();
     for (const auto& [customName, asset] : musicAssets)
     {
-        rapidjson::Value musicObject(rapidjson::kObjectType);
-
-        musicObject.AddMember("customName", rapidjson::Value(customName.c_str(), allocator), allocator);
-        musicObject.AddMember("filePath", rapidjson::Value(asset.filePath.c_str(), allocator), allocator);
-        musicObject.AddMember("mode", rapidjson::Value(asset.mode.c_str(), allocator), allocator);
-
-        std::string soundTypeStr = SoundTypeToString(asset.soundType);
-        musicObject.AddMember("soundType", rapidjson::Value(soundTypeStr.c_str(), allocator), allocator);
-
-        musicArray.PushBack(musicObject, allocator);
+        writer.StartObject();
+        writer.Member("customName", customName);
+        writer.Member("filePath", asset.filePath);
+        writer.Member("mode", asset.mode);
+        writer.Member("soundType", SoundTypeToString(asset.soundType));
+        writer.EndObject();
     }
+    writer.EndArray();
+    writer.EndObject();
 
-    document.AddMember("musicAssets", musicArray, allocator);
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
-    document.Accept(writer);
-
-    std::ofstream outFile(filePath);
-    if (outFile.is_open())
+    if (writer.Commit())
     {
-        outFile << buffer.GetString();
-        outFile.close();
         std::cout << "Successfully serialized audio assets to " << filePath << std::endl;
     }
     else
@@ -125,31 +116,16 @@ void AudioAsset::SerializeAudio(const std::string& filePath, const std::unordere
 
 Framework::Audio::SoundType AudioAsset::UE_GetSoundTypeFromString(const std::string& soundTypeStr) const
 {
-    if (soundTypeStr == "background")
-    {
-        return Framework::Audio::BACKGROUND_MUSIC;
-    }
-    else if (soundTypeStr == "effect")
+    Framework::Audio::SoundType soundType = Framework::Audio::SOUND_EFFECT;
+    if (!Framework::TryEnumFromString(soundTypeStr, soundType) || soundType == Framework::Audio::EMPTY)
     {
+        std::cerr << "Warning: Invalid sound type '" << soundTypeStr << "', using effect." << std::endl;
         return Framework::Audio::SOUND_EFFECT;
     }
-    else
-    {
-        throw std::runtime_error("Invalid sound type: " + soundTypeStr);
-    }
+    return soundType;
 }
 
 std::string AudioAsset::SoundTypeToString(Framework::Audio::SoundType soundType)
 {
-    switch (soundType)
-    {
-    case Framework::Audio::SoundType::BACKGROUND_MUSIC:
-        return "background";
-    case Framework::Audio::SoundType::EMPTY:
-        return "Empty";
-    case Framework::Audio::SoundType::SOUND_EFFECT:
-        return "effect";
-    default:
-        return "Unknown";
-    }
+    return std::string(Framework::EnumToString(soundType));
 }
@@ -60,8 +60,8 @@ public:
 
     /**
      * @brief Converts a string representing a sound type to its corresponding enumeration value.
-     * @param soundTypeStr The string representing the sound type (e.g., "music", "sfx").
-     * @return The corresponding SoundType enumeration value.
+     * @param soundTypeStr The string representing the sound type ("background" or "effect").
+     * @return The corresponding SoundType enumeration value, SOUND_EFFECT for unknown strings.
      */
     Framework::Audio::SoundType UE_GetSoundTypeFromString(const std::string& soundTypeStr) const;
     
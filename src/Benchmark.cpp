@@ -0,0 +1,1015 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : Benchmark.cpp
+/// @Brief : Implements the BenchmarkSuite class and the engine's default
+///          microbenchmarks. Every benchmark runs against the shipped Assets
+///          folder, so the suite must be started from the same working
+///          directory as the game (x64/Release) after all systems are
+///          initialized. Console logging is silenced while samples are taken
+///          so that the loaders' debug prints are not part of the timings.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "Benchmark.h"
+#include "AssetManager.h"
+#include "ParticleSystem.h"
+#include "UndoSystem.h"
+#include "Audio.h"
+#include "SpriteBatcher.h"
+#include "TextLayoutCache.h"
+#include "RenderQueue.h"
+#include "TimelineEvaluator.h"
+#include "TimingWheel.h"
+#include "SpatialHash.h"
+#include "CompressedTexture.h"
+#include "TextureImport.h"
+#include "JsonWriter.h"
+#include "VirtualFileSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+namespace Framework
+{
+    BenchmarkSuite GlobalBenchmarkSuite;    // Global instance of the benchmark suite
+
+    namespace
+    {
+        /**
+         * @brief Stream buffer that discards everything written to it.
+         */
+        class NullBuffer : public std::streambuf
+        {
+        protected:
+            int overflow(int c) override { return c; }
+        };
+
+        /**
+         * @brief Redirects std::cout and std::cerr to a null buffer for its lifetime.
+         */
+        class ScopedSilence
+        {
+        public:
+            ScopedSilence() : oldOut(std::cout.rdbuf(&nullBuffer)), oldErr(std::cerr.rdbuf(&nullBuffer)) {}
+            ~ScopedSilence()
+            {
+                std::cout.rdbuf(oldOut);
+                std::cerr.rdbuf(oldErr);
+            }
+
+        private:
+            NullBuffer nullBuffer;
+            std::streambuf* oldOut;
+            std::streambuf* oldErr;
+        };
+
+        // Nearest-rank percentile of an already sorted sample set
+        double Percentile(const std::vector<double>& sorted, double percent)
+        {
+            if (sorted.empty())
+            {
+                return 0.0;
+            }
+            size_t rank = static_cast<size_t>(std::ceil(percent / 100.0 * sorted.size()));
+            rank = std::clamp<size_t>(rank, 1, sorted.size());
+            return sorted[rank - 1];
+        }
+
+        std::string* runningFailure = nullptr;      // Failure message of the benchmark being run
+
+        const std::string dictionaryPath = "Assets/JsonData/DictionaryAsset.json";
+        const std::string prefixesPath = "Assets/JsonData/PrefixesAsset.json";
+        const std::string nsfwPath = "Assets/JsonData/en.json";
+        const std::string defaultBaselinePath = "Assets/JsonData/BenchmarkBaseline.json";
+
+        // Files the benchmarks write go to a temporary directory mounted here, not into Assets
+        const std::string scratchRoot = "Benchmark";
+        const std::string scratchScenePath = "Benchmark/Serialize.json";
+        const std::string scratchPackPath = "Benchmark/Lexicon.uelex";
+        const std::string scratchFloatsPath = "Benchmark/Floats.json";
+
+        std::string ScratchDirectory()
+        {
+            std::error_code error;
+            return (std::filesystem::temp_directory_path(error) / "UnnamedEngineBenchmark").string();
+        }
+    }
+
+    void BenchmarkSuite::Register(const std::string& name, BenchFunction run, Settings settings, BenchFunction setup)
+    {
+        entries.push_back({ name, std::move(run), std::move(setup), settings });
+    }
+
+    void BenchmarkSuite::Check(bool condition, const std::string& message)
+    {
+        if (!condition && runningFailure != nullptr && runningFailure->empty())
+        {
+            *runningFailure = message;
+        }
+    }
+
+    BenchmarkSuite::Result BenchmarkSuite::RunEntry(const Entry& entry)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const int iterations = std::max(1, entry.settings.iterations);
+        const int repetitions = std::max(1, entry.settings.repetitions);
+
+        std::vector<double> samples;
+        samples.reserve(repetitions);
+
+        Result result;
+        runningFailure = &result.failure;
+        {
+            ScopedSilence silence;
+
+            // Warm caches, allocators and lazily loaded assets
+            for (int i = 0; i < entry.settings.warmupRuns; ++i)
+            {
+                if (entry.setup) entry.setup();
+                for (int j = 0; j < iterations; ++j)
+                {
+                    entry.run();
+                }
+            }
+
+            for (int i = 0; i < repetitions; ++i)
+            {
+                if (entry.setup) entry.setup();
+
+                auto start = Clock::now();
+                for (int j = 0; j < iterations; ++j)
+                {
+                    entry.run();
+                }
+                auto end = Clock::now();
+
+                double elapsed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+                samples.push_back(elapsed / iterations);
+            }
+        }
+
+        runningFailure = nullptr;
+        std::sort(samples.begin(), samples.end());
+
+        result.name = entry.name;
+        result.repetitions = repetitions;
+        result.iterations = iterations;
+        result.minNs = samples.front();
+        result.maxNs = samples.back();
+
+        double sum = 0.0;
+        for (double sample : samples)
+        {
+            sum += sample;
+        }
+        result.meanNs = sum / samples.size();
+
+        double variance = 0.0;
+        for (double sample : samples)
+        {
+            variance += (sample - result.meanNs) * (sample - result.meanNs);
+        }
+        result.stddevNs = (samples.size() > 1) ? std::sqrt(variance / (samples.size() - 1)) : 0.0;
+
+        result.p50Ns = Percentile(samples, 50.0);
+        result.p90Ns = Percentile(samples, 90.0);
+        result.p99Ns = Percentile(samples, 99.0);
+        return result;
+    }
+
+    std::vector<BenchmarkSuite::Result> BenchmarkSuite::Run(const std::string& filter)
+    {
+        std::vector<Result> results;
+        for (const Entry& entry : entries)
+        {
+            if (!filter.empty() && entry.name.find(filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            std::cout << "Running benchmark: " << entry.name << std::endl;
+            results.push_back(RunEntry(entry));
+        }
+        return results;
+    }
+
+    void BenchmarkSuite::PrintResults(const std::vector<Result>& results)
+    {
+        std::cout << std::left << std::setw(40) << "Benchmark"
+            << std::right << std::setw(14) << "p50 (us)"
+            << std::setw(14) << "p90 (us)"
+            << std::setw(14) << "p99 (us)"
+            << std::setw(14) << "mean (us)"
+            << std::setw(14) << "stddev (us)" << std::endl;
+
+        for (const Result& result : results)
+        {
+            std::cout << std::left << std::setw(40) << result.name
+                << std::right << std::fixed << std::setprecision(2)
+                << std::setw(14) << result.p50Ns / 1000.0
+                << std::setw(14) << result.p90Ns / 1000.0
+                << std::setw(14) << result.p99Ns / 1000.0
+                << std::setw(14) << result.meanNs / 1000.0
+                << std::setw(14) << result.stddevNs / 1000.0 << std::endl;
+            if (!result.failure.empty())
+            {
+                std::cout << "  FAILED: " << result.failure << std::endl;
+            }
+        }
+        std::cout.unsetf(std::ios::fixed);
+    }
+
+    bool BenchmarkSuite::SaveBaseline(const std::string& filePath, const std::vector<Result>& results)
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
+
+        rapidjson::Value benchmarks(rapidjson::kArrayType);
+        for (const Result& result : results)
+        {
+            rapidjson::Value benchObject(rapidjson::kObjectType);
+            benchObject.AddMember("name", rapidjson::Value(result.name.c_str(), allocator), allocator);
+            benchObject.AddMember("repetitions", result.repetitions, allocator);
+            benchObject.AddMember("iterations", result.iterations, allocator);
+            benchObject.AddMember("minNs", result.minNs, allocator);
+            benchObject.AddMember("meanNs", result.meanNs, allocator);
+            benchObject.AddMember("stddevNs", result.stddevNs, allocator);
+            benchObject.AddMember("p50Ns", result.p50Ns, allocator);
+            benchObject.AddMember("p90Ns", result.p90Ns, allocator);
+            benchObject.AddMember("p99Ns", result.p99Ns, allocator);
+            benchObject.AddMember("maxNs", result.maxNs, allocator);
+            benchmarks.PushBack(benchObject, allocator);
+        }
+        document.AddMember("benchmarks", benchmarks, allocator);
+
+        std::ofstream ofs(filePath);
+        if (!ofs.is_open())
+        {
+            std::cerr << "Error: Unable to open benchmark baseline " << filePath << " for writing." << std::endl;
+            return false;
+        }
+
+        rapidjson::OStreamWrapper osw(ofs);
+        rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(osw);
+        document.Accept(writer);
+
+        std::cout << "Benchmark baseline written to " << filePath << std::endl;
+        return true;
+    }
+
+    int BenchmarkSuite::CompareWithBaseline(const std::string& filePath, const std::vector<Result>& results, double threshold)
+    {
+        std::ifstream ifs(filePath);
+        if (!ifs.is_open())
+        {
+            std::cerr << "Error: Could not open benchmark baseline: " << filePath << std::endl;
+            return -1;
+        }
+
+        rapidjson::IStreamWrapper isw(ifs);
+        rapidjson::Document document;
+        document.ParseStream(isw);
+
+        if (document.HasParseError() || !document.HasMember("benchmarks") || !document["benchmarks"].IsArray())
+        {
+            std::cerr << "Error: Invalid benchmark baseline: " << filePath << std::endl;
+            return -1;
+        }
+
+        std::unordered_map<std::string, double> baselineMedians;
+        for (const auto& bench : document["benchmarks"].GetArray())
+        {
+            if (bench.HasMember("name") && bench["name"].IsString() && bench.HasMember("p50Ns") && bench["p50Ns"].IsNumber())
+            {
+                baselineMedians[bench["name"].GetString()] = bench["p50Ns"].GetDouble();
+            }
+        }
+
+        int regressions = 0;
+        for (const Result& result : results)
+        {
+            auto it = baselineMedians.find(result.name);
+            if (it == baselineMedians.end() || it->second <= 0.0)
+            {
+                std::cout << "[NEW]        " << result.name << std::endl;
+                continue;
+            }
+
+            double ratio = result.p50Ns / it->second;
+            const char* status = "[OK]         ";
+            if (ratio > 1.0 + threshold)
+            {
+                status = "[REGRESSION] ";
+                ++regressions;
+            }
+            else if (ratio < 1.0 - threshold)
+            {
+                status = "[IMPROVED]   ";
+            }
+
+            std::cout << status << result.name << " p50 " << result.p50Ns / 1000.0 << "us vs baseline "
+                << it->second / 1000.0 << "us (" << std::showpos << (ratio - 1.0) * 100.0 << std::noshowpos << "%)" << std::endl;
+        }
+
+        std::cout << regressions << " regression(s) above " << threshold * 100.0 << "% threshold." << std::endl;
+        return regressions;
+    }
+
+    void UE_RegisterDefaultBenchmarks()
+    {
+        // Registering twice would run every benchmark twice
+        static bool registered = false;
+        if (registered)
+        {
+            return;
+        }
+        registered = true;
+
+        BenchmarkSuite& suite = GlobalBenchmarkSuite;
+
+        // Make sure the dictionary is available for the lexicon benchmarks
+        if (!Lexicon::GetInstance())
+        {
+            Lexicon::Initialize(dictionaryPath, prefixesPath, nsfwPath);
+        }
+
+        /****************/
+        //   Lexicon    //
+        /****************/
+
+        suite.Register("Lexicon/TrieInsertDictionary", []()
+            {
+                Trie trie;
+                for (const std::string& word : GlobalAssetManager.GetDictionaryAssets())
+                {
+                    trie.insert(word);
+                }
+            }, { 1, 5, 1 });
+
+        static std::unique_ptr<Trie> startsWithTrie;
+        suite.Register("Lexicon/TrieStartsWith", []()
+            {
+                const auto& words = GlobalAssetManager.GetDictionaryAssets();
+                for (size_t i = 0; i < words.size(); i += 256)
+                {
+                    startsWithTrie->startsWith(words[i].substr(0, 3));
+                }
+            }, {}, []()
+            {
+                // The Lexicon trie is empty while a locale pack serves the words
+                if (!startsWithTrie)
+                {
+                    startsWithTrie = std::make_unique<Trie>();
+                    for (const std::string& word : GlobalAssetManager.GetDictionaryAssets())
+                    {
+                        startsWithTrie->insert(word);
+                    }
+                }
+            });
+
+        suite.Register("Lexicon/CheckUserWord", []()
+            {
+                const auto& words = GlobalAssetManager.GetDictionaryAssets();
+                Lexicon* lexicon = Lexicon::GetInstance();
+                for (size_t i = 0; i < words.size(); i += 2048)
+                {
+                    lexicon->checkUserWord(words[i]);
+                    lexicon->isNsfwWord(words[i]);
+                }
+            });
+
+        suite.Register("Lexicon/GeneratePrefixFromRandomWord", []()
+            {
+                Lexicon::GetInstance()->GeneratePrefixFromRandomWord(2);
+            }, { 1, 10, 1 });
+
+        static std::unique_ptr<Trie> wordListTrie;
+        suite.Register("Lexicon/BuildWordList", []()
+            {
+                wordListTrie->getAllWords();
+            }, { 1, 5, 1 }, []()
+            {
+                wordListTrie = std::make_unique<Trie>();    // Fresh trie so the list is rebuilt every sample
+                for (const std::string& word : GlobalAssetManager.GetDictionaryAssets())
+                {
+                    wordListTrie->insert(word);
+                }
+            });
+
+        suite.Register("Lexicon/BuildPerfectHashIndex", []()
+            {
+                PerfectHashIndex index;
+                index.Build(Lexicon::GetInstance()->GetWords());
+            }, { 1, 5, 1 });
+
+        suite.Register("Lexicon/BuildAnagramIndex", []()
+            {
+                AnagramIndex index;
+                index.Build(Lexicon::GetInstance()->GetWords());
+            }, { 1, 5, 1 });
+
+        suite.Register("Lexicon/FindWordsFromLetters", []()
+            {
+                const AnagramIndex& index = Lexicon::GetInstance()->GetAnagramIndex();
+                index.FindWordsFromLetters("retains");
+                index.FindWordsFromLetters("typingzqe");
+            }, { 2, 20, 10 });
+
+        suite.Register("Lexicon/OpenLocalePack", []()
+            {
+                LexiconPack::Open(GlobalVirtualFileSystem.RealPath(scratchPackPath));
+            }, { 2, 20, 1 }, []()
+            {
+                static bool compiled = false;
+                if (!compiled)
+                {
+                    LexiconPack::Compile({ dictionaryPath, prefixesPath, nsfwPath }, GlobalVirtualFileSystem.WritePath(scratchPackPath));
+                    compiled = true;
+                }
+            });
+
+        suite.Register("Lexicon/CheckPrefixHasMinimumWords", []()
+            {
+                Lexicon* lexicon = Lexicon::GetInstance();
+                for (const std::string& prefix : GlobalAssetManager.GetPrefixAssets())
+                {
+                    lexicon->CheckPrefixHasMinimumWords(prefix, 20);
+                }
+            });
+
+        /*******************/
+        //   JSON Loaders  //
+        /*******************/
+
+        suite.Register("Json/DictionaryAsset", []()
+            {
+                GlobalAssetManager.UE_LoadDictionary(dictionaryPath);
+            }, { 1, 5, 1 });
+
+        suite.Register("Json/TextureAsset", []()
+            {
+                std::unordered_map<std::string, TextureAsset::Texture> textures;
+                TextureAsset::Deserialize("Assets/JsonData/TextureAsset.json", textures);
+            });
+
+        suite.Register("Json/AudioAsset", []()
+            {
+                std::unordered_map<std::string, AudioAsset::MusicAsset> music;
+                AudioAsset::DeserializeAudio("Assets/JsonData/AudioAsset.json", music);
+            });
+
+        suite.Register("Json/AnimationAsset", []()
+            {
+                GlobalEntityAsset.DeserializeAnimation("Assets/JsonData/AnimationAsset.json");
+            });
+
+        suite.Register("Animation/SampleFrames", []()
+            {
+                // One frame lookup per clip at a spread of times, as the animation system does per entity
+                const AnimationClipLibrary& clips = GlobalAssetManager.GetAnimationClips();
+                volatile float sink = 0.0f;
+                for (int step = 0; step < 1000; ++step)
+                {
+                    for (AnimationClipHandle clip = 0; clip < clips.size(); ++clip)
+                    {
+                        sink = sink + clips.Sample(clip, step * 0.013f).offset.x;
+                    }
+                }
+            });
+
+        suite.Register("Json/BulletAsset", []()
+            {
+                GlobalEntityAsset.DeserializeBullet("Assets/JsonData/BulletAsset.json");
+            });
+
+        suite.Register("Json/WindowAsset", []()
+            {
+                Window window("Assets/JsonData/WindowAsset.json");
+            });
+
+        /**********************/
+        //   Scenes / Prefabs  //
+        /**********************/
+
+        const std::vector<std::string> scenes =
+        {
+            "Assets/Scene/MenuScene.json",
+            "Assets/Scene/EasyLevel_Final_Updated.json",
+            "Assets/Scene/BossLevel_Final_Updated.json",
+            "Assets/Scene/extractwarningoverlay.json"
+        };
+
+        for (const std::string& scene : scenes)
+        {
+            std::string sceneName = scene.substr(scene.find_last_of('/') + 1);
+            suite.Register("Scene/Deserialize " + sceneName, [scene]()
+                {
+                    EntityAsset sceneAsset(scene);
+                }, { 2, 20, 1 }, []() { ecsInterface.ClearEntities(); });
+        }
+
+        suite.Register("Scene/Serialize EasyLevel_Final_Updated.json", []()
+            {
+                GlobalEntityAsset.SerializeEntities(scratchScenePath);
+            }, { 2, 20, 1 }, []()
+            {
+                static bool loaded = false;
+                if (!loaded)
+                {
+                    ecsInterface.ClearEntities();
+                    EntityAsset sceneAsset("Assets/Scene/EasyLevel_Final_Updated.json");
+                    loaded = true;
+                }
+            });
+
+        suite.Register("Scene/Serialize compact EasyLevel_Final_Updated.json", []()
+            {
+                GlobalJsonStyle = JsonWriter::Style::Compact;
+                GlobalEntityAsset.SerializeEntities(scratchScenePath);
+                GlobalJsonStyle = JsonWriter::Style::Pretty;
+            }, { 2, 20, 1 }, []()
+            {
+                static bool loaded = false;
+                if (!loaded)
+                {
+                    ecsInterface.ClearEntities();
+                    EntityAsset sceneAsset("Assets/Scene/EasyLevel_Final_Updated.json");
+                    loaded = true;
+                }
+            });
+
+        suite.Register("Prefab/Instance Text Popup Prefab", []()
+            {
+                EntityAsset prefab(AssetManager::UE_GetPrefabPath("Text Popup Prefab.json"), glm::vec2(100.f, 100.f));  // Not from a pool, entities are cleared
+            }, { 3, 30, 10 }, []() { ecsInterface.ClearEntities(); });
+
+        suite.Register("Prefab/Instance enemy sample", []()
+            {
+                EntityAsset prefab(AssetManager::UE_GetPrefabPath("enemy sample.json"), glm::vec2(100.f, 100.f));  // Not from a pool, entities are cleared
+            }, { 3, 30, 10 }, []() { ecsInterface.ClearEntities(); });
+
+        /*******************/
+        //   JSON Numbers  //
+        /*******************/
+
+        // Parsing only, no entities created. The text is copied every run since fast parsing is in place
+        static std::unordered_map<std::string, std::string> sceneTexts;
+        for (const std::string& scene : scenes)
+        {
+            std::string sceneName = scene.substr(scene.find_last_of('/') + 1);
+            auto loadText = [scene]()
+            {
+                if (sceneTexts.find(scene) == sceneTexts.end())
+                {
+                    GlobalVirtualFileSystem.ReadFile(scene, sceneTexts[scene]);
+                }
+            };
+
+            suite.Register("Json/Parse fast " + sceneName, [scene]()
+                {
+                    std::string text = sceneTexts[scene];
+                    rapidjson::Document document;
+                    ParseJson(document, text, JsonFloatPrecision::Fast);
+                }, { 3, 30, 5 }, loadText);
+
+            suite.Register("Json/Parse exact " + sceneName, [scene]()
+                {
+                    std::string text = sceneTexts[scene];
+                    rapidjson::Document document;
+                    ParseJson(document, text, JsonFloatPrecision::Exact);
+                }, { 3, 30, 5 }, loadText);
+
+            // What exact parsing replaces
+            suite.Register("Json/Parse RapidJSON full precision " + sceneName, [scene]()
+                {
+                    std::string text = sceneTexts[scene];
+                    rapidjson::Document document;
+                    document.Parse<rapidjson::kParseFullPrecisionFlag>(text.c_str());
+                }, { 3, 30, 5 }, loadText);
+        }
+
+        // Scene-like values: arbitrary positions and scales, as editor drags leave them
+        static std::vector<float> writeFloats;
+        auto buildWriteFloats = []()
+        {
+            if (writeFloats.empty())
+            {
+                writeFloats.resize(100000);
+                for (size_t i = 0; i < writeFloats.size(); ++i)
+                {
+                    writeFloats[i] = std::sin(static_cast<float>(i)) * 1000.0f;
+                }
+            }
+        };
+
+        suite.Register("Json/Write floats shortest 100k", []()
+            {
+                JsonWriter writer(scratchFloatsPath, JsonWriter::Style::Compact);
+                writer.StartArray();
+                for (float value : writeFloats)
+                {
+                    writer.Value(value);
+                }
+                writer.EndArray();
+                writer.Commit();
+            }, { 2, 20, 1 }, buildWriteFloats);
+
+        // The previous output, each float widened and printed as a double
+        suite.Register("Json/Write floats as double 100k", []()
+            {
+                JsonWriter writer(scratchFloatsPath, JsonWriter::Style::Compact);
+                writer.StartArray();
+                for (float value : writeFloats)
+                {
+                    writer.Value(static_cast<double>(value));
+                }
+                writer.EndArray();
+                writer.Commit();
+            }, { 2, 20, 1 }, buildWriteFloats);
+
+        /*****************/
+        //   Particles   //
+        /*****************/
+
+        suite.Register("Particle/UpdateFullPool", []()
+            {
+                GlobalParticleSystem.UpdateParticles(1.f / 60.f, false);
+            }, { 3, 50, 10 }, []()
+            {
+                for (ParticleComponent& p : GlobalParticleSystem.particles)
+                {
+                    p.active = true;
+                    p.life = 5.0f;
+                    p.position = glm::vec2(0.f, 0.f);
+                    p.velocity = GlobalParticleSystem.randomVelocity(EmissionShape::EXPLOSION);
+                }
+            });
+
+        /*****************/
+        //   Rendering   //
+        /*****************/
+
+        suite.Register("Render/BatchSprites 10000", []()
+            {
+                // Headless batcher: gathering, sorting and command building without GL calls
+                static SpriteBatcher batcher(SpriteBatcher::Mode::CommandList);
+                batcher.Begin();
+                SpriteInstance sprite;
+                for (uint32_t i = 0; i < 10000; ++i)
+                {
+                    sprite.position = glm::vec2(static_cast<float>(i % 160) * 10.f, static_cast<float>(i / 160) * 10.f);
+                    batcher.Submit(sprite, i % 5, static_cast<int32_t>((i * 7919u) % 64) - 32, 1 + (i * 31u) % 24);
+                }
+                batcher.Build();
+            });
+
+        suite.Register("Render/QueueHandoff 100 frames", []()
+            {
+                // Headless render thread: checks the buffering protocol as well as timing the hand-off
+                constexpr uint64_t frameCount = 100;
+                RenderQueue queue;
+                std::vector<uint64_t> drawn;            // Render thread only until Stop()
+                bool contentMatches = true;
+                bool releasedEarly = false;
+                bool tasksOffThread = false;
+                queue.Start([&drawn, &contentMatches](const FrameCommands& frame)
+                    {
+                        // Every frame carries as many sprites as its number, so a reused slot shows up
+                        contentMatches &= frame.sprites.size() == frame.frameNumber;
+                        drawn.push_back(frame.frameNumber);
+                        if (frame.frameNumber % 10 == 0)
+                        {
+                            std::this_thread::sleep_for(std::chrono::microseconds(200));   // Make simulation wait
+                        }
+                    });
+
+                bool aheadTooFar = false;
+                for (uint64_t i = 1; i <= frameCount; ++i)
+                {
+                    FrameCommands& frame = queue.BeginFrame();
+                    aheadTooFar |= queue.GetPublishedFrames() > queue.GetRenderedFrames() + 1;
+                    frame.sprites.resize(i);
+                    if (i % 10 == 0)
+                    {
+                        queue.Execute([&queue, &tasksOffThread]() { tasksOffThread |= !queue.IsRenderThread(); });
+                    }
+                    queue.ReleaseAfterFrame([&drawn, &releasedEarly, i]() { releasedEarly |= drawn.size() < i; });
+                    queue.Publish();
+                }
+                queue.Stop();
+
+                bool inOrder = drawn.size() == frameCount;
+                for (size_t i = 0; inOrder && i < drawn.size(); ++i)
+                {
+                    inOrder = drawn[i] == i + 1;
+                }
+                BenchmarkSuite::Check(inOrder, "Render queue dropped or reordered frames");
+                BenchmarkSuite::Check(contentMatches, "Render thread drew a frame slot that was being refilled");
+                BenchmarkSuite::Check(!aheadTooFar, "Simulation got more than one frame ahead of the render thread");
+                BenchmarkSuite::Check(!releasedEarly, "Deferred release ran before its frame was drawn");
+                BenchmarkSuite::Check(!tasksOffThread, "Execute() ran a task off the render thread");
+            }, { 2, 20, 1 });
+
+        suite.Register("Text/LayoutTypingField", []()
+            {
+                // A typed word growing and being erased, as the typing field does every keystroke
+                const auto& fonts = GlobalAssetManager.GetFontCacheAssets();
+                if (fonts.empty())
+                {
+                    return;
+                }
+                const std::string word = "extraordinarily";
+                for (size_t length = 0; length <= word.size(); ++length)
+                {
+                    GlobalTextLayoutCache.Get(0, word.substr(0, length), fonts.begin()->first, 1.0f);
+                }
+                for (size_t length = word.size(); length-- > 0;)
+                {
+                    GlobalTextLayoutCache.Get(0, word.substr(0, length), fonts.begin()->first, 1.0f);
+                }
+            }, { 3, 50, 10 }, []() { GlobalTextLayoutCache.Clear(); });
+
+        static TimelineEvaluator timelineEvaluator;
+        suite.Register("Timeline/Evaluate 10000 tracks", []()
+            {
+                // Evaluation only: the component writes cost the same as with callbacks
+                timelineEvaluator.Advance(1.0f / 60.0f);
+            }, { 3, 50, 10 }, []()
+            {
+                static const Easing easings[] = { Easing::Linear, Easing::OutQuad, Easing::OutBack, Easing::OutElastic };
+                timelineEvaluator.Clear();
+                for (Entity entity = 0; entity < 10000; ++entity)
+                {
+                    TimelineCurve curve;
+                    curve.channel = TimelineChannel::PositionX;
+                    curve.easing = easings[entity % 4];
+                    curve.from = 0.0f;
+                    curve.to = 100.0f;
+                    timelineEvaluator.Play(entity, curve, 1000.0f);
+                }
+            });
+
+        static TimingWheel timerWheel;
+        suite.Register("Timers/Step 10000 timers", []()
+            {
+                // One second of fixed steps; only the spawners due on a step are touched
+                std::vector<TimerEvent> due;
+                for (int step = 0; step < 60; ++step)
+                {
+                    timerWheel.Step(due);
+                    due.clear();
+                }
+            }, { 3, 50, 10 }, []()
+            {
+                timerWheel.Clear();
+                for (Entity entity = 0; entity < 10000; ++entity)
+                {
+                    timerWheel.Schedule(entity, TimerKind::Spawn, 0.5f + static_cast<float>(entity % 300) * 0.1f, 2.0f + static_cast<float>(entity % 7));
+                }
+            });
+
+        /*****************/
+        //   Collision   //
+        /*****************/
+
+        // Boss phase stress scene: bullets streaming up through a field of minions
+        struct StressCollider { glm::vec2 position; glm::vec2 velocity; };
+        static std::vector<StressCollider> stressBullets;
+        static std::vector<StressCollider> stressMinions;
+        static const auto buildStressScene = []()
+            {
+                stressBullets.clear();
+                stressMinions.clear();
+                uint32_t seed = 12345u;
+                const auto next = [&seed]() { seed = seed * 1664525u + 1013904223u; return static_cast<float>(seed >> 8) / 16777216.0f; };
+                for (int i = 0; i < 500; ++i)
+                {
+                    stressMinions.push_back({ glm::vec2(next() * 1920.f, 400.f + next() * 680.f), glm::vec2(next() * 40.f - 20.f, -30.f) });
+                }
+                for (int i = 0; i < 2000; ++i)
+                {
+                    stressBullets.push_back({ glm::vec2(next() * 1920.f, next() * 1080.f), glm::vec2(0.f, 900.f) });
+                }
+            };
+
+        suite.Register("Collision/SpatialHash 2000 bullets vs 500 minions", []()
+            {
+                static SpatialHash grid;
+                static std::vector<SpatialHash::EntityPair> pairs;
+                const float dt = 1.0f / 60.0f;
+                for (size_t i = 0; i < stressMinions.size(); ++i)
+                {
+                    stressMinions[i].position += stressMinions[i].velocity * dt;
+                    grid.Insert(static_cast<Entity>(i), Enemy, stressMinions[i].position, glm::vec2(50.f));
+                }
+                for (size_t i = 0; i < stressBullets.size(); ++i)
+                {
+                    stressBullets[i].position.y = std::fmod(stressBullets[i].position.y + stressBullets[i].velocity.y * dt, 1080.f);
+                    grid.Insert(static_cast<Entity>(stressMinions.size() + i), Bullet, stressBullets[i].position, glm::vec2(8.f));
+                }
+                pairs.clear();
+                grid.QueryPairs(CollisionMask(Bullet), CollisionMask(Enemy), pairs);
+            }, { 3, 50, 10 }, []()
+            {
+                buildStressScene();
+
+                // The grid must find exactly the pairs the all-pairs test finds
+                SpatialHash grid;
+                std::vector<SpatialHash::EntityPair> gridPairs;
+                std::vector<SpatialHash::EntityPair> allPairs;
+                const Entity firstBullet = static_cast<Entity>(stressMinions.size());
+                for (size_t m = 0; m < stressMinions.size(); ++m)
+                {
+                    grid.Insert(static_cast<Entity>(m), Enemy, stressMinions[m].position, glm::vec2(50.f));
+                }
+                for (size_t b = 0; b < stressBullets.size(); ++b)
+                {
+                    grid.Insert(firstBullet + static_cast<Entity>(b), Bullet, stressBullets[b].position, glm::vec2(8.f));
+                    for (size_t m = 0; m < stressMinions.size(); ++m)
+                    {
+                        const glm::vec2 d = stressBullets[b].position - stressMinions[m].position;
+                        if (std::abs(d.x) <= 58.f && std::abs(d.y) <= 58.f)
+                        {
+                            allPairs.emplace_back(firstBullet + static_cast<Entity>(b), static_cast<Entity>(m));
+                        }
+                    }
+                }
+                grid.QueryPairs(CollisionMask(Bullet), CollisionMask(Enemy), gridPairs);
+                std::sort(gridPairs.begin(), gridPairs.end());
+                std::sort(allPairs.begin(), allPairs.end());
+                BenchmarkSuite::Check(gridPairs == allPairs, "Spatial hash pairs differ from the all-pairs result");
+            });
+
+        suite.Register("Collision/AllPairs 2000 bullets vs 500 minions", []()
+            {
+                // Reference: what every bullet against every minion costs without a broad phase
+                static std::vector<SpatialHash::EntityPair> pairs;
+                const float dt = 1.0f / 60.0f;
+                for (auto& minion : stressMinions)
+                {
+                    minion.position += minion.velocity * dt;
+                }
+                for (auto& bullet : stressBullets)
+                {
+                    bullet.position.y = std::fmod(bullet.position.y + bullet.velocity.y * dt, 1080.f);
+                }
+                pairs.clear();
+                for (size_t b = 0; b < stressBullets.size(); ++b)
+                {
+                    for (size_t m = 0; m < stressMinions.size(); ++m)
+                    {
+                        const glm::vec2 d = stressBullets[b].position - stressMinions[m].position;
+                        if (std::abs(d.x) <= 58.f && std::abs(d.y) <= 58.f)
+                        {
+                            pairs.emplace_back(static_cast<Entity>(b), static_cast<Entity>(m));
+                        }
+                    }
+                }
+            }, { 3, 20, 1 }, []() { buildStressScene(); });
+
+        /***************/
+        //   Texture   //
+        /***************/
+
+        // Sprite-like test image: soft gradients with a feathered alpha edge
+        static std::vector<uint8_t> encodeImage;
+        static const auto buildEncodeImage = []()
+            {
+                encodeImage.resize(256 * 256 * 4);
+                for (uint32_t y = 0; y < 256; ++y)
+                {
+                    for (uint32_t x = 0; x < 256; ++x)
+                    {
+                        uint8_t* pixel = &encodeImage[(y * 256 + x) * 4];
+                        const float distance = std::hypot(static_cast<float>(x) - 128.f, static_cast<float>(y) - 128.f);
+                        pixel[0] = static_cast<uint8_t>(x);
+                        pixel[1] = static_cast<uint8_t>(y);
+                        pixel[2] = static_cast<uint8_t>((x * y) >> 8);
+                        pixel[3] = static_cast<uint8_t>(std::clamp((120.f - distance) * 16.f, 0.f, 255.f));
+                    }
+                }
+            };
+
+        suite.Register("Texture/Normalize 256x256", []()
+            {
+                static std::vector<uint8_t> pixels;
+                pixels = encodeImage;
+                // The batched sprite layout; the default straight linear layout is a no-op
+                TextureImport::Normalize(pixels.data(), pixels.size() / 4, TextureLayout{ true, true });
+            }, { 3, 50, 10 }, []() { buildEncodeImage(); });
+
+        suite.Register("Texture/EncodeBC1 256x256", []()
+            {
+                CompressedTexture::EncodeLevel(encodeImage.data(), 256, 256, TextureCodec::BC1);
+            }, { 1, 10, 1 }, []() { buildEncodeImage(); });
+
+        suite.Register("Texture/EncodeBC7 256x256", []()
+            {
+                CompressedTexture::EncodeLevel(encodeImage.data(), 256, 256, TextureCodec::BC7);
+            }, { 1, 10, 1 }, []() { buildEncodeImage(); });
+
+        /*************/
+        //   Audio   //
+        /*************/
+
+        suite.Register("Audio/PlayAndCleanupVoices", []()
+            {
+                for (int i = 0; i < 32; ++i)
+                {
+                    GlobalAudio.UE_PlaySound("Ding1_SFX", true);
+                }
+                GlobalAudio.Update(0.f);
+                GlobalAudio.UE_CleanupDeadChannels();
+            }, { 3, 30, 1 }, []()
+            {
+                GlobalAudio.UE_Reset();
+            });
+
+        /*****************/
+        //   Undo/Redo   //
+        /*****************/
+
+        suite.Register("Undo/PushUndoRedo", []()
+            {
+                static float value = 0.f;
+                UndoRedoManager manager;
+                for (int i = 0; i < 1000; ++i)
+                {
+                    float prev = value;
+                    value = static_cast<float>(i);
+                    manager.PushUndo(0, "TransformComponent", "rotation", value, prev, value);
+                }
+                while (manager.CanUndo()) manager.Undo();
+                while (manager.CanRedo()) manager.Redo();
+            }, { 3, 30, 1 });
+    }
+
+    int UE_RunBenchmarks(int argc, char* argv[])
+    {
+        std::string filter;
+        std::string savePath;
+        std::string comparePath;
+        double threshold = 0.10;
+
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg.rfind("--bench-filter=", 0) == 0)
+                filter = arg.substr(15);
+            else if (arg.rfind("--bench-save=", 0) == 0)
+                savePath = arg.substr(13);
+            else if (arg == "--bench-save")
+                savePath = defaultBaselinePath;
+            else if (arg.rfind("--bench-compare=", 0) == 0)
+                comparePath = arg.substr(16);
+            else if (arg == "--bench-compare")
+                comparePath = defaultBaselinePath;
+            else if (arg.rfind("--bench-threshold=", 0) == 0)
+                threshold = std::stod(arg.substr(18));
+        }
+
+        GlobalAudio.UE_MuteAllAudio(true);     // Voice benchmarks should not be audible
+        const std::string scratchDirectory = ScratchDirectory();
+        std::error_code error;
+        std::filesystem::create_directories(scratchDirectory, error);
+        GlobalVirtualFileSystem.MountDirectory(scratchRoot, scratchDirectory, 1000, true);
+        UE_RegisterDefaultBenchmarks();
+
+        std::vector<BenchmarkSuite::Result> results = GlobalBenchmarkSuite.Run(filter);
+        BenchmarkSuite::PrintResults(results);
+
+        // Leave the engine in an empty state, benchmarks load scenes and prefabs
+        ecsInterface.ClearEntities();
+        GlobalAudio.UE_Reset();
+        GlobalAudio.UE_MuteAllAudio(false);
+        for (const std::string& file : GlobalVirtualFileSystem.List(scratchRoot))
+        {
+            GlobalVirtualFileSystem.Remove(file);
+        }
+        GlobalVirtualFileSystem.Unmount(scratchDirectory);
+        std::filesystem::remove_all(scratchDirectory, error);   // Temp files an aborted write left behind
+
+        if (!savePath.empty())
+        {
+            BenchmarkSuite::SaveBaseline(savePath, results);
+        }
+
+        const bool failed = std::any_of(results.begin(), results.end(), [](const BenchmarkSuite::Result& result) { return !result.failure.empty(); });
+        if (!comparePath.empty())
+        {
+            int regressions = BenchmarkSuite::CompareWithBaseline(comparePath, results, threshold);
+            return (regressions != 0 || failed) ? 1 : 0;
+        }
+        return failed ? 1 : 0;
+    }
+}
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : Benchmark.h
+/// @Brief : Declares the BenchmarkSuite class, a small microbenchmark harness
+///          used to time engine hot paths (lexicon, JSON loaders, scene and
+///          prefab deserialization, particles, audio and undo/redo) against
+///          the shipped Assets data. Each benchmark is warmed up, repeated and
+///          summarised with percentiles, and results can be saved to or
+///          compared against a baseline JSON file to flag regressions.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+#include "pch.h"
+#include "JsonSerialize.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @class BenchmarkSuite
+     * @brief Registers, runs and reports microbenchmarks. Nothing runs them on
+     *        its own: call UE_RunBenchmarks() with the command line once all
+     *        systems have been initialized.
+     */
+    class BenchmarkSuite
+    {
+    public:
+        using BenchFunction = std::function<void()>;
+
+        /**
+         * @struct Settings
+         * @brief Timing parameters for a single benchmark.
+         */
+        struct Settings
+        {
+            int warmupRuns = 3;         // Untimed runs before sampling
+            int repetitions = 30;       // Number of timed samples
+            int iterations = 1;         // Calls to the benchmark body per sample
+        };
+
+        /**
+         * @struct Result
+         * @brief Summary statistics of one benchmark, in nanoseconds per iteration.
+         */
+        struct Result
+        {
+            std::string name;
+            int repetitions = 0;
+            int iterations = 0;
+            double minNs = 0.0;
+            double meanNs = 0.0;
+            double stddevNs = 0.0;
+            double p50Ns = 0.0;
+            double p90Ns = 0.0;
+            double p99Ns = 0.0;
+            double maxNs = 0.0;
+            std::string failure;        // Message of the first failed Check(), empty if none failed
+        };
+
+        /**
+         * @brief Registers a benchmark.
+         * @param name Unique name, grouped by prefix (e.g. "Lexicon/Insert").
+         * @param run Body being timed.
+         * @param settings Warmup/repetition counts for this benchmark.
+         * @param setup Optional untimed callback invoked before every sample.
+         */
+        void Register(const std::string& name, BenchFunction run, Settings settings = Settings(), BenchFunction setup = nullptr);
+
+        /**
+         * @brief Fails the running benchmark when the condition is false. Its timings are still
+         *        reported; UE_RunBenchmarks() returns 1. Call from the thread running the body.
+         */
+        static void Check(bool condition, const std::string& message);
+
+        /**
+         * @brief Runs every registered benchmark whose name contains the filter.
+         * @param filter Substring filter, empty to run everything.
+         * @return Results in registration order.
+         */
+        std::vector<Result> Run(const std::string& filter = "");
+
+        /**
+         * @brief Prints a result table to the console.
+         */
+        static void PrintResults(const std::vector<Result>& results);
+
+        /**
+         * @brief Writes results to a baseline JSON file.
+         * @return True if the file was written.
+         */
+        static bool SaveBaseline(const std::string& filePath, const std::vector<Result>& results);
+
+        /**
+         * @brief Compares results against a baseline JSON file. A benchmark regresses
+         *        when its median exceeds the baseline median by more than the threshold.
+         * @param threshold Allowed relative slowdown (0.10 = 10%).
+         * @return Number of regressed benchmarks, or -1 if the baseline could not be read.
+         */
+        static int CompareWithBaseline(const std::string& filePath, const std::vector<Result>& results, double threshold);
+
+    private:
+        struct Entry
+        {
+            std::string name;
+            BenchFunction run;
+            BenchFunction setup;
+            Settings settings;
+        };
+
+        Result RunEntry(const Entry& entry);
+
+        std::vector<Entry> entries;
+    };
+
+    /**
+     * @brief Registers the engine's default benchmarks on the global suite. Later calls do nothing.
+     */
+    void UE_RegisterDefaultBenchmarks();
+
+    /**
+     * @brief Registers (once) and runs the default benchmarks. Scratch files go to a
+     *        temporary directory and are removed afterwards. Options: --bench-filter=<text>, --bench-save=<file>,
+     *        --bench-compare=<file>, --bench-threshold=<ratio>.
+     * @return 0 on success, 1 if any benchmark failed a check or regressed against the baseline.
+     */
+    int UE_RunBenchmarks(int argc, char* argv[]);
+
+    extern BenchmarkSuite GlobalBenchmarkSuite;
+}
+#endif // !_BENCHMARK_H_
@@ -0,0 +1,639 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : BlockCompression.cpp
+/// @Brief : Implements BC1, BC3 and BC7 (mode 6) block encoding and decoding.
+///          Endpoints start at the extremes of the block along its principal
+///          colour axis and are refined by least squares against the chosen
+///          indices, keeping whichever pass has the lowest error.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "BlockCompression.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Framework
+{
+    namespace BlockCompression
+    {
+        namespace
+        {
+            constexpr int RefinePasses = 2;
+
+            // Direction of greatest variance of the block, by power iteration on its covariance
+            template <int N>
+            void PrincipalAxis(const float (&pixels)[BlockPixels][4], float (&mean)[4], float (&axis)[4])
+            {
+                float covariance[N][N] = {};
+                for (int c = 0; c < N; ++c)
+                {
+                    mean[c] = 0.0f;
+                    for (int i = 0; i < BlockPixels; ++i)
+                    {
+                        mean[c] += pixels[i][c];
+                    }
+                    mean[c] /= BlockPixels;
+                }
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    for (int a = 0; a < N; ++a)
+                    {
+                        for (int b = 0; b < N; ++b)
+                        {
+                            covariance[a][b] += (pixels[i][a] - mean[a]) * (pixels[i][b] - mean[b]);
+                        }
+                    }
+                }
+
+                // Start from the covariance row of the most varying channel, never orthogonal to the answer
+                int widest = 0;
+                for (int c = 1; c < N; ++c)
+                {
+                    widest = covariance[c][c] > covariance[widest][widest] ? c : widest;
+                }
+                for (int c = 0; c < N; ++c)
+                {
+                    axis[c] = covariance[widest][c];
+                }
+                for (int iteration = 0; iteration < 8; ++iteration)
+                {
+                    float next[N] = {};
+                    float length = 0.0f;
+                    for (int a = 0; a < N; ++a)
+                    {
+                        for (int b = 0; b < N; ++b)
+                        {
+                            next[a] += covariance[a][b] * axis[b];
+                        }
+                        length = std::max(length, std::abs(next[a]));
+                    }
+                    if (length < 1e-6f)
+                    {
+                        break;  // Flat block, any axis will do
+                    }
+                    for (int c = 0; c < N; ++c)
+                    {
+                        axis[c] = next[c] / length;
+                    }
+                }
+            }
+
+            // Endpoints at the block's extremes along the axis
+            template <int N>
+            void AxisEndpoints(const float (&pixels)[BlockPixels][4], const float (&mean)[4], const float (&axis)[4],
+                float (&high)[4], float (&low)[4])
+            {
+                float lengthSquared = 0.0f;
+                for (int c = 0; c < N; ++c)
+                {
+                    lengthSquared += axis[c] * axis[c];
+                }
+
+                float minProjection = 0.0f, maxProjection = 0.0f;
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    float projection = 0.0f;
+                    for (int c = 0; c < N; ++c)
+                    {
+                        projection += (pixels[i][c] - mean[c]) * axis[c];
+                    }
+                    minProjection = std::min(minProjection, projection);
+                    maxProjection = std::max(maxProjection, projection);
+                }
+
+                const float scale = lengthSquared > 0.0f ? 1.0f / lengthSquared : 0.0f;
+                for (int c = 0; c < N; ++c)
+                {
+                    high[c] = std::clamp(mean[c] + axis[c] * maxProjection * scale, 0.0f, 255.0f);
+                    low[c] = std::clamp(mean[c] + axis[c] * minProjection * scale, 0.0f, 255.0f);
+                }
+            }
+
+            // Least squares endpoints for fixed interpolation weights (weight of the first endpoint per pixel)
+            template <int N>
+            bool SolveEndpoints(const float (&pixels)[BlockPixels][4], const float (&weights)[BlockPixels], float (&first)[4], float (&second)[4])
+            {
+                float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+                float ax[4] = {}, bx[4] = {};
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    const float a = weights[i];
+                    const float b = 1.0f - a;
+                    aa += a * a;
+                    ab += a * b;
+                    bb += b * b;
+                    for (int c = 0; c < N; ++c)
+                    {
+                        ax[c] += a * pixels[i][c];
+                        bx[c] += b * pixels[i][c];
+                    }
+                }
+
+                const float determinant = aa * bb - ab * ab;
+                if (std::abs(determinant) < 1e-6f)
+                {
+                    return false;
+                }
+                for (int c = 0; c < N; ++c)
+                {
+                    first[c] = std::clamp((ax[c] * bb - bx[c] * ab) / determinant, 0.0f, 255.0f);
+                    second[c] = std::clamp((bx[c] * aa - ax[c] * ab) / determinant, 0.0f, 255.0f);
+                }
+                return true;
+            }
+
+            void LoadPixels(const uint8_t* rgba, float (&pixels)[BlockPixels][4])
+            {
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    for (int c = 0; c < 4; ++c)
+                    {
+                        pixels[i][c] = rgba[i * 4 + c];
+                    }
+                }
+            }
+
+            /*******************/
+            //   BC1 colour    //
+            /*******************/
+
+            uint16_t To565(const float (&color)[4])
+            {
+                const int r = static_cast<int>(color[0] * 31.0f / 255.0f + 0.5f);
+                const int g = static_cast<int>(color[1] * 63.0f / 255.0f + 0.5f);
+                const int b = static_cast<int>(color[2] * 31.0f / 255.0f + 0.5f);
+                return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+            }
+
+            void From565(uint16_t packed, int (&color)[3])
+            {
+                const int r = (packed >> 11) & 31, g = (packed >> 5) & 63, b = packed & 31;
+                color[0] = (r << 3) | (r >> 2);
+                color[1] = (g << 2) | (g >> 4);
+                color[2] = (b << 3) | (b >> 2);
+            }
+
+            void ColorPalette(uint16_t c0, uint16_t c1, int (&palette)[4][3])
+            {
+                From565(c0, palette[0]);
+                From565(c1, palette[1]);
+                for (int c = 0; c < 3; ++c)
+                {
+                    if (c0 > c1)
+                    {
+                        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+                    }
+                    else
+                    {
+                        palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+                        palette[3][c] = 0;  // Transparent black in three colour mode
+                    }
+                }
+            }
+
+            // Picks the nearest palette entry per pixel, returns the total squared error
+            int ColorIndices(const float (&pixels)[BlockPixels][4], const int (&palette)[4][3], uint8_t (&indices)[BlockPixels])
+            {
+                int total = 0;
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    int bestError = INT32_MAX;
+                    for (int p = 0; p < 4; ++p)
+                    {
+                        int error = 0;
+                        for (int c = 0; c < 3; ++c)
+                        {
+                            const int d = static_cast<int>(pixels[i][c]) - palette[p][c];
+                            error += d * d;
+                        }
+                        if (error < bestError)
+                        {
+                            bestError = error;
+                            indices[i] = static_cast<uint8_t>(p);
+                        }
+                    }
+                    total += bestError;
+                }
+                return total;
+            }
+
+            void EncodeColorBlock(const float (&pixels)[BlockPixels][4], uint8_t* out)
+            {
+                float mean[4], axis[4], high[4], low[4];
+                PrincipalAxis<3>(pixels, mean, axis);
+                AxisEndpoints<3>(pixels, mean, axis, high, low);
+
+                uint16_t bestC0 = 0, bestC1 = 0;
+                uint8_t bestIndices[BlockPixels] = {};
+                int bestError = INT32_MAX;
+
+                for (int pass = 0; pass <= RefinePasses; ++pass)
+                {
+                    uint16_t c0 = To565(high), c1 = To565(low);
+                    if (c0 < c1)
+                    {
+                        std::swap(c0, c1);
+                        std::swap(high, low);
+                    }
+
+                    uint8_t indices[BlockPixels] = {};
+                    int error;
+                    if (c0 == c1)
+                    {
+                        // One colour: three colour mode, every pixel on the first endpoint
+                        int palette[4][3];
+                        ColorPalette(c0, c1, palette);
+                        error = 0;
+                        for (int i = 0; i < BlockPixels; ++i)
+                        {
+                            for (int c = 0; c < 3; ++c)
+                            {
+                                const int d = static_cast<int>(pixels[i][c]) - palette[0][c];
+                                error += d * d;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        int palette[4][3];
+                        ColorPalette(c0, c1, palette);
+                        error = ColorIndices(pixels, palette, indices);
+                    }
+
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        bestC0 = c0;
+                        bestC1 = c1;
+                        std::copy_n(indices, BlockPixels, bestIndices);
+                    }
+                    if (error == 0 || c0 == c1)
+                    {
+                        break;
+                    }
+
+                    static constexpr float IndexWeights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+                    float weights[BlockPixels];
+                    for (int i = 0; i < BlockPixels; ++i)
+                    {
+                        weights[i] = IndexWeights[indices[i]];
+                    }
+                    if (!SolveEndpoints<3>(pixels, weights, high, low))
+                    {
+                        break;
+                    }
+                }
+
+                out[0] = static_cast<uint8_t>(bestC0);
+                out[1] = static_cast<uint8_t>(bestC0 >> 8);
+                out[2] = static_cast<uint8_t>(bestC1);
+                out[3] = static_cast<uint8_t>(bestC1 >> 8);
+                uint32_t bits = 0;
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    bits |= static_cast<uint32_t>(bestIndices[i]) << (i * 2);
+                }
+                std::memcpy(out + 4, &bits, sizeof(bits));
+            }
+
+            void DecodeColorBlock(const uint8_t* block, uint8_t* rgba)
+            {
+                const uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+                const uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+                uint32_t bits;
+                std::memcpy(&bits, block + 4, sizeof(bits));
+
+                int palette[4][3];
+                ColorPalette(c0, c1, palette);
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    const int index = (bits >> (i * 2)) & 3;
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        rgba[i * 4 + c] = static_cast<uint8_t>(palette[index][c]);
+                    }
+                    rgba[i * 4 + 3] = (c0 <= c1 && index == 3) ? 0 : 255;
+                }
+            }
+
+            /*******************/
+            //   BC3 alpha     //
+            /*******************/
+
+            void AlphaPalette(uint8_t a0, uint8_t a1, int (&palette)[8])
+            {
+                palette[0] = a0;
+                palette[1] = a1;
+                if (a0 > a1)
+                {
+                    for (int i = 1; i < 7; ++i)
+                    {
+                        palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+                    }
+                }
+                else
+                {
+                    for (int i = 1; i < 5; ++i)
+                    {
+                        palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+                    }
+                    palette[6] = 0;
+                    palette[7] = 255;
+                }
+            }
+
+            void EncodeAlphaBlock(const uint8_t* rgba, uint8_t* out)
+            {
+                uint8_t high = 0, low = 255;
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    high = std::max(high, rgba[i * 4 + 3]);
+                    low = std::min(low, rgba[i * 4 + 3]);
+                }
+
+                int palette[8];
+                AlphaPalette(high, low, palette);
+                uint64_t bits = 0;
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    int best = 0, bestError = INT32_MAX;
+                    for (int p = 0; p < 8; ++p)
+                    {
+                        const int error = std::abs(rgba[i * 4 + 3] - palette[p]);
+                        if (error < bestError)
+                        {
+                            bestError = error;
+                            best = p;
+                        }
+                    }
+                    bits |= static_cast<uint64_t>(best) << (i * 3);
+                }
+
+                out[0] = high;
+                out[1] = low;
+                for (int b = 0; b < 6; ++b)
+                {
+                    out[2 + b] = static_cast<uint8_t>(bits >> (b * 8));
+                }
+            }
+
+            void DecodeAlphaBlock(const uint8_t* block, uint8_t* rgba)
+            {
+                int palette[8];
+                AlphaPalette(block[0], block[1], palette);
+                uint64_t bits = 0;
+                for (int b = 0; b < 6; ++b)
+                {
+                    bits |= static_cast<uint64_t>(block[2 + b]) << (b * 8);
+                }
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    rgba[i * 4 + 3] = static_cast<uint8_t>(palette[(bits >> (i * 3)) & 7]);
+                }
+            }
+
+            /*******************/
+            //   BC7 mode 6    //
+            /*******************/
+
+            constexpr int Mode6Weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+            // Writes value into the block, least significant bit first
+            class BitWriter
+            {
+            public:
+                explicit BitWriter(uint8_t* out) : bytes(out) { std::memset(bytes, 0, BC7BlockBytes); }
+                void Write(uint32_t value, int count)
+                {
+                    for (int i = 0; i < count; ++i, ++position)
+                    {
+                        bytes[position >> 3] |= static_cast<uint8_t>(((value >> i) & 1) << (position & 7));
+                    }
+                }
+            private:
+                uint8_t* bytes;
+                int position = 0;
+            };
+
+            class BitReader
+            {
+            public:
+                explicit BitReader(const uint8_t* in) : bytes(in) {}
+                uint32_t Read(int count)
+                {
+                    uint32_t value = 0;
+                    for (int i = 0; i < count; ++i, ++position)
+                    {
+                        value |= static_cast<uint32_t>((bytes[position >> 3] >> (position & 7)) & 1) << i;
+                    }
+                    return value;
+                }
+            private:
+                const uint8_t* bytes;
+                int position = 0;
+            };
+
+            struct Mode6Endpoint
+            {
+                int value[4];   // 7 bit channels
+                int pBit;
+            };
+
+            // 7 bit channels plus a p-bit shared by the channels, whichever p-bit fits better
+            Mode6Endpoint QuantizeMode6(const float (&color)[4])
+            {
+                Mode6Endpoint best{};
+                float bestError = -1.0f;
+                for (int p = 0; p < 2; ++p)
+                {
+                    Mode6Endpoint candidate{};
+                    candidate.pBit = p;
+                    float error = 0.0f;
+                    for (int c = 0; c < 4; ++c)
+                    {
+                        candidate.value[c] = std::clamp(static_cast<int>((color[c] - p) / 2.0f + 0.5f), 0, 127);
+                        const float d = color[c] - static_cast<float>((candidate.value[c] << 1) | p);
+                        error += d * d;
+                    }
+                    if (bestError < 0.0f || error < bestError)
+                    {
+                        bestError = error;
+                        best = candidate;
+                    }
+                }
+                return best;
+            }
+
+            void Mode6Palette(const Mode6Endpoint& e0, const Mode6Endpoint& e1, int (&palette)[16][4])
+            {
+                for (int c = 0; c < 4; ++c)
+                {
+                    const int a = (e0.value[c] << 1) | e0.pBit;
+                    const int b = (e1.value[c] << 1) | e1.pBit;
+                    for (int i = 0; i < 16; ++i)
+                    {
+                        palette[i][c] = ((64 - Mode6Weights[i]) * a + Mode6Weights[i] * b + 32) >> 6;
+                    }
+                }
+            }
+
+            int Mode6Indices(const float (&pixels)[BlockPixels][4], const int (&palette)[16][4], uint8_t (&indices)[BlockPixels])
+            {
+                int total = 0;
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    int bestError = INT32_MAX;
+                    for (int p = 0; p < 16; ++p)
+                    {
+                        int error = 0;
+                        for (int c = 0; c < 4; ++c)
+                        {
+                            const int d = static_cast<int>(pixels[i][c]) - palette[p][c];
+                            error += d * d;
+                        }
+                        if (error < bestError)
+                        {
+                            bestError = error;
+                            indices[i] = static_cast<uint8_t>(p);
+                        }
+                    }
+                    total += bestError;
+                }
+                return total;
+            }
+        }
+
+        void EncodeBC1(const uint8_t rgba[BlockPixels * 4], uint8_t out[BC1BlockBytes])
+        {
+            float pixels[BlockPixels][4];
+            LoadPixels(rgba, pixels);
+            EncodeColorBlock(pixels, out);
+        }
+
+        void EncodeBC3(const uint8_t rgba[BlockPixels * 4], uint8_t out[BC3BlockBytes])
+        {
+            float pixels[BlockPixels][4];
+            LoadPixels(rgba, pixels);
+            EncodeAlphaBlock(rgba, out);
+            EncodeColorBlock(pixels, out + 8);
+        }
+
+        void EncodeBC7(const uint8_t rgba[BlockPixels * 4], uint8_t out[BC7BlockBytes])
+        {
+            float pixels[BlockPixels][4];
+            LoadPixels(rgba, pixels);
+
+            float mean[4], axis[4], first[4], second[4];
+            PrincipalAxis<4>(pixels, mean, axis);
+            AxisEndpoints<4>(pixels, mean, axis, first, second);
+
+            Mode6Endpoint best0{}, best1{};
+            uint8_t bestIndices[BlockPixels] = {};
+            int bestError = INT32_MAX;
+
+            for (int pass = 0; pass <= RefinePasses; ++pass)
+            {
+                const Mode6Endpoint e0 = QuantizeMode6(first);
+                const Mode6Endpoint e1 = QuantizeMode6(second);
+                int palette[16][4];
+                Mode6Palette(e0, e1, palette);
+                uint8_t indices[BlockPixels];
+                const int error = Mode6Indices(pixels, palette, indices);
+
+                if (error < bestError)
+                {
+                    bestError = error;
+                    best0 = e0;
+                    best1 = e1;
+                    std::copy_n(indices, BlockPixels, bestIndices);
+                }
+                if (error == 0)
+                {
+                    break;
+                }
+
+                float weights[BlockPixels];
+                for (int i = 0; i < BlockPixels; ++i)
+                {
+                    weights[i] = 1.0f - Mode6Weights[indices[i]] / 64.0f;
+                }
+                if (!SolveEndpoints<4>(pixels, weights, first, second))
+                {
+                    break;
+                }
+            }
+
+            // The first pixel's index is stored without its top bit, which must be 0
+            if (bestIndices[0] >= 8)
+            {
+                std::swap(best0, best1);
+                for (uint8_t& index : bestIndices)
+                {
+                    index = static_cast<uint8_t>(15 - index);
+                }
+            }
+
+            BitWriter writer(out);
+            writer.Write(1u << 6, 7);   // Mode 6
+            for (int c = 0; c < 4; ++c)
+            {
+                writer.Write(static_cast<uint32_t>(best0.value[c]), 7);
+                writer.Write(static_cast<uint32_t>(best1.value[c]), 7);
+            }
+            writer.Write(static_cast<uint32_t>(best0.pBit), 1);
+            writer.Write(static_cast<uint32_t>(best1.pBit), 1);
+            writer.Write(bestIndices[0], 3);
+            for (int i = 1; i < BlockPixels; ++i)
+            {
+                writer.Write(bestIndices[i], 4);
+            }
+        }
+
+        void DecodeBC1(const uint8_t block[BC1BlockBytes], uint8_t rgba[BlockPixels * 4])
+        {
+            DecodeColorBlock(block, rgba);
+        }
+
+        void DecodeBC3(const uint8_t block[BC3BlockBytes], uint8_t rgba[BlockPixels * 4])
+        {
+            DecodeColorBlock(block + 8, rgba);
+            DecodeAlphaBlock(block, rgba);
+        }
+
+        void DecodeBC7(const uint8_t block[BC7BlockBytes], uint8_t rgba[BlockPixels * 4])
+        {
+            BitReader reader(block);
+            if (reader.Read(7) != (1u << 6))
+            {
+                std::memset(rgba, 0, BlockPixels * 4);
+                return;
+            }
+
+            Mode6Endpoint e0{}, e1{};
+            for (int c = 0; c < 4; ++c)
+            {
+                e0.value[c] = static_cast<int>(reader.Read(7));
+                e1.value[c] = static_cast<int>(reader.Read(7));
+            }
+            e0.pBit = static_cast<int>(reader.Read(1));
+            e1.pBit = static_cast<int>(reader.Read(1));
+
+            int palette[16][4];
+            Mode6Palette(e0, e1, palette);
+            for (int i = 0; i < BlockPixels; ++i)
+            {
+                const uint32_t index = reader.Read(i == 0 ? 3 : 4);
+                for (int c = 0; c < 4; ++c)
+                {
+                    rgba[i * 4 + c] = static_cast<uint8_t>(palette[index][c]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : BlockCompression.h
+/// @Brief : Declares CPU encoders and decoders for the GPU block compressed
+///          texture formats used by compressed textures. Every function
+///          works on one 4x4 block of RGBA8 pixels, row by row.
+///            BC1 : 8 bytes, RGB, opaque (alpha is ignored)
+///            BC3 : 16 bytes, BC1 colour plus an interpolated alpha block
+///            BC7 : 16 bytes, RGBA, encoded in mode 6 (one subset, 7 bit
+///                  endpoints with a p-bit, 16 interpolation steps)
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _BLOCK_COMPRESSION_H_
+#define _BLOCK_COMPRESSION_H_
+#include <cstddef>
+#include <cstdint>
+
+namespace Framework
+{
+    namespace BlockCompression
+    {
+        constexpr int BlockPixels = 16;
+        constexpr size_t BC1BlockBytes = 8;
+        constexpr size_t BC3BlockBytes = 16;
+        constexpr size_t BC7BlockBytes = 16;
+
+        void EncodeBC1(const uint8_t rgba[BlockPixels * 4], uint8_t out[BC1BlockBytes]);
+        void EncodeBC3(const uint8_t rgba[BlockPixels * 4], uint8_t out[BC3BlockBytes]);
+        void EncodeBC7(const uint8_t rgba[BlockPixels * 4], uint8_t out[BC7BlockBytes]);
+
+        void DecodeBC1(const uint8_t block[BC1BlockBytes], uint8_t rgba[BlockPixels * 4]);
+        void DecodeBC3(const uint8_t block[BC3BlockBytes], uint8_t rgba[BlockPixels * 4]);
+
+        /**
+         * @brief Decodes the mode 6 blocks written by EncodeBC7. Blocks in other modes decode
+         *        to transparent black.
+         */
+        void DecodeBC7(const uint8_t block[BC7BlockBytes], uint8_t rgba[BlockPixels * 4]);
+    }
+}
+#endif // !_BLOCK_COMPRESSION_H_
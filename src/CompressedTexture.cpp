@@ -0,0 +1,455 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : CompressedTexture.cpp
+/// @Brief : Implements building, writing and mapping compressed texture
+///          containers. The file is a fixed header, one entry per mip level
+///          (largest first, down to 1x1) and the level blocks, each 8 byte
+///          aligned. Values are stored in native byte order; like lexicon
+///          packs, a container is a local build product of its image. The
+///          header records the TextureLayout the texels were converted to,
+///          and the mip chain is filtered after that conversion.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "CompressedTexture.h"
+#include "BlockCompression.h"
+#include "stb_image.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace Framework
+{
+    namespace
+    {
+        constexpr uint32_t ContainerMagic = 0x58544555;    // "UETX"
+        constexpr uint32_t ContainerVersion = 2;
+
+        struct ContainerHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t codec;
+            uint32_t levelCount;
+            uint32_t layoutFlags;   // TextureLayout::Flags()
+            uint32_t reserved;
+        };
+
+        struct LevelEntry
+        {
+            uint32_t width;
+            uint32_t height;
+            uint64_t offset;
+            uint64_t size;
+        };
+
+        // Appends raw bytes at the next 8 byte boundary and returns where they start
+        uint64_t AppendAligned(std::vector<uint8_t>& out, const void* bytes, size_t size)
+        {
+            out.resize((out.size() + 7) & ~static_cast<size_t>(7), 0);
+            const uint64_t offset = out.size();
+            const uint8_t* begin = static_cast<const uint8_t*>(bytes);
+            out.insert(out.end(), begin, begin + size);
+            return offset;
+        }
+
+        struct Image
+        {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            std::vector<uint8_t> rgba;
+        };
+
+        // 2x2 box filter; an odd last row or column is averaged with itself
+        Image HalfSize(const Image& source)
+        {
+            Image half;
+            half.width = std::max(1u, source.width / 2);
+            half.height = std::max(1u, source.height / 2);
+            half.rgba.resize(static_cast<size_t>(half.width) * half.height * 4);
+
+            for (uint32_t y = 0; y < half.height; ++y)
+            {
+                const uint32_t y0 = std::min(y * 2, source.height - 1);
+                const uint32_t y1 = std::min(y * 2 + 1, source.height - 1);
+                for (uint32_t x = 0; x < half.width; ++x)
+                {
+                    const uint32_t x0 = std::min(x * 2, source.width - 1);
+                    const uint32_t x1 = std::min(x * 2 + 1, source.width - 1);
+                    for (int channel = 0; channel < 4; ++channel)
+                    {
+                        auto at = [&](uint32_t px, uint32_t py) { return static_cast<uint32_t>(source.rgba[(static_cast<size_t>(py) * source.width + px) * 4 + channel]); };
+                        half.rgba[(static_cast<size_t>(y) * half.width + x) * 4 + channel] =
+                            static_cast<uint8_t>((at(x0, y0) + at(x1, y0) + at(x0, y1) + at(x1, y1) + 2) / 4);
+                    }
+                }
+            }
+            return half;
+        }
+
+        bool HasAlpha(const Image& image)
+        {
+            for (size_t i = 3; i < image.rgba.size(); i += 4)
+            {
+                if (image.rgba[i] != 255)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        double Psnr(const std::vector<uint8_t>& original, const std::vector<uint8_t>& decoded)
+        {
+            double squaredError = 0.0;
+            for (size_t i = 0; i < original.size(); ++i)
+            {
+                const double difference = static_cast<double>(original[i]) - static_cast<double>(decoded[i]);
+                squaredError += difference * difference;
+            }
+            if (squaredError == 0.0)
+            {
+                return 99.0;    // Lossless, reported as a fixed ceiling instead of infinity
+            }
+            const double meanSquaredError = squaredError / static_cast<double>(original.size());
+            return 10.0 * std::log10(255.0 * 255.0 / meanSquaredError);
+        }
+
+        const char* CodecName(TextureCodec codec)
+        {
+            switch (codec)
+            {
+            case TextureCodec::BC1: return "BC1";
+            case TextureCodec::BC3: return "BC3";
+            case TextureCodec::BC7: return "BC7";
+            case TextureCodec::RGBA8: return "RGBA8";
+            default: return "Auto";
+            }
+        }
+
+        void EncodeBlock(TextureCodec codec, const uint8_t* pixels, uint8_t* out)
+        {
+            switch (codec)
+            {
+            case TextureCodec::BC1: BlockCompression::EncodeBC1(pixels, out); break;
+            case TextureCodec::BC3: BlockCompression::EncodeBC3(pixels, out); break;
+            default: BlockCompression::EncodeBC7(pixels, out); break;
+            }
+        }
+
+        void DecodeBlock(TextureCodec codec, const uint8_t* block, uint8_t* pixels)
+        {
+            switch (codec)
+            {
+            case TextureCodec::BC1: BlockCompression::DecodeBC1(block, pixels); break;
+            case TextureCodec::BC3: BlockCompression::DecodeBC3(block, pixels); break;
+            default: BlockCompression::DecodeBC7(block, pixels); break;
+            }
+        }
+    }
+
+    /*******************/
+    //   Encoding      //
+    /*******************/
+
+    size_t CompressedTexture::LevelBytes(TextureCodec codec, uint32_t width, uint32_t height)
+    {
+        if (codec == TextureCodec::RGBA8)
+        {
+            return static_cast<size_t>(width) * height * 4;
+        }
+        const size_t blockBytes = codec == TextureCodec::BC1 ? BlockCompression::BC1BlockBytes : BlockCompression::BC7BlockBytes;
+        return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * blockBytes;
+    }
+
+    std::vector<uint8_t> CompressedTexture::EncodeLevel(const uint8_t* rgba, uint32_t width, uint32_t height, TextureCodec codec, unsigned threads)
+    {
+        if (codec == TextureCodec::RGBA8)
+        {
+            return std::vector<uint8_t>(rgba, rgba + LevelBytes(codec, width, height));
+        }
+
+        const uint32_t blocksWide = (width + 3) / 4;
+        const uint32_t blocksHigh = (height + 3) / 4;
+        const size_t blockBytes = LevelBytes(codec, 4, 4);
+        std::vector<uint8_t> blocks(LevelBytes(codec, width, height));
+
+        // Workers take whole block rows; rows cost about the same, so a shared counter balances them
+        std::atomic<uint32_t> nextRow{ 0 };
+        auto work = [&]()
+        {
+            uint8_t pixels[BlockCompression::BlockPixels * 4];
+            for (uint32_t row = nextRow.fetch_add(1); row < blocksHigh; row = nextRow.fetch_add(1))
+            {
+                for (uint32_t column = 0; column < blocksWide; ++column)
+                {
+                    for (uint32_t py = 0; py < 4; ++py)
+                    {
+                        const uint32_t y = std::min(row * 4 + py, height - 1);
+                        for (uint32_t px = 0; px < 4; ++px)
+                        {
+                            const uint32_t x = std::min(column * 4 + px, width - 1);
+                            std::copy_n(rgba + (static_cast<size_t>(y) * width + x) * 4, 4, pixels + (py * 4 + px) * 4);
+                        }
+                    }
+                    EncodeBlock(codec, pixels, blocks.data() + (static_cast<size_t>(row) * blocksWide + column) * blockBytes);
+                }
+            }
+        };
+
+        if (threads == 0)
+        {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        threads = std::min(threads, blocksHigh);
+
+        std::vector<std::thread> workers;
+        for (unsigned i = 1; i < threads; ++i)
+        {
+            workers.emplace_back(work);
+        }
+        work();
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+        return blocks;
+    }
+
+    std::vector<uint8_t> CompressedTexture::DecodeLevel(const uint8_t* blocks, uint32_t width, uint32_t height, TextureCodec codec)
+    {
+        if (codec == TextureCodec::RGBA8)
+        {
+            return std::vector<uint8_t>(blocks, blocks + LevelBytes(codec, width, height));
+        }
+
+        const uint32_t blocksWide = (width + 3) / 4;
+        const uint32_t blocksHigh = (height + 3) / 4;
+        const size_t blockBytes = LevelBytes(codec, 4, 4);
+        std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+
+        uint8_t pixels[BlockCompression::BlockPixels * 4];
+        for (uint32_t row = 0; row < blocksHigh; ++row)
+        {
+            for (uint32_t column = 0; column < blocksWide; ++column)
+            {
+                DecodeBlock(codec, blocks + (static_cast<size_t>(row) * blocksWide + column) * blockBytes, pixels);
+                for (uint32_t py = 0; py < 4 && row * 4 + py < height; ++py)
+                {
+                    for (uint32_t px = 0; px < 4 && column * 4 + px < width; ++px)
+                    {
+                        std::copy_n(pixels + (py * 4 + px) * 4, 4, rgba.data() + ((static_cast<size_t>(row) * 4 + py) * width + column * 4 + px) * 4);
+                    }
+                }
+            }
+        }
+        return rgba;
+    }
+
+    /*******************/
+    //   Container     //
+    /*******************/
+
+    std::string CompressedTexture::ContainerPathFor(const std::string& imagePath)
+    {
+        return std::filesystem::path(imagePath).replace_extension(".uetex").string();
+    }
+
+    bool CompressedTexture::IsStale(const std::string& imagePath, const std::string& containerPath)
+    {
+        std::error_code error;
+        const auto containerTime = std::filesystem::last_write_time(containerPath, error);
+        if (error)
+        {
+            return true;
+        }
+
+        // A container shipped without its image is still usable
+        const auto imageTime = std::filesystem::last_write_time(imagePath, error);
+        return !error && imageTime > containerTime;
+    }
+
+    std::string CompressedTexture::Compile(const std::string& imagePath, const std::string& containerPath, TextureCodec codec, unsigned threads, Report* report)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        int width = 0, height = 0, channels = 0;
+        unsigned char* pixels = stbi_load(imagePath.c_str(), &width, &height, &channels, 4);
+        if (!pixels)
+        {
+            std::cerr << "Error: Could not decode texture for compression: " << imagePath << std::endl;
+            return "";
+        }
+
+        Image level;
+        level.width = static_cast<uint32_t>(width);
+        level.height = static_cast<uint32_t>(height);
+        level.rgba.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
+        stbi_image_free(pixels);
+
+        if (codec == TextureCodec::Auto)
+        {
+            codec = HasAlpha(level) ? TextureCodec::BC7 : TextureCodec::BC1;
+        }
+
+        // Convert before filtering: mips of premultiplied texels keep no colour from transparent pixels
+        const TextureLayout layout = GlobalTextureLayout;
+        TextureImport::Normalize(level.rgba.data(), level.rgba.size() / 4, layout);
+
+        ContainerHeader header{};
+        header.magic = ContainerMagic;
+        header.version = ContainerVersion;
+        header.codec = static_cast<uint32_t>(codec);
+        header.layoutFlags = layout.Flags();
+
+        // Level entries are filled in as the levels are appended
+        std::vector<LevelEntry> entries;
+        std::vector<std::vector<uint8_t>> levelBlocks;
+        Report result;
+        result.codec = codec;
+        result.width = level.width;
+        result.height = level.height;
+        for (;;)
+        {
+            levelBlocks.push_back(EncodeLevel(level.rgba.data(), level.width, level.height, codec, threads));
+            entries.push_back(LevelEntry{ level.width, level.height, 0, levelBlocks.back().size() });
+            result.uncompressedBytes += level.rgba.size();
+            result.compressedBytes += levelBlocks.back().size();
+            if (entries.size() == 1)
+            {
+                result.psnr = Psnr(level.rgba, DecodeLevel(levelBlocks.back().data(), level.width, level.height, codec));
+            }
+            if (level.width == 1 && level.height == 1)
+            {
+                break;
+            }
+            level = HalfSize(level);
+        }
+        header.levelCount = static_cast<uint32_t>(entries.size());
+        result.levelCount = header.levelCount;
+
+        std::vector<uint8_t> bytes(sizeof(ContainerHeader) + entries.size() * sizeof(LevelEntry), 0);
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            entries[i].offset = AppendAligned(bytes, levelBlocks[i].data(), levelBlocks[i].size());
+        }
+        std::copy_n(reinterpret_cast<const uint8_t*>(&header), sizeof(header), bytes.begin());
+        std::copy_n(reinterpret_cast<const uint8_t*>(entries.data()), entries.size() * sizeof(LevelEntry), bytes.begin() + sizeof(header));
+
+        const std::string tempPath = containerPath + ".tmp";
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!out)
+            {
+                std::cerr << "Error: Could not write compressed texture: " << tempPath << std::endl;
+                return "";
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(tempPath, containerPath, error);
+        if (error)
+        {
+            // Windows refuses to replace a file another process has mapped; the old container stays stale and the image is used
+            std::cerr << "Error: Could not replace compressed texture " << containerPath << ": " << error.message() << std::endl;
+            std::filesystem::remove(tempPath, error);
+            return "";
+        }
+
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "Texture compressed: " << imagePath << " (" << CodecName(codec) << ", " << result.width << "x" << result.height
+            << ", " << result.levelCount << " levels, " << std::fixed << std::setprecision(1) << result.uncompressedBytes / 1024.0 << " KB -> "
+            << result.compressedBytes / 1024.0 << " KB, " << result.psnr << " dB, " << std::setprecision(2) << result.seconds << " s)"
+            << std::defaultfloat << std::endl;
+        if (report)
+        {
+            *report = result;
+        }
+        return containerPath;
+    }
+
+    std::shared_ptr<CompressedTexture> CompressedTexture::Open(const std::string& containerPath)
+    {
+        auto texture = std::make_shared<CompressedTexture>();
+        if (!texture->file.Open(containerPath))
+        {
+            return nullptr;
+        }
+
+        const uint8_t* base = texture->file.Data();
+        const size_t fileSize = texture->file.Size();
+        ContainerHeader header{};
+        if (fileSize < sizeof(header))
+        {
+            std::cerr << "Error: Compressed texture is truncated: " << containerPath << std::endl;
+            return nullptr;
+        }
+        std::copy_n(base, sizeof(header), reinterpret_cast<uint8_t*>(&header));
+
+        const TextureCodec codec = static_cast<TextureCodec>(header.codec);
+        const bool knownCodec = codec == TextureCodec::BC1 || codec == TextureCodec::BC3 || codec == TextureCodec::BC7 || codec == TextureCodec::RGBA8;
+        if (header.magic != ContainerMagic || header.version != ContainerVersion || !knownCodec || header.levelCount == 0
+            || header.levelCount > 32 || fileSize < sizeof(header) + header.levelCount * sizeof(LevelEntry))
+        {
+            std::cerr << "Error: Invalid compressed texture: " << containerPath << std::endl;
+            return nullptr;
+        }
+
+        texture->codec = codec;
+        texture->layout.premultipliedAlpha = (header.layoutFlags & 1u) != 0;
+        texture->layout.srgb = (header.layoutFlags & 2u) != 0;
+        texture->levels.reserve(header.levelCount);
+        for (uint32_t i = 0; i < header.levelCount; ++i)
+        {
+            LevelEntry entry{};
+            std::copy_n(base + sizeof(header) + i * sizeof(LevelEntry), sizeof(entry), reinterpret_cast<uint8_t*>(&entry));
+
+            const uint64_t expectedSize = LevelBytes(codec, entry.width, entry.height);
+            if (entry.width == 0 || entry.height == 0 || entry.size != expectedSize || entry.offset > fileSize || entry.size > fileSize - entry.offset)
+            {
+                std::cerr << "Error: Invalid compressed texture level " << i << ": " << containerPath << std::endl;
+                return nullptr;
+            }
+            texture->levels.push_back(Level{ entry.width, entry.height, base + entry.offset, static_cast<size_t>(entry.size) });
+        }
+        return texture;
+    }
+
+    /*******************/
+    //   OpenGL        //
+    /*******************/
+
+    GLenum CompressedTexture::GLFormat(TextureCodec codec, const TextureLayout& layout)
+    {
+        switch (codec)
+        {
+        case TextureCodec::BC1: return layout.srgb ? GL_COMPRESSED_SRGB_S3TC_DXT1_EXT : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case TextureCodec::BC3: return layout.srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case TextureCodec::RGBA8: return layout.InternalFormat();
+        default: return layout.srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_ARB : GL_COMPRESSED_RGBA_BPTC_UNORM_ARB;
+        }
+    }
+
+    bool CompressedTexture::IsSupportedByGL(TextureCodec codec, const TextureLayout& layout)
+    {
+        switch (codec)
+        {
+        case TextureCodec::RGBA8: return true;
+        case TextureCodec::BC7: return GLEW_ARB_texture_compression_bptc || GLEW_VERSION_4_2;
+        default:
+            // The sRGB S3TC formats come from EXT_texture_sRGB, not the S3TC extension itself
+            return GLEW_EXT_texture_compression_s3tc && (!layout.srgb || GLEW_EXT_texture_sRGB);
+        }
+    }
+}
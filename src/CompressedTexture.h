@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : CompressedTexture.h
+/// @Brief : Declares CompressedTexture, a GPU block compressed copy of an
+///          image file with its whole mip chain, stored next to the image as
+///          a .uetex container. Textures are compressed when imported or by
+///          an explicit compression pass, on every core, and the loader maps
+///          the container and hands each level to glCompressedTexImage2D
+///          instead of decoding the image and generating mipmaps at runtime.
+///          Texels are stored in the TextureLayout the renderer expects.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _COMPRESSED_TEXTURE_H_
+#define _COMPRESSED_TEXTURE_H_
+#include "pch.h"
+#include "MappedFile.h"
+#include "TextureImport.h"
+#include <glew.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Framework
+{
+    enum class TextureCodec : uint32_t
+    {
+        Auto = 0,   // BC1 for opaque images, BC7 for images with alpha
+        BC1 = 1,
+        BC3 = 3,
+        BC7 = 7,
+        RGBA8 = 8,  // Uncompressed, for art that must stay exact; still skips decoding and mip generation
+    };
+
+    /**
+     * @class CompressedTexture
+     * @brief Read-only, memory mapped compressed texture. Levels point into the mapping.
+     */
+    class CompressedTexture
+    {
+    public:
+        struct Level
+        {
+            uint32_t width = 0;
+            uint32_t height = 0;
+            const uint8_t* data = nullptr;
+            size_t size = 0;
+        };
+
+        /**
+         * @brief What compressing one texture achieved.
+         */
+        struct Report
+        {
+            TextureCodec codec = TextureCodec::Auto;
+            uint32_t width = 0;
+            uint32_t height = 0;
+            uint32_t levelCount = 0;
+            size_t uncompressedBytes = 0;   // RGBA8 mip chain the runtime path uploaded
+            size_t compressedBytes = 0;
+            double psnr = 0.0;              // Of the top level, in dB; higher is closer to the source
+            double seconds = 0.0;
+        };
+
+        /**
+         * @brief Container path used for an image: the image path with its extension replaced by .uetex.
+         */
+        static std::string ContainerPathFor(const std::string& imagePath);
+
+        /**
+         * @brief Whether the container is missing or older than its image.
+         */
+        static bool IsStale(const std::string& imagePath, const std::string& containerPath);
+
+        /**
+         * @brief Decodes the image, converts it to GlobalTextureLayout, builds its mip chain,
+         *        compresses every level and writes the container next to the target, renamed
+         *        over it when complete.
+         * @param threads Worker threads, 0 for one per core.
+         * @param report Filled in when not null.
+         * @return Path of the written container, empty on failure (the temporary file is removed,
+         *         also when an old container in use can't be replaced).
+         */
+        static std::string Compile(const std::string& imagePath, const std::string& containerPath,
+            TextureCodec codec = TextureCodec::Auto, unsigned threads = 0, Report* report = nullptr);
+
+        /**
+         * @brief Maps a container.
+         * @return The texture, or nullptr if the file is missing or not a valid container.
+         */
+        static std::shared_ptr<CompressedTexture> Open(const std::string& containerPath);
+
+        /**
+         * @brief Compresses one RGBA8 image level into blocks. Edge blocks repeat the last row
+         *        and column. RGBA8 levels are copied as they are.
+         */
+        static std::vector<uint8_t> EncodeLevel(const uint8_t* rgba, uint32_t width, uint32_t height, TextureCodec codec, unsigned threads = 0);
+
+        /**
+         * @brief Expands one level back to RGBA8, for reports and drivers without the format.
+         */
+        static std::vector<uint8_t> DecodeLevel(const uint8_t* blocks, uint32_t width, uint32_t height, TextureCodec codec);
+
+        /**
+         * @brief Bytes of one level of the given size.
+         */
+        static size_t LevelBytes(TextureCodec codec, uint32_t width, uint32_t height);
+
+        /**
+         * @brief OpenGL internal format of a codec in a layout.
+         */
+        static GLenum GLFormat(TextureCodec codec, const TextureLayout& layout);
+
+        /**
+         * @brief Whether the current context can sample the codec without decoding it first.
+         */
+        static bool IsSupportedByGL(TextureCodec codec, const TextureLayout& layout);
+
+        TextureCodec GetCodec() const { return codec; }
+        const TextureLayout& GetLayout() const { return layout; }
+        const std::vector<Level>& GetLevels() const { return levels; }
+
+        CompressedTexture() = default;
+        CompressedTexture(const CompressedTexture&) = delete;
+        CompressedTexture& operator=(const CompressedTexture&) = delete;
+
+    private:
+        MappedFile file;
+        TextureCodec codec = TextureCodec::Auto;
+        TextureLayout layout;
+        std::vector<Level> levels;
+    };
+}
+#endif // !_COMPRESSED_TEXTURE_H_
@@ -19,6 +19,16 @@
 #include "AssetManager.h"
 #include "Vector2D.h"
 #include "Coordinator.h"
+#include "TargetMatcher.h"
+#include "SerializedEnums.h"
+#include "EntityPool.h"
+#include "TransformCache.h"
+#include "TimelineEvaluator.h"
+#include "TimingWheel.h"
+#include "SpatialHash.h"
+#include "VirtualFileSystem.h"
+#include "JsonWriter.h"
+#include <algorithm>
 
 EntityAsset GlobalEntityAsset;
 
@@ -37,11 +47,13 @@ EntityAsset::~EntityAsset() {}
 
 void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 newPosition)   
 {
+    createdEntities.clear();
+
     // Read JSON file
-    std::ifstream ifs(filename);
-    rapidjson::IStreamWrapper isw(ifs);
+    std::string contents;
+    Framework::GlobalVirtualFileSystem.ReadFile(filename, contents);   // A missing file fails to parse below
     rapidjson::Document document;
-    document.ParseStream(isw);
+    Framework::ParseJson(document, contents);
 
     // Check for errors in parsing
     if (document.HasParseError())
@@ -75,6 +87,7 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
 
         // Create a new entity
         Framework::Entity newEntity = ecsInterface.CreateEntity();
+        createdEntities.push_back(newEntity);
 
         ecsInterface.SetEntityName(newEntity, entityType); // Assuming you have a function to set entity name
 
@@ -176,11 +189,7 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
 
                 // Parse renderType
                 if (render.HasMember("renderType") && render["renderType"].IsString()) {
-                    std::string typeStr = render["renderType"].GetString();
-                    if (typeStr == "Sprite") renderComponent.renderType = RenderType::Sprite;
-                    else if (typeStr == "Particle") renderComponent.renderType = RenderType::Particle;
-                    else if (typeStr == "Text") renderComponent.renderType = RenderType::Text;
-                    else if (typeStr == "PauseUI") renderComponent.renderType = RenderType::PauseUI;
+                    renderComponent.renderType = Framework::EnumFromString(render["renderType"].GetString(), renderComponent.renderType);
                 }
 
                 // Parse isActive
@@ -202,13 +211,7 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
                 {
                     if (layer["LayerID"].IsString())
                     {
-                        std::string layerStr = layer["LayerID"].GetString();
-                        if (layerStr == "Background") layerComponent.layerID = Layer::Background;
-                        else if (layerStr == "Character") layerComponent.layerID = Layer::Character;
-                        else if (layerStr == "Foreground") layerComponent.layerID = Layer::Foreground;
-                        else if (layerStr == "UI") layerComponent.layerID = Layer::UI;
-                        else if (layerStr == "Debug") layerComponent.layerID = Layer::Debug;
-                        else layerComponent.layerID = Layer::Background; // Default or unknown
+                        layerComponent.layerID = Framework::EnumFromString(layer["LayerID"].GetString(), Layer::Background); // Background if unknown
                     }
                     // Check if LayerID is an integer and assign directly
                     else if (layer["LayerID"].IsInt())
@@ -308,13 +311,7 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
                 }
 
                 if (playerComp.HasMember("type")) {
-                    std::string typeStr = playerComp["type"].GetString();
-                    if (typeStr == "Player") {
-                        playerComponent.type = Player;
-                    }
-                    else if (typeStr == "TextBox") {
-                        playerComponent.type = TextBox;
-                    }
+                    playerComponent.type = Framework::EnumFromString(playerComp["type"].GetString(), playerComponent.type);
                 }
                 if (playerComp.HasMember("health") && playerComp["health"].IsFloat()) {
                     playerComponent.health = playerComp["health"].GetFloat();
@@ -364,17 +361,7 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
                 const rapidjson::Value& collision = components["CollisionComponent"];
                 CollisionComponent collisionComponent;
                 if (collision.HasMember("type")) {
-                    std::string typeStr = collision["type"].GetString();
-                    if (typeStr == "Player") {
-                        collisionComponent.type = Player;
-                    }
-                    else if (typeStr == "Enemy") {
-
-                        collisionComponent.type = Enemy;
-                    }
-                    else if (typeStr == "CollidableObject") {
-                        collisionComponent.type = CollidableObject;
-                    }
+                    collisionComponent.type = Framework::EnumFromString(collision["type"].GetString(), collisionComponent.type);
                 }
                 if (collision.HasMember("collided")) collisionComponent.collided = collision["collided"].GetBool();
                 if (collision.HasMember("radius")) collisionComponent.radius = collision["radius"].GetFloat();
@@ -391,25 +378,7 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
 
                 // Load and set the enemy type
                 if (enemy.HasMember("type") && enemy["type"].IsString()) {
-                    std::string typeStr = enemy["type"].GetString();
-                    if (typeStr == "Minion") {
-                        enemyComponent.type = Minion;
-                    }
-                    else if (typeStr == "Boss") {
-                        enemyComponent.type = Boss;
-                    }
-                    else if (typeStr == "MC") {
-                        enemyComponent.type = MC;
-                    }
-                    else if (typeStr == "Poison") {
-                        enemyComponent.type = Poison;
-                    }
-                    else if (typeStr == "Spawner") {
-                        enemyComponent.type = Spawner;
-                    }
-                    else if (typeStr == "Smoke") {
-                        enemyComponent.type = Smoke;
-                    }
+                    enemyComponent.type = Framework::EnumFromString(enemy["type"].GetString(), enemyComponent.type);
                 }
 
                 // Load health and predicted health value
@@ -452,6 +421,16 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
                 // Add EnemyComponent to the entity
                 ecsInterface.AddComponent<EnemyComponent>(newEntity, enemyComponent);
                 std::cout << "ADDED ENEMY COMPONENT to entity " << newEntity << std::endl;
+
+                // Enemies with a word become typing targets
+                if (ecsInterface.HasComponent<TextComponent>(newEntity))
+                {
+                    const std::string& word = ecsInterface.GetComponent<TextComponent>(newEntity).text;
+                    if (!word.empty())
+                    {
+                        Framework::GlobalTargetMatcher.AddTarget(newEntity, word);
+                    }
+                }
             }
 
             // Check and add Animation Component
@@ -459,11 +438,36 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
                 const rapidjson::Value& animation = components["AnimationComponent"];
                 AnimationComponent animationComponent;
 
+                // A named clip supplies the sheet layout, values written next to it still override it
+                auto& clips = Framework::GlobalAssetManager.GetAnimationClips();
+                Framework::AnimationClipHandle clip = Framework::InvalidAnimationClip;
+                if (animation.HasMember("clip") && animation["clip"].IsString())
+                {
+                    clip = clips.Find(animation["clip"].GetString());
+                    if (clips.IsValid(clip))
+                    {
+                        animationComponent.rows = clips.GetClip(clip).rows;
+                        animationComponent.cols = clips.GetClip(clip).cols;
+                        animationComponent.animationSpeed = clips.GetClip(clip).framesPerSecond;
+                    }
+                    else
+                    {
+                        std::cerr << "Warning: Unknown animation clip " << animation["clip"].GetString() << std::endl;
+                    }
+                }
        
                 if (animation.HasMember("animationSpeed")) animationComponent.animationSpeed = animation["animationSpeed"].GetFloat();
                 if (animation.HasMember("rows")) animationComponent.rows = animation["rows"].GetInt(); std::cout << animation["rows"].GetInt() << std::endl;
                 if (animation.HasMember("cols")) animationComponent.cols = animation["cols"].GetInt();
 
+                // The sprite batcher draws the frames of the clip the entity plays; overridden layouts get their own clip
+                if (!clips.IsValid(clip) || clips.GetClip(clip).rows != animationComponent.rows || clips.GetClip(clip).cols != animationComponent.cols
+                    || clips.GetClip(clip).framesPerSecond != animationComponent.animationSpeed)
+                {
+                    clip = clips.AddLayout(animationComponent.rows, animationComponent.cols, animationComponent.animationSpeed);
+                }
+                clips.Play(newEntity, clip);
+
                 ecsInterface.AddComponent<AnimationComponent>(newEntity, animationComponent);
                 //std::cout << "ADDED ANIMATION COMPONENT\n";
             }
@@ -532,7 +536,15 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
                     auto buttonFunction = GlobalLogicManager.GetButtonFunction(buttonComponent.UpdateFunctionName);
 
                     if (buttonFunction) {
-                        buttonComponent.onClick = [newEntity, buttonFunction]() {
+                        // Presses during the cooldown are ignored. The cooldown runs on the real time
+                        // wheel, so pause menu buttons still recover while the game is paused
+                        buttonComponent.onClick = [newEntity, buttonFunction, cooldown = buttonComponent.pressCooldown]() {
+                            if (Framework::GlobalUITimingWheel.IsScheduled(newEntity, Framework::TimerKind::ButtonCooldown)) {
+                                return;
+                            }
+                            if (cooldown > 0.0f) {
+                                Framework::GlobalUITimingWheel.Schedule(newEntity, Framework::TimerKind::ButtonCooldown, cooldown);
+                            }
                             buttonFunction(newEntity);
                             };
                     }
@@ -597,7 +609,15 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
                     timelineComponent.TransitionInFunctionName = timelineComp["TransitionInFunctionName"].GetString();
                     auto transitionInFunction = GlobalLogicManager.GetTimelineFunction(timelineComponent.TransitionInFunctionName);
 
-                    if (transitionInFunction) {
+                    if (GlobalTimelineEvaluator.FindCurve(timelineComponent.TransitionInFunctionName)) {
+                        // Triggers from the timeline system start the curve once; the evaluator plays it
+                        timelineComponent.TransitionIn = [](Framework::Entity e, float progress) {
+                            if (progress < 1.0f && !GlobalTimelineEvaluator.IsPlayingTimeline(e, true)) {
+                                GlobalTimelineEvaluator.PlayTimeline(e, true, false);
+                            }
+                            };
+                    }
+                    else if (transitionInFunction) {
                         timelineComponent.TransitionIn = [newEntity, transitionInFunction](Framework::Entity e, float progress) {
                             (void)e;
                             transitionInFunction(newEntity, progress);
@@ -617,7 +637,15 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
                     timelineComponent.TransitionOutFunctionName = timelineComp["TransitionOutFunctionName"].GetString();
                     auto transitionOutFunction = GlobalLogicManager.GetTimelineFunction(timelineComponent.TransitionOutFunctionName);
 
-                    if (transitionOutFunction) {
+                    if (GlobalTimelineEvaluator.FindCurve(timelineComponent.TransitionOutFunctionName)) {
+                        // Triggers from the timeline system start the curve once; the evaluator plays it
+                        timelineComponent.TransitionOut = [](Framework::Entity e, float progress) {
+                            if (progress < 1.0f && !GlobalTimelineEvaluator.IsPlayingTimeline(e, false)) {
+                                GlobalTimelineEvaluator.PlayTimeline(e, false, false);
+                            }
+                            };
+                    }
+                    else if (transitionOutFunction) {
                         timelineComponent.TransitionOut = [newEntity, transitionOutFunction](Framework::Entity e, float progress) {
                             (void)e;
                             transitionOutFunction(newEntity, progress);
@@ -682,6 +710,11 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
 
                 // Initialize the TimelineComponent's transition functions
                 GlobalLogicManager.InitializeTimeline(newEntity);
+
+                // Transitions with a registered curve start here instead of through the callbacks
+                if (timelineComponent.Active && timelineComponent.IsTransitioningIn) {
+                    GlobalTimelineEvaluator.PlayTimeline(newEntity, true);
+                }
             }
 
             // Check if it has ParticleComponent
@@ -710,17 +743,7 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
 
                 // Read EmissionShape from string
                 if (particle.HasMember("shape") && particle["shape"].IsString()) {
-                    std::string shapeStr = particle["shape"].GetString();
-                    if (shapeStr == "CIRCLE") particleComponent.shape = EmissionShape::CIRCLE;
-                    else if (shapeStr == "BOX") particleComponent.shape = EmissionShape::BOX;
-                    else if (shapeStr == "ELLIPSE") particleComponent.shape = EmissionShape::ELLIPSE;
-                    else if (shapeStr == "LINE") particleComponent.shape = EmissionShape::LINE;
-                    else if (shapeStr == "SPIRAL") particleComponent.shape = EmissionShape::SPIRAL;
-                    else if (shapeStr == "RADIAL") particleComponent.shape = EmissionShape::RADIAL;
-                    else if (shapeStr == "RANDOM") particleComponent.shape = EmissionShape::RANDOM;
-                    else if (shapeStr == "WAVE") particleComponent.shape = EmissionShape::WAVE;
-                    else if (shapeStr == "CONE") particleComponent.shape = EmissionShape::CONE;
-                    else if (shapeStr == "EXPLOSION") particleComponent.shape = EmissionShape::EXPLOSION;
+                    particleComponent.shape = Framework::EnumFromString(particle["shape"].GetString(), particleComponent.shape);
                 }
 
                 // Load shape-specific data
@@ -808,228 +831,216 @@ void EntityAsset::DeserializeEntities(const std::string& filename, glm::vec2 new
 
         }
     }
+
+    // Cache the new entities' transforms; static ones are then never rebuilt unless marked dirty
+    for (Framework::Entity entity : createdEntities)
+    {
+        Framework::GlobalTransformCache.Track(entity);
+        Framework::GlobalSpatialHash.Track(entity);
+        ScheduleTimers(entity);
+    }
+}
+
+void EntityAsset::ScheduleTimers(Framework::Entity entity)
+{
+    using namespace Framework;
+
+    // SpawnerComponent intervals stay with the spawner system, which accumulates and spawns itself
+
+    // An enemy waiting to spawn gets a one-shot timer for what is left of its spawnTimer
+    if (ecsInterface.HasComponent<EnemyComponent>(entity)) {
+        const auto& enemy = ecsInterface.GetComponent<EnemyComponent>(entity);
+        if (!enemy.spawned && enemy.spawnTimer > 0.0f) {
+            GlobalTimingWheel.CancelEntity(entity, TimerKind::EnemySpawn);
+            GlobalTimingWheel.Schedule(entity, TimerKind::EnemySpawn, enemy.spawnTimer);
+        }
+    }
 }
 
 void EntityAsset::SerializeEntities(const std::string& filename)
 {
     std::cout << "Serializing to: " << filename << std::endl;
 
-    // Create a JSON document
-    rapidjson::Document document;
-    document.SetObject();
-
-    // Create the "entities" array
-    rapidjson::Value entities(rapidjson::kArrayType);
+    // Components are written as they are read, no Document is built
+    Framework::JsonWriter writer(filename, Framework::GlobalJsonStyle);
+    if (!writer.IsOpen())
+    {
+        std::cerr << "Error: Unable to open file " << filename << " for writing." << std::endl;
+        return;
+    }
 
     auto& entityAsset = ecsInterface.GetEntities(); // Get all entities
     std::cout << "Found " << entityAsset.size() << " entities." << std::endl;
 
+    writer.StartObject();
+    writer.Key("entities");
+    writer.StartArray();
+
     // Iterate through all entities
+    size_t serializedCount = 0;
     for (const auto& entity : entityAsset)
     {
-        std::cout << "Serializing entity: " << entity << std::endl;
-
-        rapidjson::Value entityObj(rapidjson::kObjectType);
+        // Pool instances are recreated from their prefabs when the scene loads
+        if (Framework::GlobalEntityPool.IsPooled(entity))
+        {
+            continue;
+        }
+        ++serializedCount;
 
-        // Add type of the entity (use GetEntityName if applicable)
-        std::string entityName = ecsInterface.GetEntityName(entity);
-        std::cout << "Entity name: " << entityName << std::endl;
+        writer.StartObject();
 
         // Use "type" instead of "name" for entity type
-        entityObj.AddMember("type", rapidjson::Value(entityName.c_str(), document.GetAllocator()), document.GetAllocator());
+        writer.Member("type", ecsInterface.GetEntityName(entity));
 
         // Create a "components" object for the entity
-        rapidjson::Value components(rapidjson::kObjectType);
+        writer.Key("components");
+        writer.StartObject();
 
         // Serialize TransformComponent
         if (ecsInterface.HasComponent<TransformComponent>(entity)) {
             const auto& transform = ecsInterface.GetComponent<TransformComponent>(entity);
-            std::cout << "Serializing TransformComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value transformComp(rapidjson::kObjectType);
-            transformComp.AddMember("x", transform.position.x, document.GetAllocator());
-            transformComp.AddMember("y", transform.position.y, document.GetAllocator());
-            transformComp.AddMember("scaleX", transform.scale.x, document.GetAllocator());
-            transformComp.AddMember("scaleY", transform.scale.y, document.GetAllocator());
-            transformComp.AddMember("rotation", transform.rotation, document.GetAllocator());
-
-            // **NEW: Add Tag to Serialization**
-            rapidjson::Value tagValue;
-            tagValue.SetString(transform.tag.c_str(), static_cast<rapidjson::SizeType>(transform.tag.length()), document.GetAllocator());
-            transformComp.AddMember("tag", tagValue, document.GetAllocator());
-            
-            components.AddMember("TransformComponent", transformComp, document.GetAllocator());
+            writer.Key("TransformComponent");
+            writer.StartObject();
+            writer.Member("x", transform.position.x);
+            writer.Member("y", transform.position.y);
+            writer.Member("scaleX", transform.scale.x);
+            writer.Member("scaleY", transform.scale.y);
+            writer.Member("rotation", transform.rotation);
+            writer.Member("tag", transform.tag);
+            writer.EndObject();
         }
 
-
         // Serialize RenderComponent
         if (ecsInterface.HasComponent<RenderComponent>(entity)) {
             const auto& render = ecsInterface.GetComponent<RenderComponent>(entity);
-            std::cout << "Serializing RenderComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value renderComp(rapidjson::kObjectType);
-            renderComp.AddMember("textureID", rapidjson::Value(render.textureID.c_str(), document.GetAllocator()), document.GetAllocator());
-
-            // Serialize color as an array
-            rapidjson::Value colorArray(rapidjson::kArrayType);
-            colorArray.PushBack(render.color.r, document.GetAllocator());
-            colorArray.PushBack(render.color.g, document.GetAllocator());
-            colorArray.PushBack(render.color.b, document.GetAllocator());
-            renderComp.AddMember("color", colorArray, document.GetAllocator());
-
-            renderComp.AddMember("alpha", render.alpha, document.GetAllocator());
-
-            // Serialize renderType as a string
-            std::string renderTypeStr;
-            switch (render.renderType) {
-            case RenderType::Sprite: renderTypeStr = "Sprite"; break;
-            case RenderType::Particle: renderTypeStr = "Particle"; break;
-            case RenderType::Text: renderTypeStr = "Text"; break;
-            case RenderType::PauseUI: renderTypeStr = "PauseUI"; break;
-            }
-            renderComp.AddMember("renderType", rapidjson::Value(renderTypeStr.c_str(), document.GetAllocator()), document.GetAllocator());
-
-            components.AddMember("RenderComponent", renderComp, document.GetAllocator());
+            writer.Key("RenderComponent");
+            writer.StartObject();
+            writer.Member("textureID", render.textureID);
+            writer.ArrayMember("color", render.color.r, render.color.g, render.color.b);
+            writer.Member("alpha", render.alpha);
+            writer.Member("renderType", Framework::EnumToString(render.renderType));
+            writer.EndObject();
         }
 
         // Serialize TextComponent
         if (ecsInterface.HasComponent<TextComponent>(entity)) {
             const auto& text = ecsInterface.GetComponent<TextComponent>(entity);
-            std::cout << "Serializing TextComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value textComp(rapidjson::kObjectType);
-
-            textComp.AddMember("text", rapidjson::Value(text.text.c_str(), document.GetAllocator()), document.GetAllocator());
-            textComp.AddMember("fontSize", text.fontSize, document.GetAllocator());
-
-            // Serialize color as an array
-            rapidjson::Value colorArray(rapidjson::kArrayType);
-            colorArray.PushBack(text.color.r, document.GetAllocator());
-            colorArray.PushBack(text.color.g, document.GetAllocator());
-            colorArray.PushBack(text.color.b, document.GetAllocator());
-            textComp.AddMember("color", colorArray, document.GetAllocator());
-
-            textComp.AddMember("fontName", rapidjson::Value(text.fontName.c_str(), document.GetAllocator()), document.GetAllocator());
-
-            // Serialize offset as an array
-            rapidjson::Value offsetArray(rapidjson::kArrayType);
-            offsetArray.PushBack(text.offset.x, document.GetAllocator());
-            offsetArray.PushBack(text.offset.y, document.GetAllocator());
-            textComp.AddMember("offset", offsetArray, document.GetAllocator());
-
-            components.AddMember("TextComponent", textComp, document.GetAllocator());
+            writer.Key("TextComponent");
+            writer.StartObject();
+            writer.Member("text", text.text);
+            writer.Member("fontSize", text.fontSize);
+            writer.ArrayMember("color", text.color.r, text.color.g, text.color.b);
+            writer.Member("fontName", text.fontName);
+            writer.ArrayMember("offset", text.offset.x, text.offset.y);
+            writer.EndObject();
         }
 
         // Serialize LayerComponent
         if (ecsInterface.HasComponent<LayerComponent>(entity)) {
             const auto& layer = ecsInterface.GetComponent<LayerComponent>(entity);
-            std::cout << "Serializing LayerComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value layerComp(rapidjson::kObjectType);
-
-            layerComp.AddMember("LayerID", static_cast<int>(layer.layerID), document.GetAllocator());
-            layerComp.AddMember("SortID", layer.sortID, document.GetAllocator());
-
-            components.AddMember("LayerComponent", layerComp, document.GetAllocator());
+            writer.Key("LayerComponent");
+            writer.StartObject();
+            writer.Member("LayerID", static_cast<int>(layer.layerID));
+            writer.Member("SortID", layer.sortID);
+            writer.EndObject();
         }
 
         // Serialize MovementComponent
         if (ecsInterface.HasComponent<MovementComponent>(entity)) {
             const auto& movement = ecsInterface.GetComponent<MovementComponent>(entity);
-            std::cout << "Serializing MovementComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value movementComp(rapidjson::kObjectType);
-            movementComp.AddMember("x", movement.velocity.x, document.GetAllocator());
-            movementComp.AddMember("y", movement.velocity.y, document.GetAllocator());
-            movementComp.AddMember("baseX", movement.baseVelocity.x, document.GetAllocator());
-            movementComp.AddMember("baseY", movement.baseVelocity.y, document.GetAllocator());
-            components.AddMember("MovementComponent", movementComp, document.GetAllocator());
+            writer.Key("MovementComponent");
+            writer.StartObject();
+            writer.Member("x", movement.velocity.x);
+            writer.Member("y", movement.velocity.y);
+            writer.Member("baseX", movement.baseVelocity.x);
+            writer.Member("baseY", movement.baseVelocity.y);
+            writer.EndObject();
         }
 
         // Serialize CollisionComponent
         if (ecsInterface.HasComponent<CollisionComponent>(entity)) {
             const auto& collision = ecsInterface.GetComponent<CollisionComponent>(entity);
-            std::cout << "Serializing CollisionComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value collisionComp(rapidjson::kObjectType);
-            collisionComp.AddMember("type", rapidjson::Value(ObjectTypeToString(collision.type).c_str(), document.GetAllocator()), document.GetAllocator());
-            collisionComp.AddMember("collided", collision.collided, document.GetAllocator());
-            collisionComp.AddMember("collisionScaleX", collision.scale.x, document.GetAllocator());
-            collisionComp.AddMember("collisionScaleY", collision.scale.y, document.GetAllocator());
-            collisionComp.AddMember("radius", collision.radius, document.GetAllocator());
-            components.AddMember("CollisionComponent", collisionComp, document.GetAllocator());
+            writer.Key("CollisionComponent");
+            writer.StartObject();
+            writer.Member("type", ObjectTypeToString(collision.type));
+            writer.Member("collided", collision.collided);
+            writer.Member("collisionScaleX", collision.scale.x);
+            writer.Member("collisionScaleY", collision.scale.y);
+            writer.Member("radius", collision.radius);
+            writer.EndObject();
         }
 
         // Serialize EnemyComponent
         if (ecsInterface.HasComponent<EnemyComponent>(entity)) {
             const auto& enemy = ecsInterface.GetComponent<EnemyComponent>(entity);
-            std::cout << "Serializing EnemyComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value enemyComp(rapidjson::kObjectType);
-            enemyComp.AddMember("type", rapidjson::Value(EnemyTypeToString(enemy.type).c_str(), document.GetAllocator()), document.GetAllocator());
-            enemyComp.AddMember("health", enemy.health, document.GetAllocator());
-            enemyComp.AddMember("UpdateFunctionName", rapidjson::Value(enemy.UpdateFunctionName.c_str(), document.GetAllocator()), document.GetAllocator());
-            enemyComp.AddMember("spawned", enemy.spawned, document.GetAllocator());
-            enemyComp.AddMember("spawnRate", enemy.spawnRate, document.GetAllocator());
-            enemyComp.AddMember("spawnTimer", enemy.spawnTimer, document.GetAllocator());
-            components.AddMember("EnemyComponent", enemyComp, document.GetAllocator());
+            writer.Key("EnemyComponent");
+            writer.StartObject();
+            writer.Member("type", EnemyTypeToString(enemy.type));
+            writer.Member("health", enemy.health);
+            writer.Member("UpdateFunctionName", enemy.UpdateFunctionName);
+            writer.Member("spawned", enemy.spawned);
+            writer.Member("spawnRate", enemy.spawnRate);
+            writer.Member("spawnTimer", enemy.spawnTimer);
+            writer.EndObject();
         }
         // Spawner Component
         if (ecsInterface.HasComponent<SpawnerComponent>(entity)) {
             const auto& spawner = ecsInterface.GetComponent<SpawnerComponent>(entity);
-            std::cout << "Serializing SpawnerComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value spawnerComp(rapidjson::kObjectType);
-            spawnerComp.AddMember("accumulatedTime", spawner.accumulatedTime, document.GetAllocator());
-            spawnerComp.AddMember("spawnInterval", spawner.spawnInterval, document.GetAllocator());
-            components.AddMember("SpawnerComponent", spawnerComp, document.GetAllocator());
+            writer.Key("SpawnerComponent");
+            writer.StartObject();
+            writer.Member("accumulatedTime", spawner.accumulatedTime);
+            writer.Member("spawnInterval", spawner.spawnInterval);
+            writer.EndObject();
         }
 
         // Serialize AnimationComponent
         if (ecsInterface.HasComponent<AnimationComponent>(entity)) {
             const auto& animation = ecsInterface.GetComponent<AnimationComponent>(entity);
-            std::cout << "Serializing AnimationComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value animationComp(rapidjson::kObjectType);
-            animationComp.AddMember("animationSpeed", animation.animationSpeed, document.GetAllocator());
-            animationComp.AddMember("rows", animation.rows, document.GetAllocator());
-            animationComp.AddMember("cols", animation.cols, document.GetAllocator());
-            components.AddMember("AnimationComponent", animationComp, document.GetAllocator());
+            writer.Key("AnimationComponent");
+            writer.StartObject();
+            const auto& clips = Framework::GlobalAssetManager.GetAnimationClips();
+            const Framework::AnimationClipHandle clip = clips.GetPlaying(entity);
+            if (clips.IsValid(clip) && !clips.GetName(clip).empty())
+            {
+                writer.Member("clip", clips.GetName(clip));
+            }
+            writer.Member("animationSpeed", animation.animationSpeed);
+            writer.Member("rows", animation.rows);
+            writer.Member("cols", animation.cols);
+            writer.EndObject();
         }
 
         // Serialize BulletComponent
         if (ecsInterface.HasComponent<BulletComponent>(entity)) {
             const auto& bullet = ecsInterface.GetComponent<BulletComponent>(entity);
-            std::cout << "Serializing BulletComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value bulletComp(rapidjson::kObjectType);
-            bulletComp.AddMember("targetId", bullet.targetId, document.GetAllocator());
-            components.AddMember("BulletComponent", bulletComp, document.GetAllocator());
+            writer.Key("BulletComponent");
+            writer.StartObject();
+            writer.Member("targetId", bullet.targetId);
+            writer.EndObject();
         }
 
         // Serialize the ButtonComponent
         if (ecsInterface.HasComponent<ButtonComponent>(entity)) {
             const auto& button = ecsInterface.GetComponent<ButtonComponent>(entity);
-            std::cout << "Serializing ButtonComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value buttonComp(rapidjson::kObjectType);
+            writer.Key("ButtonComponent");
+            writer.StartObject();
 
             // Serialize basic properties
-            buttonComp.AddMember("label", rapidjson::Value(button.label.c_str(), document.GetAllocator()), document.GetAllocator());
-            buttonComp.AddMember("idleTextureID", rapidjson::Value(button.idleTextureID.c_str(), document.GetAllocator()), document.GetAllocator());
-            buttonComp.AddMember("hoverTextureID", rapidjson::Value(button.hoverTextureID.c_str(), document.GetAllocator()), document.GetAllocator());
-            buttonComp.AddMember("pressedTextureID", rapidjson::Value(button.pressedTextureID.c_str(), document.GetAllocator()), document.GetAllocator());
+            writer.Member("label", button.label);
+            writer.Member("idleTextureID", button.idleTextureID);
+            writer.Member("hoverTextureID", button.hoverTextureID);
+            writer.Member("pressedTextureID", button.pressedTextureID);
 
             // Serialize the update function name
-            buttonComp.AddMember("UpdateFunctionName", rapidjson::Value(button.UpdateFunctionName.c_str(), document.GetAllocator()), document.GetAllocator());
-            buttonComp.AddMember("onClick", rapidjson::Value(button.UpdateFunctionName.c_str(), document.GetAllocator()), document.GetAllocator());
+            writer.Member("UpdateFunctionName", button.UpdateFunctionName);
+            writer.Member("onClick", button.UpdateFunctionName);
 
             // Serialize additional properties
-            buttonComp.AddMember("PressedAudio", rapidjson::Value(button.PressedAudio.c_str(), document.GetAllocator()), document.GetAllocator());
-            buttonComp.AddMember("HoverAudio", rapidjson::Value(button.HoverAudio.c_str(), document.GetAllocator()), document.GetAllocator());
-            buttonComp.AddMember("FirstHover", button.FirstHover, document.GetAllocator());
-            buttonComp.AddMember("pressCooldown", button.pressCooldown, document.GetAllocator());
-            buttonComp.AddMember("pressTimeRemaining", button.pressTimeRemaining, document.GetAllocator());
+            writer.Member("PressedAudio", button.PressedAudio);
+            writer.Member("HoverAudio", button.HoverAudio);
+            writer.Member("FirstHover", button.FirstHover);
+            writer.Member("pressCooldown", button.pressCooldown);
+            writer.Member("pressTimeRemaining", button.pressTimeRemaining);
 
             // Serialize button state
             const char* buttonStateStr = nullptr;
@@ -1039,202 +1050,141 @@ void EntityAsset::SerializeEntities(const std::string& filename)
             case ButtonState::Pressed: buttonStateStr = "Pressed"; break;
             }
             if (buttonStateStr) {
-                buttonComp.AddMember("state", rapidjson::Value(buttonStateStr, document.GetAllocator()), document.GetAllocator());
+                writer.Member("state", buttonStateStr);
             }
-
-            // Add the ButtonComponent to the components object
-            components.AddMember("ButtonComponent", buttonComp, document.GetAllocator());
+            writer.EndObject();
         }
 
         // Serialize the TimelineComponent
         if (ecsInterface.HasComponent<TimelineComponent>(entity)) {
             const auto& timeline = ecsInterface.GetComponent<TimelineComponent>(entity);
-            std::cout << "Serializing TimelineComponent for entity: " << entity << std::endl;
-            rapidjson::Value timelineComp(rapidjson::kObjectType);
+            writer.Key("TimelineComponent");
+            writer.StartObject();
 
             // Serialize basic properties
-            timelineComp.AddMember("InternalTimer", timeline.InternalTimer, document.GetAllocator());
-            timelineComp.AddMember("TransitionDuration", timeline.TransitionDuration, document.GetAllocator());
-            timelineComp.AddMember("TransitionInDelay", timeline.TransitionInDelay, document.GetAllocator());
-            timelineComp.AddMember("TransitionOutDelay", timeline.TransitionOutDelay, document.GetAllocator());
-            timelineComp.AddMember("TransitionInFunctionName", rapidjson::Value(timeline.TransitionInFunctionName.c_str(), document.GetAllocator()), document.GetAllocator());
-            timelineComp.AddMember("TransitionOutFunctionName", rapidjson::Value(timeline.TransitionOutFunctionName.c_str(), document.GetAllocator()), document.GetAllocator());
+            writer.Member("InternalTimer", timeline.InternalTimer);
+            writer.Member("TransitionDuration", timeline.TransitionDuration);
+            writer.Member("TransitionInDelay", timeline.TransitionInDelay);
+            writer.Member("TransitionOutDelay", timeline.TransitionOutDelay);
+            writer.Member("TransitionInFunctionName", timeline.TransitionInFunctionName);
+            writer.Member("TransitionOutFunctionName", timeline.TransitionOutFunctionName);
 
             // Serialize active and transition state
-            timelineComp.AddMember("Active", timeline.Active, document.GetAllocator());
-            timelineComp.AddMember("IsTransitioningIn", timeline.IsTransitioningIn, document.GetAllocator());
+            writer.Member("Active", timeline.Active);
+            writer.Member("IsTransitioningIn", timeline.IsTransitioningIn);
 
             // Serialize additional properties
-            timelineComp.AddMember("TimelineTag", rapidjson::Value(timeline.TimelineTag.c_str(), document.GetAllocator()), document.GetAllocator());
-            timelineComp.AddMember("startPosition", timeline.startPosition, document.GetAllocator());
-            timelineComp.AddMember("endPosition", timeline.endPosition, document.GetAllocator());
-
-            // Add the TimelineComponent to the components object
-            components.AddMember("TimelineComponent", timelineComp, document.GetAllocator());
+            writer.Member("TimelineTag", timeline.TimelineTag);
+            writer.Member("startPosition", timeline.startPosition);
+            writer.Member("endPosition", timeline.endPosition);
+            writer.EndObject();
         }
 
-
         // Serialize PlayerComponent
         if (ecsInterface.HasComponent<PlayerComponent>(entity)) {
             const auto& player = ecsInterface.GetComponent<PlayerComponent>(entity);
-            std::cout << "Serializing PlayerComponent for entity: " << entity << std::endl;
-
-            // Create a JSON object for PlayerComponent
-            rapidjson::Value playerComp(rapidjson::kObjectType);
-
-            // Add the "CurrentText" field to the JSON object
-            playerComp.AddMember("CurrentText", rapidjson::Value(player.CurrentText.c_str(), document.GetAllocator()), document.GetAllocator());
-            playerComp.AddMember("type", rapidjson::Value(ObjectTypeToString(player.type).c_str(), document.GetAllocator()), document.GetAllocator());
-            playerComp.AddMember("health", player.health, document.GetAllocator());
-
-            // Add the PlayerComponent object to the components JSON object
-            components.AddMember("PlayerComponent", playerComp, document.GetAllocator());
+            writer.Key("PlayerComponent");
+            writer.StartObject();
+            writer.Member("CurrentText", player.CurrentText);
+            writer.Member("type", ObjectTypeToString(player.type));
+            writer.Member("health", player.health);
+            writer.EndObject();
         }
 
         // Serialize ParticleComponent
         if (ecsInterface.HasComponent<ParticleComponent>(entity)) {
             const auto& particle = ecsInterface.GetComponent<ParticleComponent>(entity);
-            std::cout << "Serializing ParticleComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value particleComp(rapidjson::kObjectType);
-            particleComp.AddMember("positionX", particle.position.x, document.GetAllocator());
-            particleComp.AddMember("positionY", particle.position.y, document.GetAllocator());
-            particleComp.AddMember("velocityX", particle.velocity.x, document.GetAllocator());
-            particleComp.AddMember("velocityY", particle.velocity.y, document.GetAllocator());
-            particleComp.AddMember("colorR", particle.color.r, document.GetAllocator());
-            particleComp.AddMember("colorG", particle.color.g, document.GetAllocator());
-            particleComp.AddMember("colorB", particle.color.b, document.GetAllocator());
-            particleComp.AddMember("size", particle.size, document.GetAllocator());
-            particleComp.AddMember("life", particle.life, document.GetAllocator());
-            particleComp.AddMember("active", particle.active, document.GetAllocator());
-            particleComp.AddMember("emissionRate", particle.emissionRate, document.GetAllocator());
-            
+            writer.Key("ParticleComponent");
+            writer.StartObject();
+            writer.Member("positionX", particle.position.x);
+            writer.Member("positionY", particle.position.y);
+            writer.Member("velocityX", particle.velocity.x);
+            writer.Member("velocityY", particle.velocity.y);
+            writer.Member("colorR", particle.color.r);
+            writer.Member("colorG", particle.color.g);
+            writer.Member("colorB", particle.color.b);
+            writer.Member("size", particle.size);
+            writer.Member("life", particle.life);
+            writer.Member("active", particle.active);
+            writer.Member("emissionRate", particle.emissionRate);
+
             // Serialize texture name
             if (!particle.textureName.empty()) {
-                rapidjson::Value textureNameValue;
-                textureNameValue.SetString(particle.textureName.c_str(), document.GetAllocator());
-                particleComp.AddMember("textureName", textureNameValue, document.GetAllocator());
+                writer.Member("textureName", particle.textureName);
             }
 
             // Store EmissionShape as a string
-            rapidjson::Value shapeStr;
-            std::string shapeName;
-            switch (particle.shape) 
-            {
-                case EmissionShape::CIRCLE: shapeName = "CIRCLE"; break;
-                case EmissionShape::BOX: shapeName = "BOX"; break;
-                case EmissionShape::ELLIPSE: shapeName = "ELLIPSE"; break;
-                case EmissionShape::LINE: shapeName = "LINE"; break;
-                case EmissionShape::SPIRAL: shapeName = "SPIRAL"; break;
-                case EmissionShape::RADIAL: shapeName = "RADIAL"; break;
-                case EmissionShape::RANDOM: shapeName = "RANDOM"; break;
-                case EmissionShape::WAVE: shapeName = "WAVE"; break;
-                case EmissionShape::CONE: shapeName = "CONE"; break;
-                case EmissionShape::EXPLOSION: shapeName = "EXPLOSION"; break;
-            }
-            shapeStr.SetString(shapeName.c_str(), document.GetAllocator());
-            particleComp.AddMember("shape", shapeStr, document.GetAllocator());
+            writer.Member("shape", Framework::EnumToString(particle.shape));
 
             // Save shape-specific data
-            particleComp.AddMember("radius", particle.radius, document.GetAllocator());
-            particleComp.AddMember("boxSizeX", particle.boxSize.x, document.GetAllocator());
-            particleComp.AddMember("boxSizeY", particle.boxSize.y, document.GetAllocator());
-            particleComp.AddMember("spiralTurns", particle.spiralTurns, document.GetAllocator());
-            particleComp.AddMember("coneAngle", particle.coneAngle, document.GetAllocator());
-
-            components.AddMember("ParticleComponent", particleComp, document.GetAllocator());
+            writer.Member("radius", particle.radius);
+            writer.Member("boxSizeX", particle.boxSize.x);
+            writer.Member("boxSizeY", particle.boxSize.y);
+            writer.Member("spiralTurns", particle.spiralTurns);
+            writer.Member("coneAngle", particle.coneAngle);
+            writer.EndObject();
         }
 
         // Serialize UIBarComponent
         if (ecsInterface.HasComponent<UIBarComponent>(entity)) {
             const auto& bar = ecsInterface.GetComponent<UIBarComponent>(entity);
-            std::cout << "Serializing UIBarComponent for entity: " << entity << std::endl;
-
-            rapidjson::Value barComp(rapidjson::kObjectType);
+            writer.Key("UIBarComponent");
+            writer.StartObject();
 
             // Texture IDs
-            rapidjson::Value backingTex;
-            backingTex.SetString(bar.backingTextureID.c_str(), static_cast<rapidjson::SizeType>(bar.backingTextureID.length()), document.GetAllocator());
-            barComp.AddMember("backingTextureID", backingTex, document.GetAllocator());
-
-            rapidjson::Value fillTex;
-            fillTex.SetString(bar.fillTextureID.c_str(), static_cast<rapidjson::SizeType>(bar.fillTextureID.length()), document.GetAllocator());
-            barComp.AddMember("fillTextureID", fillTex, document.GetAllocator());
+            writer.Member("backingTextureID", bar.backingTextureID);
+            writer.Member("fillTextureID", bar.fillTextureID);
 
             // Fill Percentage
-            barComp.AddMember("fillPercentage", bar.FillPercentage, document.GetAllocator());
+            writer.Member("fillPercentage", bar.FillPercentage);
 
             // Offset
-            barComp.AddMember("offsetX", bar.offset.x, document.GetAllocator());
-            barComp.AddMember("offsetY", bar.offset.y, document.GetAllocator());
+            writer.Member("offsetX", bar.offset.x);
+            writer.Member("offsetY", bar.offset.y);
 
             // Scale
-            barComp.AddMember("scaleX", bar.scale.x, document.GetAllocator());
-            barComp.AddMember("scaleY", bar.scale.y, document.GetAllocator());
+            writer.Member("scaleX", bar.scale.x);
+            writer.Member("scaleY", bar.scale.y);
 
             // Fill Color (vec3) + Alpha
-            rapidjson::Value fillColorArray(rapidjson::kArrayType);
-            fillColorArray.PushBack(bar.fillColor.r, document.GetAllocator());
-            fillColorArray.PushBack(bar.fillColor.g, document.GetAllocator());
-            fillColorArray.PushBack(bar.fillColor.b, document.GetAllocator());
-            barComp.AddMember("fillColor", fillColorArray, document.GetAllocator());
-
-            barComp.AddMember("fillAlpha", bar.fillAlpha, document.GetAllocator());
+            writer.ArrayMember("fillColor", bar.fillColor.r, bar.fillColor.g, bar.fillColor.b);
+            writer.Member("fillAlpha", bar.fillAlpha);
 
             // Background Color (vec3) + Alpha
-            rapidjson::Value bgColorArray(rapidjson::kArrayType);
-            bgColorArray.PushBack(bar.bgColor.r, document.GetAllocator());
-            bgColorArray.PushBack(bar.bgColor.g, document.GetAllocator());
-            bgColorArray.PushBack(bar.bgColor.b, document.GetAllocator());
-            barComp.AddMember("bgColor", bgColorArray, document.GetAllocator());
-
-            barComp.AddMember("bgAlpha", bar.bgAlpha, document.GetAllocator());
-
-            components.AddMember("UIBarComponent", barComp, document.GetAllocator());
+            writer.ArrayMember("bgColor", bar.bgColor.r, bar.bgColor.g, bar.bgColor.b);
+            writer.Member("bgAlpha", bar.bgAlpha);
+            writer.EndObject();
         }
 
-        // Add the components to the entity
-        entityObj.AddMember("components", components, document.GetAllocator());
-
-        // Add the entity to the "entities" array
-        entities.PushBack(entityObj, document.GetAllocator());
+        writer.EndObject();     // components
+        writer.EndObject();     // entity
     }
 
-    // Add "entities" array to the document
-    document.AddMember("entities", entities, document.GetAllocator());
+    writer.EndArray();
+    writer.EndObject();
 
-    std::cout << "Writing JSON to file: " << filename << std::endl;
-
-    // Convert document to JSON string and write to file
-    std::ofstream ofs(filename);
-    if (!ofs.is_open()) {
-        std::cerr << "Error: Unable to open file " << filename << " for writing." << std::endl;
+    if (!writer.Commit()) {
+        std::cerr << "Error: Unable to write " << filename << std::endl;
         return;
     }
 
-    rapidjson::OStreamWrapper osw(ofs);
-    rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(osw);
-    document.Accept(writer);
-
-    std::cout << "Entities serialized successfully to " << filename << std::endl;
+    std::cout << "Entities serialized successfully to " << filename << " (" << serializedCount << " entities, "
+        << writer.GetBytesWritten() / 1024 << " KB)" << std::endl;
 }
 
 void EntityAsset::DeserializeAnimation(const std::string& filePath)
 {
-    // Open the file
-    std::ifstream file(filePath);
-    if (!file.is_open())
+    // Read the entire file content into a string
+    std::string jsonContent;
+    if (!Framework::GlobalVirtualFileSystem.ReadFile(filePath, jsonContent))
     {
         std::cerr << "Failed to open file: " << filePath << std::endl;
         return;
     }
 
-    // Read the entire file content into a string
-    std::string jsonContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-
     // Parse the JSON content using RapidJSON
     rapidjson::Document document;
-    document.Parse(jsonContent.c_str());
+    Framework::ParseJson(document, jsonContent);
 
     if (document.HasParseError())
     {
@@ -1260,8 +1210,20 @@ void EntityAsset::DeserializeAnimation(const std::string& filePath)
                 int cols = animation["cols"].GetInt();
                 float animationSpeed = animation["animationSpeed"].GetFloat();
 
-                // Create an Animation object
+                // Optional: sheets with unused cells, and frames held for their own duration
+                int frameCount = animation.HasMember("frames") && animation["frames"].IsInt() ? animation["frames"].GetInt() : 0;
+                std::vector<float> frameDurations;
+                if (animation.HasMember("frameDurations") && animation["frameDurations"].IsArray())
+                {
+                    for (const auto& duration : animation["frameDurations"].GetArray())
+                    {
+                        frameDurations.push_back(duration.IsNumber() ? duration.GetFloat() : 0.0f);
+                    }
+                }
+
+                // Create an Animation object, compiling its frame UVs now rather than every frame
                 Animation newAnimation = { rows, cols, animationSpeed };
+                newAnimation.clip = Framework::GlobalAssetManager.GetAnimationClips().Add(name, rows, cols, animationSpeed, frameCount, frameDurations);
 
                 // Add the animation to the map
                 Framework::GlobalAssetManager.GetAnimationDataMap()[name] = newAnimation;
@@ -1280,16 +1242,15 @@ void EntityAsset::DeserializeAnimation(const std::string& filePath)
 
 void EntityAsset::DeserializeBullet(const std::string& filePath)
 {
-    std::ifstream file(filePath);
-    if (!file)
+    std::string contents;
+    if (!Framework::GlobalVirtualFileSystem.ReadFile(filePath, contents))
     {
         std::cerr << "Failed to open bullet data file: " << filePath << std::endl;
         return;
     }
 
-    rapidjson::IStreamWrapper isw(file);
     rapidjson::Document doc;
-    doc.ParseStream(isw);
+    Framework::ParseJson(doc, contents);
 
     if (doc.HasParseError())
     {
@@ -1341,27 +1302,10 @@ void EntityAsset::DeserializeBullet(const std::string& filePath)
 
 std::string EntityAsset::EnemyTypeToString(EnemyType type)
 {
-    switch (type) 
-    {
-    case EnemyType::Minion: return "Minion";
-    case EnemyType::Boss: return "Boss";
-    case EnemyType::Poison: return "Poison";
-    case EnemyType::MC: return "MC";
-    case EnemyType::Spawner: return "Spawner";
-    case EnemyType::Smoke: return "Smoke";
-        // Add other cases here
-    default: return "Unknown";
-    }
+    return std::string(Framework::EnumToString(type));
 }
 
 std::string EntityAsset::ObjectTypeToString(ObjectType type)
 {
-    switch (type) 
-    {
-    case ObjectType::Enemy: return "Enemy";
-    case ObjectType::CollidableObject: return "CollidableObject";
-    case ObjectType::Player: return "Player";
-    case ObjectType::Bullet: return "Bullet";
-    default: return "Unknown";
-    }
+    return std::string(Framework::EnumToString(type));
 }
\ No newline at end of file
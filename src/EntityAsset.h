@@ -17,6 +17,7 @@
 #include "JsonSerialize.h"
 #include "Coordinator.h"
 #include "ComponentList.h"
+#include "AnimationClip.h"
 
 extern Framework::Coordinator ecsInterface;
 
@@ -34,6 +35,7 @@ public:
         int rows;
         int cols;
         float animationSpeed;
+        Framework::AnimationClipHandle clip = Framework::InvalidAnimationClip;  // Compiled frame tables
     };
 
     struct BulletData
@@ -80,11 +82,24 @@ public:
 
     void DeserializeBullet(const std::string& filePath);
 
+    /**
+     * @brief Schedules the timing wheel timers of an entity's EnemyComponent. Run for every
+     *        deserialized entity, and again when a pooled instance is placed, since parking
+     *        cancels its timers.
+     */
+    static void ScheduleTimers(Framework::Entity entity);
+
     std::string EnemyTypeToString(EnemyType type);
 
     std::string ObjectTypeToString(ObjectType type);
 
+    /**
+     * @brief Entities created by the last DeserializeEntities call, in file order.
+     */
+    const std::vector<Framework::Entity>& GetCreatedEntities() const { return createdEntities; }
+
 private:
+    std::vector<Framework::Entity> createdEntities;
 };
 
 extern EntityAsset GlobalEntityAsset;
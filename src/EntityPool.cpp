@@ -0,0 +1,420 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : EntityPool.cpp
+/// @Brief : Implements the entity pools: instantiation from prefabs or
+///          factories, parking and reactivation, and the pool configuration
+///          file.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "EntityPool.h"
+#include "AssetManager.h"
+#include "EntityAsset.h"
+#include "JsonSerialize.h"
+#include "Metrics.h"
+#include "TargetMatcher.h"
+#include "TransformCache.h"
+#include "TimelineEvaluator.h"
+#include "TimingWheel.h"
+#include "SpatialHash.h"
+#include "VirtualFileSystem.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+
+namespace Framework
+{
+    EntityPool GlobalEntityPool;
+
+    namespace
+    {
+        const glm::vec2 ParkPosition(-100000.0f, -100000.0f);  // Far outside any level, nothing collides there
+    }
+
+    void EntityPool::Initialize()
+    {
+        if (GlobalVirtualFileSystem.Exists("Assets/JsonData/PoolAsset.json"))
+        {
+            LoadConfig("Assets/JsonData/PoolAsset.json");
+        }
+    }
+
+    /*******************/
+    //   Registration  //
+    /*******************/
+
+    void EntityPool::RegisterArchetype(const std::string& name, size_t size, Factory factory, float lifetime)
+    {
+        // Re-registering keeps the instances that already exist
+        Pool& pool = pools[name];
+        pool.factory = std::move(factory);
+        pool.size = size;
+        pool.lifetime = lifetime;
+        pool.freeList.reserve(size);
+    }
+
+    void EntityPool::RegisterPrefab(const std::string& prefabName, size_t size, float lifetime)
+    {
+        RegisterArchetype(prefabName, size, [prefabName]()
+            {
+                EntityAsset asset(GlobalAssetManager.UE_GetPrefabPath(prefabName));
+                return asset.GetCreatedEntities();
+            }, lifetime);
+    }
+
+    void EntityPool::RegisterBullet(size_t size)
+    {
+        RegisterArchetype("Bullet", size, [this]()
+            {
+                const Entity bullet = CreateBullet();
+                return bullet == InvalidEntity ? std::vector<Entity>() : std::vector<Entity>{ bullet };
+            });
+    }
+
+    Entity EntityPool::CreateBullet() const
+    {
+        const EntityAsset::BulletData* data = GlobalAssetManager.GetBulletData("Bullet");
+        if (!data)
+        {
+            std::cerr << "Error: Bullet data not loaded, cannot create pooled bullets." << std::endl;
+            return InvalidEntity;
+        }
+
+        const Entity bullet = ecsInterface.CreateEntity();
+        ecsInterface.SetEntityName(bullet, "Bullet");
+
+        TransformComponent transform;
+        transform.scale = data->scale;
+        transform.tag = "Entity_" + std::to_string(bullet);
+        ecsInterface.AddTag(bullet, transform.tag);
+        ecsInterface.AddComponent<TransformComponent>(bullet, transform);
+
+        RenderComponent render;
+        render.textureID = data->textureID;
+        render.color = data->color;
+        render.alpha = data->alpha;
+        render.renderType = RenderType::Sprite;
+        ecsInterface.AddComponent<RenderComponent>(bullet, render);
+
+        TextComponent text;
+        text.fontName = data->fontName;
+        ecsInterface.AddComponent<TextComponent>(bullet, text);
+
+        MovementComponent movement;
+        movement.baseVelocity = data->baseVelocity;
+        ecsInterface.AddComponent<MovementComponent>(bullet, movement);
+
+        CollisionComponent collision;
+        collision.type = Bullet;
+        collision.scale = data->collisionScale;
+        ecsInterface.AddComponent<CollisionComponent>(bullet, collision);
+
+        ecsInterface.AddComponent<BulletComponent>(bullet, BulletComponent{});
+
+        ParticleComponent particle;
+        particle.textureName = data->particleTexture;
+        particle.life = data->particleLife;
+        particle.size = data->particleSize;
+        particle.color = data->particleColor;
+        particle.emissionRate = data->emissionRate;
+        ecsInterface.AddComponent<ParticleComponent>(bullet, particle);
+
+        GlobalTransformCache.Track(bullet);
+        GlobalSpatialHash.Track(bullet);
+        return bullet;
+    }
+
+    bool EntityPool::LoadConfig(const std::string& filePath)
+    {
+        std::string contents;
+        if (!GlobalVirtualFileSystem.ReadFile(filePath, contents))
+        {
+            std::cerr << "Error: Could not open pool config: " << filePath << std::endl;
+            return false;
+        }
+
+        rapidjson::Document document;
+        ParseJson(document, contents);
+        if (document.HasParseError() || !document.HasMember("pools") || !document["pools"].IsArray())
+        {
+            std::cerr << "Error: Invalid pool config: " << filePath << std::endl;
+            return false;
+        }
+
+        for (const rapidjson::Value& entry : document["pools"].GetArray())
+        {
+            if (!entry.IsObject() || !entry.HasMember("size") || !entry["size"].IsUint())
+            {
+                std::cerr << "Warning: Skipping pool entry without a size in " << filePath << std::endl;
+                continue;
+            }
+            const size_t size = entry["size"].GetUint();
+            const float lifetime = entry.HasMember("lifetime") && entry["lifetime"].IsNumber() ? entry["lifetime"].GetFloat() : 0.0f;
+
+            std::string name;
+            if (entry.HasMember("prefab") && entry["prefab"].IsString())
+            {
+                name = entry["prefab"].GetString();
+                RegisterPrefab(name, size, lifetime);
+            }
+            else if (entry.HasMember("archetype") && entry["archetype"].IsString() && std::string(entry["archetype"].GetString()) == "Bullet")
+            {
+                name = "Bullet";
+                RegisterBullet(size);
+            }
+            else
+            {
+                std::cerr << "Warning: Pool entry needs a prefab or a known archetype in " << filePath << std::endl;
+                continue;
+            }
+
+            Pool& pool = pools[name];
+            pool.scenes.clear();
+            if (entry.HasMember("scenes") && entry["scenes"].IsArray())
+            {
+                for (const rapidjson::Value& scene : entry["scenes"].GetArray())
+                {
+                    if (scene.IsString())
+                    {
+                        pool.scenes.push_back(VirtualFileSystem::Normalize(scene.GetString()));
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    /*******************/
+    //   Lifetime      //
+    /*******************/
+
+    size_t EntityPool::CreateInstance(Pool& pool)
+    {
+        Instance instance;
+        instance.entities = pool.factory();
+        if (instance.entities.empty())
+        {
+            return SIZE_MAX;
+        }
+
+        instance.snapshots.resize(instance.entities.size());
+        for (size_t i = 0; i < instance.entities.size(); ++i)
+        {
+            instance.snapshots[i].Capture(instance.entities[i]);
+        }
+
+        const size_t index = pool.instances.size();
+        for (Entity entity : instance.entities)
+        {
+            owners[entity] = Owner{ &pool, index };
+        }
+        Park(instance);
+        pool.instances.push_back(std::move(instance));
+        return index;
+    }
+
+    void EntityPool::Prewarm(const std::string& scene)
+    {
+        const std::string scenePath = VirtualFileSystem::Normalize(scene);
+        size_t created = 0;
+        for (auto& [name, pool] : pools)
+        {
+            if (!pool.scenes.empty() && std::find(pool.scenes.begin(), pool.scenes.end(), scenePath) == pool.scenes.end())
+            {
+                continue;   // Menus and credits never spawn bullets or popups
+            }
+
+            pool.instances.reserve(pool.size);
+            while (pool.instances.size() < pool.size)
+            {
+                const size_t index = CreateInstance(pool);
+                if (index == SIZE_MAX)
+                {
+                    std::cerr << "Error: Pool " << name << " could not create an instance." << std::endl;
+                    break;
+                }
+                pool.freeList.push_back(index);
+                ++created;
+            }
+        }
+        GlobalMetrics.GetGauge("ue_pooled_entities", "Entities held by the entity pools").Set(static_cast<double>(owners.size()));
+        std::cout << "Entity pools warmed: " << created << " instances." << std::endl;
+    }
+
+    void EntityPool::Clear()
+    {
+        // The entities themselves are destroyed with the scene, only the handles are dropped
+        for (auto& [name, pool] : pools)
+        {
+            pool.instances.clear();
+            pool.freeList.clear();
+            pool.activeCount = 0;
+        }
+        owners.clear();
+    }
+
+    void EntityPool::Park(Instance& instance)
+    {
+        for (Entity entity : instance.entities)
+        {
+            if (ecsInterface.HasComponent<RenderComponent>(entity))
+                ecsInterface.GetComponent<RenderComponent>(entity).isActive = false;
+            if (ecsInterface.HasComponent<TransformComponent>(entity))
+                ecsInterface.GetComponent<TransformComponent>(entity).position = ParkPosition;
+            if (ecsInterface.HasComponent<MovementComponent>(entity))
+                ecsInterface.GetComponent<MovementComponent>(entity).velocity = glm::vec2(0.0f);
+            if (ecsInterface.HasComponent<CollisionComponent>(entity))
+                ecsInterface.GetComponent<CollisionComponent>(entity).collided = false;
+            if (ecsInterface.HasComponent<TimelineComponent>(entity))
+                ecsInterface.GetComponent<TimelineComponent>(entity).Active = false;
+            GlobalTimelineEvaluator.Stop(entity);
+            GlobalTimingWheel.CancelEntity(entity);
+            GlobalUITimingWheel.CancelEntity(entity);
+            if (ecsInterface.HasComponent<ParticleComponent>(entity))
+                ecsInterface.GetComponent<ParticleComponent>(entity).active = false;
+            GlobalTargetMatcher.RemoveTarget(entity);
+            GlobalTransformCache.MarkDirty(entity);
+            GlobalSpatialHash.Untrack(entity);     // Parked instances collide with nothing
+        }
+        instance.active = false;
+    }
+
+    void EntityPool::RestoreValue(TimelineComponent& live, const TimelineComponent& saved)
+    {
+        live.InternalTimer = saved.InternalTimer;
+        live.TransitionDuration = saved.TransitionDuration;
+        live.TransitionInDelay = saved.TransitionInDelay;
+        live.TransitionOutDelay = saved.TransitionOutDelay;
+        live.Active = saved.Active;
+        live.IsTransitioningIn = saved.IsTransitioningIn;
+    }
+
+    void EntityPool::Place(Instance& instance, glm::vec2 position)
+    {
+        for (size_t i = 0; i < instance.entities.size(); ++i)
+        {
+            const Entity entity = instance.entities[i];
+            instance.snapshots[i].Restore(entity);
+
+            // Same rule as prefab loading: a valid position overrides every entity's own
+            if (position.x != -1 && position.y != -1 && ecsInterface.HasComponent<TransformComponent>(entity))
+                ecsInterface.GetComponent<TransformComponent>(entity).position = position;
+            GlobalTransformCache.MarkDirty(entity);
+            GlobalSpatialHash.Track(entity);
+            EntityAsset::ScheduleTimers(entity);    // Parking cancelled them
+
+            if (ecsInterface.HasComponent<EnemyComponent>(entity) && ecsInterface.HasComponent<TextComponent>(entity))
+            {
+                const std::string& word = ecsInterface.GetComponent<TextComponent>(entity).text;
+                if (!word.empty())
+                    GlobalTargetMatcher.AddTarget(entity, word);
+            }
+        }
+        instance.active = true;
+    }
+
+    Entity EntityPool::Spawn(const std::string& name, glm::vec2 position)
+    {
+        auto it = pools.find(name);
+        if (it == pools.end())
+        {
+            std::cerr << "Error: No entity pool named " << name << std::endl;
+            return InvalidEntity;
+        }
+
+        Pool& pool = it->second;
+        size_t index;
+        if (!pool.freeList.empty())
+        {
+            index = pool.freeList.back();
+            pool.freeList.pop_back();
+        }
+        else
+        {
+            // Exhausted, grow by one; the configured size is too small if this happens often
+            index = CreateInstance(pool);
+            if (index == SIZE_MAX)
+            {
+                return InvalidEntity;
+            }
+            GlobalMetrics.GetCounter("ue_pool_grow_total", "Entity pool instances created after prewarm").Increment();
+        }
+
+        Instance& instance = pool.instances[index];
+        Place(instance, position);
+        instance.timeLeft = pool.lifetime;
+        ++pool.activeCount;
+        return instance.entities.front();
+    }
+
+    bool EntityPool::Despawn(Entity entity)
+    {
+        auto it = owners.find(entity);
+        if (it == owners.end())
+        {
+            return false;
+        }
+
+        Pool& pool = *it->second.pool;
+        Instance& instance = pool.instances[it->second.instance];
+        if (!instance.active)
+        {
+            return false;
+        }
+
+        Park(instance);
+        pool.freeList.push_back(it->second.instance);
+        --pool.activeCount;
+        return true;
+    }
+
+    bool EntityPool::IsActive(Entity entity) const
+    {
+        auto it = owners.find(entity);
+        return it == owners.end() || it->second.pool->instances[it->second.instance].active;
+    }
+
+    float EntityPool::GetLifetime(const std::string& name) const
+    {
+        auto it = pools.find(name);
+        return it == pools.end() ? 0.0f : it->second.lifetime;
+    }
+
+    size_t EntityPool::GetActiveCount(const std::string& name) const
+    {
+        auto it = pools.find(name);
+        return it == pools.end() ? 0 : it->second.activeCount;
+    }
+
+    size_t EntityPool::GetFreeCount(const std::string& name) const
+    {
+        auto it = pools.find(name);
+        return it == pools.end() ? 0 : it->second.freeList.size();
+    }
+
+    void EntityPool::Update(float deltaTime)
+    {
+        for (auto& [name, pool] : pools)
+        {
+            if (pool.lifetime <= 0.0f || pool.activeCount == 0)
+            {
+                continue;
+            }
+
+            for (size_t index = 0; index < pool.instances.size(); ++index)
+            {
+                Instance& instance = pool.instances[index];
+                if (instance.active && (instance.timeLeft -= deltaTime) <= 0.0f)
+                {
+                    Park(instance);
+                    pool.freeList.push_back(index);
+                    --pool.activeCount;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : EntityPool.h
+/// @Brief : Declares EntityPool, which keeps pre-instantiated copies of
+///          short-lived prefabs and archetypes (bullets, text popups,
+///          warning overlays). Every instance is created once when a scene
+///          loads, its component values are captured, and it is parked:
+///          hidden, stopped and moved off-screen. Spawning restores the
+///          captured values over the live components, places the instance
+///          and shows it; despawning parks it again. Neither touches the
+///          ECS entity lists nor allocates once the pool is warm.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _ENTITY_POOL_H_
+#define _ENTITY_POOL_H_
+#include "pch.h"
+#include "System.h"
+#include "Coordinator.h"
+#include "ComponentList.h"
+#include <glm.hpp>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework
+{
+    /**
+     * @class EntityPool
+     * @brief Named pools of recycled entities. Pooled entities must be returned with
+     *        Despawn(), never destroyed; the pools are dropped when the scene is cleared.
+     */
+    class EntityPool : public ISystem
+    {
+    public:
+        static constexpr Entity InvalidEntity = std::numeric_limits<Entity>::max();
+
+        /**
+         * @brief Creates one instance of an archetype and returns its entities, the first
+         *        one being the instance's main entity.
+         */
+        using Factory = std::function<std::vector<Entity>()>;
+
+        /**
+         * @brief Registers a pool of prefab instances, keyed by the prefab file name
+         *        (e.g. "Great_Text.json").
+         * @param size Instances created when a scene loads.
+         * @param lifetime Seconds until an instance despawns by itself, 0 to keep it until Despawn().
+         */
+        void RegisterPrefab(const std::string& prefabName, size_t size, float lifetime = 0.0f);
+
+        /**
+         * @brief Registers a pool of instances built by code rather than from a prefab file.
+         */
+        void RegisterArchetype(const std::string& name, size_t size, Factory factory, float lifetime = 0.0f);
+
+        /**
+         * @brief Registers the "Bullet" archetype, built from the bullet data in BulletAsset.json.
+         */
+        void RegisterBullet(size_t size);
+
+        /**
+         * @brief Reads the pool sizes from a JSON file, replacing any earlier registration
+         *        with the same name.
+         */
+        bool LoadConfig(const std::string& filePath = "Assets/JsonData/PoolAsset.json");
+
+        /**
+         * @brief Instantiates the pools used by a scene up to their size. Called after a scene
+         *        loads; pools the scene does not use stay empty and grow on first Spawn().
+         */
+        void Prewarm(const std::string& scene);
+
+        /**
+         * @brief Forgets every instance. Called when the scene's entities are cleared.
+         */
+        void Clear();
+
+        /**
+         * @brief Activates a parked instance. Component values are restored into the
+         *        existing components and word buffers, so after an instance has been used once
+         *        only an exhausted pool, which creates a new instance, allocates.
+         * @param position Where the instance's entities are placed, (-1, -1) to keep the
+         *        prefab's own positions.
+         * @return The instance's main entity, InvalidEntity if the pool does not exist.
+         */
+        Entity Spawn(const std::string& name, glm::vec2 position = glm::vec2(-1, -1));
+
+        /**
+         * @brief Parks the instance owning the entity.
+         * @return False if the entity is not pooled or already parked.
+         */
+        bool Despawn(Entity entity);
+
+        bool HasPool(const std::string& name) const { return pools.count(name) != 0; }
+
+        /**
+         * @brief Seconds an instance of the pool stays active, 0 if it waits for Despawn().
+         */
+        float GetLifetime(const std::string& name) const;
+        bool IsPooled(Entity entity) const { return owners.count(entity) != 0; }
+
+        /**
+         * @brief False only for entities parked in a pool, systems skip those.
+         */
+        bool IsActive(Entity entity) const;
+
+        size_t GetActiveCount(const std::string& name) const;
+        size_t GetFreeCount(const std::string& name) const;
+
+        // ISystem overrides
+        void Initialize() override;
+        void Update(float deltaTime) override;     // Despawns instances whose lifetime ran out
+        std::string GetName() override { return "EntityPool"; }
+
+    private:
+        // Component values captured right after an entity is created, restored on every spawn
+        template <typename... Components>
+        struct Snapshot
+        {
+            std::tuple<std::optional<Components>...> values;
+
+            void Capture(Entity entity)
+            {
+                (CaptureOne<Components>(entity), ...);
+            }
+
+            void Restore(Entity entity) const
+            {
+                (RestoreOne<Components>(entity), ...);
+            }
+
+        private:
+            template <typename T>
+            void CaptureOne(Entity entity)
+            {
+                if (ecsInterface.HasComponent<T>(entity))
+                    std::get<std::optional<T>>(values) = ecsInterface.GetComponent<T>(entity);
+            }
+
+            template <typename T>
+            void RestoreOne(Entity entity) const
+            {
+                if (const auto& value = std::get<std::optional<T>>(values))
+                    RestoreValue(ecsInterface.GetComponent<T>(entity), *value);
+            }
+        };
+
+        // Copy assignment reuses the live component's string and vector capacity
+        template <typename T>
+        static void RestoreValue(T& live, const T& saved) { live = saved; }
+
+        // Copying the transition std::functions would allocate, and they never change
+        static void RestoreValue(TimelineComponent& live, const TimelineComponent& saved);
+
+        using ComponentSnapshot = Snapshot<TransformComponent, RenderComponent, TextComponent, LayerComponent,
+            MovementComponent, CollisionComponent, BulletComponent, TimelineComponent, ParticleComponent,
+            AnimationComponent, EnemyComponent>;
+
+        struct Instance
+        {
+            std::vector<Entity> entities;
+            std::vector<ComponentSnapshot> snapshots;   // One per entity
+            bool active = false;
+            float timeLeft = 0.0f;
+        };
+
+        struct Pool
+        {
+            Factory factory;
+            size_t size = 0;
+            float lifetime = 0.0f;
+            std::vector<std::string> scenes;    // Scenes the pool is prewarmed in, every scene if empty
+            std::vector<Instance> instances;
+            std::vector<size_t> freeList;   // Parked instances, reserved to the pool size
+            size_t activeCount = 0;
+        };
+
+        struct Owner
+        {
+            Pool* pool;
+            size_t instance;
+        };
+
+        size_t CreateInstance(Pool& pool);
+        void Park(Instance& instance);
+        void Place(Instance& instance, glm::vec2 position);
+        Entity CreateBullet() const;
+
+        std::unordered_map<std::string, Pool> pools;
+        std::unordered_map<Entity, Owner> owners;   // Every pooled entity, active or parked
+    };
+
+    extern EntityPool GlobalEntityPool;     // Global instance of the EntityPool system
+}
+#endif // !_ENTITY_POOL_H_
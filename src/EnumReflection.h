@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : EnumReflection.h
+/// @Brief : Compile time string <-> enum conversion shared by the
+///          serializers. An enum opts in by specializing EnumTraits with a
+///          constexpr array of { value, name } entries. From that table the
+///          compiler builds:
+///            - a dense name array indexed by the enum value (enum -> string
+///              is one bounds check and one load)
+///            - a perfect hash over the names, with the seed searched at
+///              compile time (string -> enum is one hash and one compare)
+///          Adding an enumerator only means adding its entry.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _ENUM_REFLECTION_H_
+#define _ENUM_REFLECTION_H_
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace Framework
+{
+    /**
+     * @brief One name of an enum value. A value may have several names (aliases);
+     *        the first one listed is used when converting to a string.
+     */
+    template <typename E>
+    struct EnumEntry
+    {
+        E value;
+        std::string_view name;
+    };
+
+    /**
+     * @brief Specialize with: static constexpr std::array<EnumEntry<E>, N> entries = { ... };
+     */
+    template <typename E>
+    struct EnumTraits;
+
+    namespace EnumDetail
+    {
+        constexpr size_t MaxDenseRange = 256;   // Largest value range given a dense name array
+        constexpr uint32_t MaxSeeds = 4096;     // Hash seeds tried before the build fails
+
+        template <typename E>
+        constexpr const auto& Entries() { return EnumTraits<E>::entries; }
+
+        template <typename E>
+        constexpr size_t EntryCount = std::tuple_size_v<std::decay_t<decltype(EnumTraits<E>::entries)>>;
+
+        template <typename E>
+        constexpr long long ValueOf(E value) { return static_cast<long long>(value); }
+
+        constexpr uint32_t Hash(std::string_view name, uint32_t seed)
+        {
+            uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+            for (char c : name)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 16777619u;
+            }
+            return hash ^ (hash >> 15);
+        }
+
+        template <typename E>
+        constexpr long long MinValue()
+        {
+            long long lowest = ValueOf(Entries<E>()[0].value);
+            for (const auto& entry : Entries<E>())
+                lowest = ValueOf(entry.value) < lowest ? ValueOf(entry.value) : lowest;
+            return lowest;
+        }
+
+        template <typename E>
+        constexpr long long MaxValue()
+        {
+            long long highest = ValueOf(Entries<E>()[0].value);
+            for (const auto& entry : Entries<E>())
+                highest = ValueOf(entry.value) > highest ? ValueOf(entry.value) : highest;
+            return highest;
+        }
+
+        template <typename E>
+        constexpr size_t NameSlots = static_cast<size_t>(MaxValue<E>() - MinValue<E>() + 1);
+
+        template <typename E>
+        constexpr std::array<std::string_view, NameSlots<E>> MakeNames()
+        {
+            std::array<std::string_view, NameSlots<E>> names{};
+            for (const auto& entry : Entries<E>())
+            {
+                std::string_view& slot = names[static_cast<size_t>(ValueOf(entry.value) - MinValue<E>())];
+                if (slot.empty())
+                    slot = entry.name;  // First name wins, later ones are aliases
+            }
+            return names;
+        }
+
+        // Smallest power of two with at least twice as many slots as names, so a seed is found quickly
+        template <typename E>
+        constexpr size_t HashSlots()
+        {
+            size_t slots = 1;
+            while (slots < EntryCount<E> * 2)
+                slots <<= 1;
+            return slots;
+        }
+
+        template <typename E>
+        struct HashTable
+        {
+            uint32_t seed = 0;
+            bool found = false;
+            std::array<uint8_t, HashSlots<E>()> slots{};    // Entry index + 1, 0 for an empty slot
+        };
+
+        template <typename E>
+        constexpr HashTable<E> MakeHashTable()
+        {
+            HashTable<E> table{};
+            for (uint32_t seed = 0; seed < MaxSeeds; ++seed)
+            {
+                table.slots = {};
+                bool collided = false;
+                for (size_t i = 0; i < EntryCount<E> && !collided; ++i)
+                {
+                    uint8_t& slot = table.slots[Hash(Entries<E>()[i].name, seed) & (HashSlots<E>() - 1)];
+                    collided = slot != 0;
+                    slot = static_cast<uint8_t>(i + 1);
+                }
+                if (!collided)
+                {
+                    table.seed = seed;
+                    table.found = true;
+                    return table;
+                }
+            }
+            return table;
+        }
+
+        template <typename E>
+        inline constexpr auto Names = MakeNames<E>();
+
+        template <typename E>
+        inline constexpr auto Lookup = MakeHashTable<E>();
+    }
+
+    /**
+     * @brief Name of an enum value.
+     * @param fallback Returned for values without an entry.
+     */
+    template <typename E>
+    constexpr std::string_view EnumToString(E value, std::string_view fallback = "Unknown")
+    {
+        static_assert(EnumDetail::NameSlots<E> <= EnumDetail::MaxDenseRange, "Enum values too sparse for a dense name table");
+        const long long index = EnumDetail::ValueOf(value) - EnumDetail::MinValue<E>();
+        if (index < 0 || index >= static_cast<long long>(EnumDetail::NameSlots<E>))
+            return fallback;
+        const std::string_view name = EnumDetail::Names<E>[static_cast<size_t>(index)];
+        return name.empty() ? fallback : name;
+    }
+
+    /**
+     * @brief Looks up an enum value by name (case sensitive).
+     * @return False, leaving out untouched, if no entry has that name.
+     */
+    template <typename E>
+    constexpr bool TryEnumFromString(std::string_view name, E& out)
+    {
+        static_assert(EnumDetail::EntryCount<E> < 255, "Too many names for the 8-bit hash slots");
+        static_assert(EnumDetail::Lookup<E>.found, "No perfect hash seed found, are two names the same?");
+        const auto& table = EnumDetail::Lookup<E>;
+        const uint8_t slot = table.slots[EnumDetail::Hash(name, table.seed) & (table.slots.size() - 1)];
+        if (slot == 0 || EnumDetail::Entries<E>()[slot - 1].name != name)
+            return false;
+        out = EnumDetail::Entries<E>()[slot - 1].value;
+        return true;
+    }
+
+    /**
+     * @brief Looks up an enum value by name, returning the fallback for unknown names.
+     */
+    template <typename E>
+    constexpr E EnumFromString(std::string_view name, E fallback)
+    {
+        TryEnumFromString(name, fallback);
+        return fallback;
+    }
+}
+#endif // !_ENUM_REFLECTION_H_
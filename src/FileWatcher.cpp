@@ -0,0 +1,600 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : FileWatcher.cpp
+/// @Brief : Implements the FileWatcher system. A background thread collects
+///          file change events under the Assets folder, Update() debounces
+///          them, maps each changed file to the asset that owns it and hands
+///          the reload to a worker thread. The worker does the expensive part
+///          (decoding images, parsing JSON, building tries) and returns a
+///          small apply step that swaps the result into the AssetManager on
+///          the main thread, so OpenGL calls and ECS changes stay single
+///          threaded and a running scene never sees a half loaded asset.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "FileWatcher.h"
+#include "AssetManager.h"
+#include "TextureImport.h"
+#include "SceneManager.h"
+#include "Metrics.h"
+#include "RenderQueue.h"
+#include "SpriteBatcher.h"
+#include "VirtualFileSystem.h"
+#include <filesystem>
+#include <iostream>
+#include <memory>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Framework
+{
+    FileWatcher GlobalFileWatcher;
+
+    FileWatcher::~FileWatcher()
+    {
+        Shutdown();
+    }
+
+    void FileWatcher::Initialize()
+    {
+        RebuildPathMap();
+
+        if (!std::filesystem::exists(rootDirectory))
+        {
+            std::cerr << "FileWatcher: directory not found: " << rootDirectory << std::endl;
+            return;
+        }
+
+        running = true;
+        watchThread = std::thread(&FileWatcher::WatchThread, this);
+        std::cout << "FileWatcher initialized, watching " << rootDirectory << std::endl;
+    }
+
+    void FileWatcher::Shutdown()
+    {
+        running = false;
+        if (watchThread.joinable())
+        {
+            watchThread.join();
+        }
+
+        // Let outstanding reloads finish, their results are discarded
+        for (auto& reload : inFlight)
+        {
+            if (reload.future.valid())
+            {
+                reload.future.wait();
+            }
+        }
+        inFlight.clear();
+    }
+
+    std::string FileWatcher::NormalizePath(const std::string& path)
+    {
+        std::filesystem::path normalized = std::filesystem::path(path).lexically_normal();
+        if (normalized.is_absolute())
+        {
+            normalized = normalized.lexically_relative(std::filesystem::current_path());
+        }
+        return normalized.generic_string();
+    }
+
+    void FileWatcher::RebuildPathMap()
+    {
+        std::unordered_map<std::string, AssetKind> newMap;
+
+        // Textures, several names may share one image file
+        for (const auto& [name, texture] : GlobalAssetManager.UE_GetAllTextureAssets())
+        {
+            newMap[NormalizePath(texture.path)] = AssetKind::Texture;
+        }
+        newMap[NormalizePath("Assets/JsonData/TextureAsset.json")] = AssetKind::TextureManifest;
+        newMap[NormalizePath("Assets/JsonData/AudioAsset.json")] = AssetKind::AudioManifest;
+
+        // Shaders are keyed by the file path they were loaded from
+        for (const auto& [path, source] : GlobalAssetManager.GetGraphicShaderSources())
+        {
+            newMap[NormalizePath(path)] = AssetKind::Shader;
+        }
+        for (const auto& [path, source] : GlobalAssetManager.GetFontShaderSources())
+        {
+            newMap[NormalizePath(path)] = AssetKind::Shader;
+        }
+        for (const auto& [name, source] : GlobalAssetManager.GetFontSources())
+        {
+            newMap[NormalizePath(source.path)] = AssetKind::Font;
+        }
+
+        // Lexicon word lists
+        if (!GlobalAssetManager.GetDictionaryPath().empty())
+        {
+            newMap[NormalizePath(GlobalAssetManager.GetDictionaryPath())] = AssetKind::Dictionary;
+        }
+        if (!GlobalAssetManager.GetPrefixPath().empty())
+        {
+            newMap[NormalizePath(GlobalAssetManager.GetPrefixPath())] = AssetKind::Prefixes;
+        }
+        if (!GlobalAssetManager.GetNSFWPath().empty())
+        {
+            newMap[NormalizePath(GlobalAssetManager.GetNSFWPath())] = AssetKind::NSFW;
+        }
+
+        std::lock_guard<std::mutex> lock(mapMutex);
+        pathMap = std::move(newMap);
+    }
+
+    void FileWatcher::AddListener(AssetKind kind, ReloadListener listener)
+    {
+        listeners[static_cast<int>(kind)].push_back(std::move(listener));
+    }
+
+    void FileWatcher::NotifyChanged(const std::string& path)
+    {
+        // Editors often write a file several times in a row, only the last event counts
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        pendingChanges[NormalizePath(path)] = Clock::now();
+    }
+
+    void FileWatcher::IgnoreOwnWrite(const std::string& path)
+    {
+        std::error_code error;
+        const auto writeTime = std::filesystem::last_write_time(path, error);
+        if (error)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        ownWrites[NormalizePath(path)] = writeTime;
+    }
+
+    bool FileWatcher::IsOwnWrite(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex);
+        auto it = ownWrites.find(path);
+        if (it == ownWrites.end())
+        {
+            return false;
+        }
+
+        // Written again since the engine saved it, by someone else
+        std::error_code error;
+        const bool unchanged = std::filesystem::last_write_time(path, error) == it->second && !error;
+        ownWrites.erase(it);
+        return unchanged;
+    }
+
+    void FileWatcher::Update(float deltaTime)
+    {
+        (void)deltaTime;
+
+        // Collect files that have been quiet for the debounce interval
+        std::vector<std::string> ready;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            const auto now = Clock::now();
+            for (auto it = pendingChanges.begin(); it != pendingChanges.end();)
+            {
+                if (std::chrono::duration<float>(now - it->second).count() >= debounceSeconds)
+                {
+                    ready.push_back(it->first);
+                    it = pendingChanges.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        for (const std::string& path : ready)
+        {
+            // Temp files of atomic saves, only the rename onto the target matters
+            if (path.size() > 4 && path.compare(path.size() - 4, 4, ".tmp") == 0)
+            {
+                continue;
+            }
+
+            // The index only learns about files written outside the engine from here
+            GlobalVirtualFileSystem.Refresh(path);
+
+            // The engine's own save, reloading would reset the scene being edited
+            if (IsOwnWrite(path))
+            {
+                continue;
+            }
+
+            AssetHandle handle{ AssetKind::Texture, path };
+            {
+                std::lock_guard<std::mutex> lock(mapMutex);
+                auto it = pathMap.find(path);
+                if (it != pathMap.end())
+                {
+                    handle.kind = it->second;
+                }
+                else if (path.rfind("Assets/Scene/", 0) == 0)
+                {
+                    handle.kind = AssetKind::Scene;
+                }
+                else if (path.rfind("Assets/Prefabs/", 0) == 0)
+                {
+                    handle.kind = AssetKind::Prefab;
+                }
+                else
+                {
+                    continue;   // Not an asset the engine has loaded
+                }
+            }
+            Dispatch(handle);
+        }
+
+        // Apply finished reloads at the frame boundary
+        for (auto it = inFlight.begin(); it != inFlight.end();)
+        {
+            if (it->future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                ++it;
+                continue;
+            }
+
+            ReloadResult result = it->future.get();
+            it = inFlight.erase(it);
+
+            if (result.apply)
+            {
+                result.apply();
+                GlobalMetrics.GetCounter("ue_hot_reloads_total", "Assets reloaded after a file change").Increment();
+            }
+            else if (result.handle.kind != AssetKind::Prefab)
+            {
+                continue;   // Reload failed, the previous asset stays in use
+            }
+
+            if (result.handle.kind == AssetKind::TextureManifest || result.handle.kind == AssetKind::AudioManifest)
+            {
+                RebuildPathMap();
+            }
+
+            auto listenerIt = listeners.find(static_cast<int>(result.handle.kind));
+            if (listenerIt != listeners.end())
+            {
+                for (auto& listener : listenerIt->second)
+                {
+                    listener(result.handle);
+                }
+            }
+        }
+    }
+
+    void FileWatcher::Dispatch(const AssetHandle& handle)
+    {
+        // One reload per file at a time, so an older result can never overwrite a newer one
+        for (const auto& reload : inFlight)
+        {
+            if (reload.path == handle.path)
+            {
+                NotifyChanged(handle.path);
+                return;
+            }
+        }
+
+        std::cout << "FileWatcher: reloading " << handle.path << std::endl;
+        inFlight.push_back({ handle.path, std::async(std::launch::async, &FileWatcher::LoadOnWorker, handle) });
+    }
+
+    FileWatcher::ReloadResult FileWatcher::LoadOnWorker(AssetHandle handle)
+    {
+        ReloadResult result{ handle, nullptr };
+        const std::string path = handle.path;
+
+        switch (handle.kind)
+        {
+        case AssetKind::Texture:
+        {
+            std::vector<uint8_t> encoded;
+            GlobalVirtualFileSystem.ReadFile(path, encoded);
+            int width = 0, height = 0, nrChannels = 0;
+            std::shared_ptr<unsigned char> pixels(stbi_load_from_memory(encoded.data(), static_cast<int>(encoded.size()), &width, &height, &nrChannels, 4), stbi_image_free);
+            if (!pixels)
+            {
+                std::cerr << "FileWatcher: failed to decode " << path << std::endl;
+                break;
+            }
+            // Same layout as the loader, converted here so the main thread only uploads
+            nrChannels = 4;
+            TextureImport::Normalize(pixels.get(), static_cast<size_t>(width) * height);
+            result.apply = [path, pixels, width, height, nrChannels]()
+            {
+                GlobalAssetManager.UE_ReloadTextureFile(path, pixels.get(), width, height, nrChannels);
+            };
+            break;
+        }
+        case AssetKind::TextureManifest:
+        {
+            auto textures = std::make_shared<std::unordered_map<std::string, TextureAsset::Texture>>();
+            TextureAsset::Deserialize(path, *textures);
+            if (textures->empty())
+            {
+                break;  // Keep the current textures if the manifest is mid-edit or invalid
+            }
+            result.apply = [textures]()
+            {
+                GlobalAssetManager.UE_ApplyTextureManifest(std::move(*textures));
+            };
+            break;
+        }
+        case AssetKind::AudioManifest:
+        {
+            auto audio = std::make_shared<std::unordered_map<std::string, AudioAsset::MusicAsset>>();
+            AudioAsset::DeserializeAudio(path, *audio);
+            if (audio->empty())
+            {
+                break;
+            }
+            result.apply = [audio]()
+            {
+                GlobalAssetManager.UE_ApplyAudioManifest(std::move(*audio));
+            };
+            break;
+        }
+        case AssetKind::Shader:
+        {
+            auto source = std::make_shared<std::string>();
+            if (!GlobalVirtualFileSystem.ReadFile(path, *source))
+            {
+                std::cerr << "FileWatcher: failed to open " << path << std::endl;
+                break;
+            }
+            result.apply = [source, handle]()
+            {
+                // Shader sources are cached under the path they were loaded with. Programs built
+                // in the engine are relinked on the GL thread; other renderers rebuild from listeners
+                for (const auto& [loadedPath, cached] : GlobalAssetManager.GetGraphicShaderSources())
+                {
+                    if (NormalizePath(loadedPath) == handle.path)
+                    {
+                        const std::string shaderPath = loadedPath;
+                        GlobalAssetManager.UE_ReplaceShaderSource(shaderPath, *source);
+                        GlobalRenderQueue.Execute([&shaderPath]() { SpriteBatcher::ReloadShaders(shaderPath); });
+                        return;
+                    }
+                }
+                for (const auto& [loadedPath, cached] : GlobalAssetManager.GetFontShaderSources())
+                {
+                    if (NormalizePath(loadedPath) == handle.path)
+                    {
+                        GlobalAssetManager.UE_ReplaceShaderSource(loadedPath, *source);
+                        return;
+                    }
+                }
+            };
+            break;
+        }
+        case AssetKind::Font:
+            // FreeType rasterizes straight into GL textures, so the whole reload runs on the main thread
+            result.apply = [handle]()
+            {
+                for (const auto& [name, source] : GlobalAssetManager.GetFontSources())
+                {
+                    if (NormalizePath(source.path) == handle.path)
+                    {
+                        GlobalAssetManager.UE_ReloadFont(name);
+                    }
+                }
+            };
+            break;
+        case AssetKind::Scene:
+        {
+            // Only validate here, entities have to be created on the main thread
+            std::string contents;
+            GlobalVirtualFileSystem.ReadFile(path, contents);
+            rapidjson::Document document;
+            ParseJson(document, contents);
+            if (document.HasParseError())
+            {
+                std::cerr << "FileWatcher: " << path << " is not valid JSON, keeping the current scene" << std::endl;
+                break;
+            }
+            result.apply = [handle]()
+            {
+                if (NormalizePath(GlobalSceneManager.currentScene) == handle.path && !GlobalSceneManager.IsSceneTransitioning())
+                {
+                    GlobalSceneManager.TransitionToScene(GlobalSceneManager.currentScene);
+                }
+            };
+            break;
+        }
+        case AssetKind::Prefab:
+            // Prefabs are read from disk on every spawn, listeners are still notified
+            break;
+        case AssetKind::Dictionary:
+        case AssetKind::NSFW:
+        {
+            if (Lexicon::GetInstance() && Lexicon::GetInstance()->UsesLocalePack())
+            {
+                // The pack is recompiled from the changed list on the locale loader's own worker
+                result.apply = []() { Lexicon::GetInstance()->ReloadLocale(); };
+                break;
+            }
+            const bool isDictionary = handle.kind == AssetKind::Dictionary;
+            const std::vector<std::string> words = AssetManager::ParseWordArray(path, isDictionary ? "words" : "nsfw", true);
+            if (words.empty())
+            {
+                break;
+            }
+            auto trie = std::make_shared<Trie>();
+            for (const std::string& word : words)
+            {
+                trie->insert(word);
+            }
+            trie->finalize();       // Build the word list and index here rather than on first use
+            auto anagrams = std::make_shared<AnagramIndex>();
+            if (isDictionary)
+            {
+                anagrams->Build(trie->getAllWords());
+            }
+            result.apply = [trie, anagrams, isDictionary]()
+            {
+                if (isDictionary)
+                {
+                    GlobalAssetManager.UE_ReplaceDictionary(*trie, std::move(*anagrams));
+                }
+                else
+                {
+                    GlobalAssetManager.UE_ReplaceNSFW(*trie);
+                }
+            };
+            break;
+        }
+        case AssetKind::Prefixes:
+        {
+            if (Lexicon::GetInstance() && Lexicon::GetInstance()->UsesLocalePack())
+            {
+                result.apply = []() { Lexicon::GetInstance()->ReloadLocale(); };
+                break;
+            }
+            auto prefixes = std::make_shared<std::vector<std::string>>(AssetManager::ParseWordArray(path, "prefixes", false));
+            if (prefixes->empty())
+            {
+                break;
+            }
+            result.apply = [prefixes]()
+            {
+                GlobalAssetManager.UE_ReplacePrefixes(std::move(*prefixes));
+            };
+            break;
+        }
+        }
+
+        return result;
+    }
+
+#if defined(__linux__)
+    void FileWatcher::WatchThread()
+    {
+        int fd = inotify_init1(IN_NONBLOCK);
+        if (fd < 0)
+        {
+            std::cerr << "FileWatcher: inotify unavailable, falling back to polling" << std::endl;
+            PollThread();
+            return;
+        }
+
+        const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+        std::unordered_map<int, std::string> watchedDirectories;    // Watch descriptor to directory
+
+        auto addWatch = [&](const std::string& directory)
+        {
+            int wd = inotify_add_watch(fd, directory.c_str(), mask);
+            if (wd >= 0)
+            {
+                watchedDirectories[wd] = directory;
+            }
+        };
+
+        // inotify is not recursive, watch every folder under the root
+        addWatch(rootDirectory);
+        std::error_code error;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(rootDirectory, error))
+        {
+            if (entry.is_directory())
+            {
+                addWatch(entry.path().generic_string());
+            }
+        }
+
+        alignas(inotify_event) char buffer[4096];
+        while (running)
+        {
+            pollfd pfd{ fd, POLLIN, 0 };
+            if (poll(&pfd, 1, 100) <= 0)
+            {
+                continue;
+            }
+
+            ssize_t length = read(fd, buffer, sizeof(buffer));
+            for (ssize_t offset = 0; offset < length;)
+            {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += sizeof(inotify_event) + event->len;
+
+                auto it = watchedDirectories.find(event->wd);
+                if (it == watchedDirectories.end() || event->len == 0)
+                {
+                    continue;
+                }
+
+                const std::string path = it->second + "/" + event->name;
+                if (event->mask & IN_ISDIR)
+                {
+                    if (event->mask & IN_CREATE)
+                    {
+                        addWatch(path);     // New folder, start watching it too
+                    }
+                    continue;
+                }
+                if (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+                {
+                    NotifyChanged(path);
+                }
+            }
+        }
+
+        close(fd);
+    }
+#else
+    void FileWatcher::WatchThread()
+    {
+        PollThread();
+    }
+#endif
+
+    void FileWatcher::PollThread()
+    {
+        // Portable fallback, compares modification times twice a second
+        std::unordered_map<std::string, std::filesystem::file_time_type> lastWriteTimes;
+        bool firstScan = true;
+
+        while (running)
+        {
+            std::error_code error;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(rootDirectory, error))
+            {
+                if (!entry.is_regular_file(error))
+                {
+                    continue;
+                }
+
+                const std::string path = entry.path().generic_string();
+                const auto writeTime = entry.last_write_time(error);
+                auto it = lastWriteTimes.find(path);
+                if (it == lastWriteTimes.end())
+                {
+                    lastWriteTimes.emplace(path, writeTime);
+                    if (!firstScan)
+                    {
+                        NotifyChanged(path);
+                    }
+                }
+                else if (it->second != writeTime)
+                {
+                    it->second = writeTime;
+                    NotifyChanged(path);
+                }
+            }
+            firstScan = false;
+
+            for (int i = 0; i < 5 && running; ++i)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+    }
+}
@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : FileWatcher.h
+/// @Brief : Declares the FileWatcher system, which hot reloads assets when
+///          their files change on disk. File events are collected on a
+///          background thread (inotify on Linux, timestamp polling elsewhere),
+///          debounced, mapped to the asset that owns the file and reloaded by
+///          the owning loader on a worker thread. Finished reloads are swapped
+///          into the AssetManager at the next frame boundary (Update).
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _FILE_WATCHER_H_
+#define _FILE_WATCHER_H_
+#include "pch.h"
+#include "System.h"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @class FileWatcher
+     * @brief Watches the Assets folder and reloads only the assets whose files changed.
+     */
+    class FileWatcher : public ISystem
+    {
+    public:
+        /**
+         * @enum AssetKind
+         * @brief Which loader owns a watched file.
+         */
+        enum class AssetKind
+        {
+            Texture,            // Image file referenced by TextureAsset.json
+            TextureManifest,    // Assets/JsonData/TextureAsset.json
+            AudioManifest,      // Assets/JsonData/AudioAsset.json
+            Shader,             // Graphics or font shader source
+            Font,               // Font file loaded with UE_LoadFont
+            Scene,              // Scene JSON, reloaded if it is the active scene
+            Prefab,             // Prefab JSON, read from disk on every spawn
+            Dictionary,         // Lexicon word list
+            Prefixes,           // Lexicon prefix list
+            NSFW                // Lexicon NSFW list
+        };
+
+        /**
+         * @struct AssetHandle
+         * @brief Identifies the asset a file belongs to.
+         */
+        struct AssetHandle
+        {
+            AssetKind kind;
+            std::string path;   // Normalized path relative to the working directory
+        };
+
+        using ReloadListener = std::function<void(const AssetHandle&)>;
+
+        FileWatcher() = default;
+        ~FileWatcher();
+
+        /**
+         * @brief Builds the path map from the loaded assets and starts watching "Assets".
+         */
+        void Initialize() override;
+
+        /**
+         * @brief Frame boundary: dispatches debounced changes and applies finished reloads.
+         * @param deltaTime Time since the last frame.
+         */
+        void Update(float deltaTime) override;
+
+        std::string GetName() override { return "FileWatcher"; }
+
+        /**
+         * @brief Stops the watcher thread and waits for outstanding reloads.
+         */
+        void Shutdown();
+
+        /**
+         * @brief Rebuilds the file path to asset handle map from the AssetManager.
+         *        Called automatically after manifests are reloaded.
+         */
+        void RebuildPathMap();
+
+        /**
+         * @brief Registers a callback invoked on the main thread after an asset of the given
+         *        kind was reloaded (e.g. Graphics recompiling a shader program).
+         */
+        void AddListener(AssetKind kind, ReloadListener listener);
+
+        /**
+         * @brief Records a file the engine has just written itself (e.g. an editor save), so
+         *        the change it causes is not reloaded. Later edits to the file still are.
+         * @param path Disk path of the written file.
+         */
+        void IgnoreOwnWrite(const std::string& path);
+
+        /**
+         * @brief Normalizes a path so file events and asset paths compare equal.
+         */
+        static std::string NormalizePath(const std::string& path);
+
+        float debounceSeconds = 0.25f;     // Quiet time required before a changed file is reloaded
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @struct ReloadResult
+         * @brief Produced by a worker thread; apply is run on the main thread.
+         */
+        struct ReloadResult
+        {
+            AssetHandle handle;
+            std::function<void()> apply;
+        };
+
+        /**
+         * @struct InFlightReload
+         * @brief A reload running on a worker thread.
+         */
+        struct InFlightReload
+        {
+            std::string path;
+            std::future<ReloadResult> future;
+        };
+
+        void WatchThread();
+        void PollThread();
+        void NotifyChanged(const std::string& path);
+        bool IsOwnWrite(const std::string& path);
+        void Dispatch(const AssetHandle& handle);
+        static ReloadResult LoadOnWorker(AssetHandle handle);
+
+        std::unordered_map<std::string, AssetKind> pathMap;                 // Guarded by mapMutex
+        std::mutex mapMutex;
+
+        std::unordered_map<std::string, Clock::time_point> pendingChanges;  // Guarded by pendingMutex
+        std::unordered_map<std::string, std::filesystem::file_time_type> ownWrites;  // Guarded by pendingMutex
+        std::mutex pendingMutex;
+
+        std::vector<InFlightReload> inFlight;                                // Main thread only
+        std::unordered_map<int, std::vector<ReloadListener>> listeners;     // Main thread only
+
+        std::thread watchThread;
+        std::atomic<bool> running{ false };
+        std::string rootDirectory = "Assets";
+    };
+
+    extern FileWatcher GlobalFileWatcher;   // Global instance of the FileWatcher system
+}
+#endif // !_FILE_WATCHER_H_
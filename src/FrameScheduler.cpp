@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : FrameScheduler.cpp
+/// @Brief : Implements the fixed timestep FrameScheduler.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "FrameScheduler.h"
+#include "EngineState.h"
+#include "Metrics.h"
+#include "TimingWheel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Framework
+{
+    FrameScheduler GlobalFrameScheduler;
+
+    void FrameScheduler::AddFixedSystem(ISystem* system)
+    {
+        fixedSystems.push_back(system);
+    }
+
+    void FrameScheduler::AddVariableSystem(ISystem* system)
+    {
+        variableSystems.push_back(system);
+    }
+
+    void FrameScheduler::AddFixedPass(FixedPass pass)
+    {
+        fixedPasses.push_back(std::move(pass));
+    }
+
+    void FrameScheduler::AddRenderPass(RenderPass pass)
+    {
+        renderPasses.push_back(std::move(pass));
+    }
+
+    void FrameScheduler::Reset()
+    {
+        accumulator = 0.0f;
+        alpha = 0.0f;
+    }
+
+    void FrameScheduler::Tick(float frameTime)
+    {
+        static Histogram& workTimeMetric = GlobalMetrics.GetHistogram("ue_frame_work_us", "Time spent updating systems per frame in microseconds");
+        static Histogram& substepMetric = GlobalMetrics.GetHistogram("ue_fixed_substeps", "Fixed steps run per frame");
+        static Counter& budgetMetric = GlobalMetrics.GetCounter("ue_frame_budget_exceeded_total", "Frames over budget or over the substep cap");
+
+        const auto workStart = std::chrono::steady_clock::now();
+        ticking = true;
+
+        FrameStats stats;
+        stats.frameTime = frameTime;
+
+        // Slow motion feeds less simulation time into the accumulator, the step itself never changes
+        const float clampedFrameTime = std::clamp(frameTime, 0.0f, settings.maxFrameTime);
+        accumulator += clampedFrameTime * std::max(engineState.TimeScale, 0.0f);
+
+        // Gameplay timers tick with the fixed step, so they fire on the same step on every run
+        GlobalTimingWheel.SetTickDuration(settings.fixedStep);
+
+        while (accumulator >= settings.fixedStep && stats.substeps < settings.maxSubsteps)
+        {
+            for (const FixedPass& pass : fixedPasses)
+            {
+                pass();
+            }
+            for (ISystem* system : fixedSystems)
+            {
+                system->Update(settings.fixedStep);
+            }
+            GlobalTimingWheel.Step();
+            accumulator -= settings.fixedStep;
+            ++stats.substeps;
+        }
+
+        // Too far behind to catch up, drop whole steps instead of spiralling
+        if (accumulator >= settings.fixedStep)
+        {
+            const float remainder = std::fmod(accumulator, settings.fixedStep);
+            stats.droppedTime = accumulator - remainder;
+            accumulator = remainder;
+        }
+        alpha = accumulator / settings.fixedStep;
+
+        for (ISystem* system : variableSystems)
+        {
+            system->Update(frameTime);
+        }
+
+        for (const RenderPass& pass : renderPasses)
+        {
+            pass();
+        }
+
+        const auto workDuration = std::chrono::steady_clock::now() - workStart;
+        stats.workTime = std::chrono::duration<float>(workDuration).count();
+        stats.budgetExceeded = stats.workTime > settings.frameBudget || stats.droppedTime > 0.0f;
+
+        workTimeMetric.RecordMicroseconds(workDuration);
+        substepMetric.Record(static_cast<uint64_t>(stats.substeps));
+        if (stats.budgetExceeded)
+        {
+            ++budgetExceededCount;
+            budgetMetric.Increment();
+            if (budgetListener)
+            {
+                budgetListener(stats);
+            }
+        }
+
+        lastFrame = stats;
+        ticking = false;
+    }
+}
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : FrameScheduler.h
+/// @Brief : Declares the FrameScheduler, which drives the systems from the
+///          engine loop. Gameplay systems registered as fixed step systems
+///          are updated with a constant simulation step from an accumulator
+///          that is scaled by engineState.TimeScale, so the slow ability and
+///          load spikes no longer change the size of a gameplay step. Other
+///          systems keep receiving the variable frame time. The leftover
+///          fraction of a step is exposed as an interpolation alpha for
+///          rendering, and frames that go over budget are reported.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _FRAME_SCHEDULER_H_
+#define _FRAME_SCHEDULER_H_
+#include "pch.h"
+#include "System.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @class FrameScheduler
+     * @brief Fixed timestep loop with a time-scale-aware accumulator. The engine loop
+     *        calls Tick() once per frame instead of updating every system directly.
+     */
+    class FrameScheduler
+    {
+    public:
+        /**
+         * @struct Settings
+         * @brief Loop tuning values.
+         */
+        struct Settings
+        {
+            float fixedStep = 1.0f / 60.0f;     // Simulation time advanced by one substep
+            int maxSubsteps = 5;                // Substeps allowed per frame before time is dropped
+            float maxFrameTime = 0.25f;         // Longer frames (breakpoints, window drags) are clamped
+            float frameBudget = 1.0f / 60.0f;   // Wall time a frame may take before it is reported
+        };
+
+        /**
+         * @struct FrameStats
+         * @brief What happened during the last Tick().
+         */
+        struct FrameStats
+        {
+            float frameTime = 0.0f;         // Real time since the previous frame
+            float workTime = 0.0f;          // Wall time spent inside Tick()
+            int substeps = 0;               // Fixed steps run this frame
+            float droppedTime = 0.0f;       // Simulation time discarded by the substep cap
+            bool budgetExceeded = false;
+        };
+
+        using BudgetListener = std::function<void(const FrameStats&)>;
+        using FixedPass = std::function<void()>;
+        using RenderPass = std::function<void()>;
+
+        /**
+         * @brief Registers a system updated with the fixed simulation step (movement, collision, AI).
+         */
+        void AddFixedSystem(ISystem* system);
+
+        /**
+         * @brief Registers a system updated once per frame with the real frame time (input, audio, rendering).
+         */
+        void AddVariableSystem(ISystem* system);
+
+        /**
+         * @brief Registers work run at the start of every fixed step, before the fixed systems
+         *        (the collision broad phase).
+         */
+        void AddFixedPass(FixedPass pass);
+
+        /**
+         * @brief Registers a pass drawn once per frame after the variable systems, paused or not
+         *        (the batched scene pass).
+         */
+        void AddRenderPass(RenderPass pass);
+
+        /**
+         * @brief Runs one frame: fixed systems as many times as the accumulator allows, then variable
+         *        systems, then render passes.
+         * @param frameTime Real time since the previous frame, in seconds.
+         */
+        void Tick(float frameTime);
+
+        /**
+         * @brief True while Tick() runs, e.g. when a system updated by the scheduler would
+         *        otherwise tick it again.
+         */
+        bool IsTicking() const { return ticking; }
+
+        /**
+         * @brief Forgets accumulated time, e.g. after a scene transition or unpausing.
+         */
+        void Reset();
+
+        /**
+         * @brief Fraction of a fixed step left in the accumulator (0 to 1). Renderers blend the
+         *        previous and current simulation state with it: previous + (current - previous) * alpha.
+         */
+        float GetAlpha() const { return alpha; }
+
+        const FrameStats& GetLastFrameStats() const { return lastFrame; }
+        uint64_t GetBudgetExceededCount() const { return budgetExceededCount; }
+
+        /**
+         * @brief Called after every frame that exceeded the budget or hit the substep cap.
+         */
+        void SetBudgetListener(BudgetListener listener) { budgetListener = std::move(listener); }
+
+        Settings settings;
+
+    private:
+        std::vector<ISystem*> fixedSystems;
+        std::vector<ISystem*> variableSystems;
+        std::vector<FixedPass> fixedPasses;
+        std::vector<RenderPass> renderPasses;
+
+        float accumulator = 0.0f;
+        float alpha = 0.0f;
+        bool ticking = false;
+        FrameStats lastFrame;
+        uint64_t budgetExceededCount = 0;
+        BudgetListener budgetListener;
+    };
+
+    extern FrameScheduler GlobalFrameScheduler;   // Global instance of the FrameScheduler
+}
+#endif // !_FRAME_SCHEDULER_H_
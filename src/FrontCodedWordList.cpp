@@ -0,0 +1,291 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : FrontCodedWordList.cpp
+/// @Brief : Implements the front coded word list. Each encoded word is
+///          <shared prefix length><suffix length><suffix bytes>, both lengths
+///          as LEB128 varints. The first word of a bucket shares nothing, so
+///          decoding can start at any bucket offset.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "FrontCodedWordList.h"
+#include <algorithm>
+
+namespace Framework
+{
+    /*******************/
+    //   Encoding      //
+    /*******************/
+
+    void FrontCodedWordList::WriteVarint(std::vector<uint8_t>& out, uint32_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    uint32_t FrontCodedWordList::ReadVarint(const uint8_t* bytes, size_t& offset)
+    {
+        uint32_t value = 0;
+        int shift = 0;
+        uint8_t byte;
+        do
+        {
+            byte = bytes[offset++];
+            value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        return value;
+    }
+
+    void FrontCodedWordList::Builder::Add(const std::string& word)
+    {
+        size_t shared = 0;
+        if (count % BucketSize == 0)
+        {
+            bucketOffsets.push_back(static_cast<uint32_t>(data.size()));    // Bucket head is stored whole
+        }
+        else
+        {
+            const size_t limit = std::min(previous.size(), word.size());
+            while (shared < limit && previous[shared] == word[shared])
+            {
+                ++shared;
+            }
+        }
+
+        WriteVarint(data, static_cast<uint32_t>(shared));
+        WriteVarint(data, static_cast<uint32_t>(word.size() - shared));
+        data.insert(data.end(), word.begin() + shared, word.end());
+
+        previous = word;
+        ++count;
+    }
+
+    FrontCodedWordList FrontCodedWordList::Builder::Finish()
+    {
+        data.shrink_to_fit();
+        bucketOffsets.shrink_to_fit();
+        FrontCodedWordList list = FromEncoded(std::move(data), std::move(bucketOffsets), count);
+
+        data.clear();
+        bucketOffsets.clear();
+        previous.clear();
+        count = 0;
+        return list;
+    }
+
+    FrontCodedWordList FrontCodedWordList::FromSorted(const std::vector<std::string>& sortedWords)
+    {
+        Builder builder;
+        for (const std::string& word : sortedWords)
+        {
+            builder.Add(word);
+        }
+        return builder.Finish();
+    }
+
+    FrontCodedWordList FrontCodedWordList::FromEncoded(std::vector<uint8_t> encoded, std::vector<uint32_t> offsets, size_t wordCount)
+    {
+        FrontCodedWordList list;
+        list.data = std::move(encoded);
+        list.bucketOffsets = std::move(offsets);
+        list.count = wordCount;
+        list.ViewOwned();
+        return list;
+    }
+
+    FrontCodedWordList FrontCodedWordList::FromMapped(const uint8_t* encoded, size_t encodedSize, const uint32_t* offsets, size_t offsetCount, size_t wordCount)
+    {
+        FrontCodedWordList list;
+        list.bytes = encoded;
+        list.byteCount = encodedSize;
+        list.bucketStarts = offsets;
+        list.bucketCount = offsetCount;
+        list.count = wordCount;
+        return list;
+    }
+
+    FrontCodedWordList::FrontCodedWordList(const FrontCodedWordList& other)
+        : data(other.data), bucketOffsets(other.bucketOffsets), count(other.count)
+    {
+        if (other.data.empty() && other.bucketOffsets.empty())
+        {
+            bytes = other.bytes;            // Mapped, share the same memory
+            byteCount = other.byteCount;
+            bucketStarts = other.bucketStarts;
+            bucketCount = other.bucketCount;
+        }
+        else
+        {
+            ViewOwned();
+        }
+    }
+
+    FrontCodedWordList& FrontCodedWordList::operator=(const FrontCodedWordList& other)
+    {
+        if (this != &other)
+        {
+            FrontCodedWordList copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    FrontCodedWordList::FrontCodedWordList(FrontCodedWordList&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    FrontCodedWordList& FrontCodedWordList::operator=(FrontCodedWordList&& other) noexcept
+    {
+        if (this != &other)
+        {
+            // Moving a vector keeps its buffer, so the views stay valid
+            data = std::move(other.data);
+            bucketOffsets = std::move(other.bucketOffsets);
+            bytes = other.bytes;
+            byteCount = other.byteCount;
+            bucketStarts = other.bucketStarts;
+            bucketCount = other.bucketCount;
+            count = other.count;
+
+            other.data.clear();
+            other.bucketOffsets.clear();
+            other.bytes = nullptr;
+            other.byteCount = 0;
+            other.bucketStarts = nullptr;
+            other.bucketCount = 0;
+            other.count = 0;
+        }
+        return *this;
+    }
+
+    void FrontCodedWordList::ViewOwned()
+    {
+        bytes = data.data();
+        byteCount = data.size();
+        bucketStarts = bucketOffsets.data();
+        bucketCount = bucketOffsets.size();
+    }
+
+    /*******************/
+    //   Lookup        //
+    /*******************/
+
+    std::string FrontCodedWordList::BucketHead(size_t bucket) const
+    {
+        size_t offset = bucketStarts[bucket];
+        ReadVarint(bytes, offset);          // Shared length, always 0 for a head
+        const uint32_t length = ReadVarint(bytes, offset);
+        return std::string(reinterpret_cast<const char*>(bytes + offset), length);
+    }
+
+    std::string FrontCodedWordList::operator[](size_t index) const
+    {
+        Iterator it(this, index - index % BucketSize);
+        for (size_t i = index % BucketSize; i > 0; --i)
+        {
+            ++it;
+        }
+        return *it;
+    }
+
+    size_t FrontCodedWordList::LowerBound(const std::string& key) const
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        // Last bucket whose head is not greater than the key
+        size_t low = 0, high = bucketCount;
+        while (high - low > 1)
+        {
+            const size_t mid = (low + high) / 2;
+            if (BucketHead(mid) <= key)
+                low = mid;
+            else
+                high = mid;
+        }
+
+        // The answer is inside that bucket or is the head of the next one
+        const size_t first = low * BucketSize;
+        const size_t last = std::min(first + BucketSize, count);
+        Iterator it(this, first);
+        for (size_t index = first; index < last; ++index, ++it)
+        {
+            if (*it >= key)
+            {
+                return index;
+            }
+        }
+        return last;
+    }
+
+    size_t FrontCodedWordList::CountWithPrefix(const std::string& prefix) const
+    {
+        const size_t first = LowerBound(prefix);
+
+        // Smallest string greater than every word with this prefix
+        std::string next = prefix;
+        while (!next.empty() && static_cast<unsigned char>(next.back()) == 0xFF)
+        {
+            next.pop_back();
+        }
+        if (next.empty())
+        {
+            return count - first;
+        }
+        next.back() = static_cast<char>(static_cast<unsigned char>(next.back()) + 1);
+
+        return LowerBound(next) - first;
+    }
+
+    bool FrontCodedWordList::Contains(const std::string& word) const
+    {
+        const size_t index = LowerBound(word);
+        return index < count && (*this)[index] == word;
+    }
+
+    /*******************/
+    //   Iterator      //
+    /*******************/
+
+    FrontCodedWordList::Iterator::Iterator(const FrontCodedWordList* list, size_t index)
+        : list(list), index(index)
+    {
+        if (index < list->count)
+        {
+            offset = list->bucketStarts[index / BucketSize];
+            Decode();
+        }
+    }
+
+    FrontCodedWordList::Iterator& FrontCodedWordList::Iterator::operator++()
+    {
+        ++index;
+        if (index < list->count)
+        {
+            Decode();   // Buckets are contiguous, the next word starts where this one ended
+        }
+        return *this;
+    }
+
+    void FrontCodedWordList::Iterator::Decode()
+    {
+        const uint8_t* bytes = list->bytes;
+        const uint32_t shared = ReadVarint(bytes, offset);
+        const uint32_t length = ReadVarint(bytes, offset);
+        current.resize(shared);
+        current.append(reinterpret_cast<const char*>(bytes + offset), length);
+        offset += length;
+    }
+}
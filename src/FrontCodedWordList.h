@@ -0,0 +1,175 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : FrontCodedWordList.h
+/// @Brief : Declares FrontCodedWordList, a compact read-only list of sorted
+///          words. Words are grouped in buckets of 16; the first word of a
+///          bucket is stored whole and every following word only stores the
+///          length of the prefix it shares with the previous word plus the
+///          remaining characters. Random access decodes at most one bucket,
+///          and prefix ranges are found with a binary search over the bucket
+///          heads, which makes it suitable both for enumerating the dictionary
+///          and for picking random words.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _FRONT_CODED_WORD_LIST_H_
+#define _FRONT_CODED_WORD_LIST_H_
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @class FrontCodedWordList
+     * @brief Sorted, front coded word list with random access by index.
+     */
+    class FrontCodedWordList
+    {
+    public:
+        static constexpr size_t BucketSize = 16;
+
+        FrontCodedWordList() = default;
+        FrontCodedWordList(const FrontCodedWordList& other);
+        FrontCodedWordList(FrontCodedWordList&& other) noexcept;
+        FrontCodedWordList& operator=(const FrontCodedWordList& other);
+        FrontCodedWordList& operator=(FrontCodedWordList&& other) noexcept;
+
+        /**
+         * @class Builder
+         * @brief Appends words in ascending byte order and produces the list.
+         */
+        class Builder
+        {
+        public:
+            /**
+             * @brief Appends the next word. Words must be added in sorted order.
+             */
+            void Add(const std::string& word);
+
+            /**
+             * @brief Finishes the list. The builder is empty afterwards.
+             */
+            FrontCodedWordList Finish();
+
+        private:
+            std::vector<uint8_t> data;
+            std::vector<uint32_t> bucketOffsets;
+            std::string previous;
+            size_t count = 0;
+        };
+
+        /**
+         * @class Iterator
+         * @brief Forward iterator decoding words in order. Dereferencing yields the current word.
+         */
+        class Iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string*;
+            using reference = const std::string&;
+
+            Iterator() = default;
+            Iterator(const FrontCodedWordList* list, size_t index);
+
+            reference operator*() const { return current; }
+            pointer operator->() const { return &current; }
+            Iterator& operator++();
+            Iterator operator++(int) { Iterator copy = *this; ++(*this); return copy; }
+            bool operator==(const Iterator& other) const { return index == other.index; }
+            bool operator!=(const Iterator& other) const { return index != other.index; }
+
+        private:
+            void Decode();
+
+            const FrontCodedWordList* list = nullptr;
+            size_t index = 0;
+            size_t offset = 0;      // Byte offset of the next encoded word
+            std::string current;
+        };
+
+        /**
+         * @brief Builds a list from words that are already sorted and unique.
+         */
+        static FrontCodedWordList FromSorted(const std::vector<std::string>& sortedWords);
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        /**
+         * @brief Decodes the word at the given index (0 to size() - 1).
+         */
+        std::string operator[](size_t index) const;
+
+        /**
+         * @brief Index of the first word not less than the key, size() if there is none.
+         */
+        size_t LowerBound(const std::string& key) const;
+
+        /**
+         * @brief Number of words that start with the prefix.
+         */
+        size_t CountWithPrefix(const std::string& prefix) const;
+
+        /**
+         * @brief Whether the exact word is in the list.
+         */
+        bool Contains(const std::string& word) const;
+
+        /**
+         * @brief Heap memory used by the encoded data, in bytes. A mapped list uses none.
+         */
+        size_t MemoryUsage() const { return data.capacity() + bucketOffsets.capacity() * sizeof(uint32_t); }
+
+        /**
+         * @brief Raw encoded bytes and bucket offsets, used to store the list in a file.
+         */
+        const uint8_t* GetData() const { return bytes; }
+        size_t GetDataSize() const { return byteCount; }
+        const uint32_t* GetBucketOffsets() const { return bucketStarts; }
+        size_t GetBucketCount() const { return bucketCount; }
+
+        /**
+         * @brief Recreates a list from previously stored data and offsets.
+         */
+        static FrontCodedWordList FromEncoded(std::vector<uint8_t> encoded, std::vector<uint32_t> offsets, size_t wordCount);
+
+        /**
+         * @brief Wraps data and offsets that live elsewhere (a mapped file) without copying.
+         *        The memory must stay valid and unchanged for as long as the list is used.
+         */
+        static FrontCodedWordList FromMapped(const uint8_t* encoded, size_t encodedSize, const uint32_t* offsets, size_t offsetCount, size_t wordCount);
+
+        Iterator begin() const { return Iterator(this, 0); }
+        Iterator end() const { return Iterator(this, count); }
+
+    private:
+        static void WriteVarint(std::vector<uint8_t>& out, uint32_t value);
+        static uint32_t ReadVarint(const uint8_t* data, size_t& offset);
+
+        std::string BucketHead(size_t bucket) const;
+
+        // Rebinds the views below to the owned vectors
+        void ViewOwned();
+
+        std::vector<uint8_t> data;              // Encoded words, empty for a mapped list
+        std::vector<uint32_t> bucketOffsets;    // Byte offset of the first word of each bucket, empty for a mapped list
+
+        // What lookups read: the owned vectors or mapped memory
+        const uint8_t* bytes = nullptr;
+        size_t byteCount = 0;
+        const uint32_t* bucketStarts = nullptr;
+        size_t bucketCount = 0;
+        size_t count = 0;
+    };
+}
+#endif // !_FRONT_CODED_WORD_LIST_H_
@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+/// @File   : JsonSerialize.cpp
+/// @Brief  : Implements the number handling shared by the JSON loaders and
+///           writers. Scene files are mostly floats: they are written with
+///           the shortest digits that round-trip through a float, and exact
+///           parsing converts them with std::from_chars, the same algorithm
+///           family as fast_float and Ryu, instead of arbitrary precision.
+///
+/// @Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+/// @Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "JsonSerialize.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+// Floating point to_chars/from_chars: MSVC 2019 16.4 and libstdc++ 11 onwards
+#if (defined(_MSC_VER) && _MSC_VER >= 1924) || (defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L)
+#define UE_JSON_FLOAT_CHARCONV 1
+#endif
+
+namespace Framework
+{
+    JsonFloatPrecision GlobalJsonFloatPrecision = JsonFloatPrecision::Exact;
+
+    namespace
+    {
+        /**
+         * @brief Converts number text to a double. False when it is beyond the double range,
+         *        which RapidJSON rejects with kParseErrorNumberTooBig; underflow gives zero.
+         */
+        bool ToDouble(const char* first, const char* last, double& value)
+        {
+#if defined(UE_JSON_FLOAT_CHARCONV)
+            if (std::from_chars(first, last, value).ec != std::errc::result_out_of_range)
+            {
+                return true;
+            }
+#endif
+            value = std::strtod(std::string(first, last).c_str(), nullptr);
+            return std::isfinite(value);
+        }
+
+        /**
+         * @brief Forwards every SAX event to a Document, converting the raw number text that
+         *        kParseNumbersAsStringsFlag produces the way RapidJSON picks number types.
+         */
+        struct ExactNumberHandler
+        {
+            rapidjson::Document& document;
+
+            bool Null() { return document.Null(); }
+            bool Bool(bool value) { return document.Bool(value); }
+            bool Int(int value) { return document.Int(value); }
+            bool Uint(unsigned value) { return document.Uint(value); }
+            bool Int64(int64_t value) { return document.Int64(value); }
+            bool Uint64(uint64_t value) { return document.Uint64(value); }
+            bool Double(double value) { return document.Double(value); }
+            bool String(const char* text, rapidjson::SizeType length, bool copy) { return document.String(text, length, copy); }
+            bool StartObject() { return document.StartObject(); }
+            bool Key(const char* text, rapidjson::SizeType length, bool copy) { return document.Key(text, length, copy); }
+            bool EndObject(rapidjson::SizeType memberCount) { return document.EndObject(memberCount); }
+            bool StartArray() { return document.StartArray(); }
+            bool EndArray(rapidjson::SizeType elementCount) { return document.EndArray(elementCount); }
+
+            bool RawNumber(const char* text, rapidjson::SizeType length, bool)
+            {
+                const char* last = text + length;
+                double number = 0.0;
+                if (std::find_if(text, last, [](char c) { return c == '.' || c == 'e' || c == 'E'; }) != last)
+                {
+                    return ToDouble(text, last, number) && document.Double(number);
+                }
+
+                // Integers: int/unsigned when they fit, then 64 bit, then double like RapidJSON
+                if (*text == '-')
+                {
+                    int64_t value = 0;
+                    if (std::from_chars(text, last, value).ec != std::errc())
+                    {
+                        return ToDouble(text, last, number) && document.Double(number);
+                    }
+                    return value >= std::numeric_limits<int>::min() ? document.Int(static_cast<int>(value)) : document.Int64(value);
+                }
+                uint64_t value = 0;
+                if (std::from_chars(text, last, value).ec != std::errc())
+                {
+                    return ToDouble(text, last, number) && document.Double(number);
+                }
+                return value <= std::numeric_limits<unsigned>::max() ? document.Uint(static_cast<unsigned>(value)) : document.Uint64(value);
+            }
+        };
+
+        struct ExactGenerator
+        {
+            const std::string& text;
+            rapidjson::ParseResult result;
+
+            bool operator()(rapidjson::Document& document)
+            {
+                rapidjson::Reader reader;
+                rapidjson::StringStream stream(text.c_str());
+                ExactNumberHandler handler{ document };
+                result = reader.Parse<rapidjson::kParseNumbersAsStringsFlag>(stream, handler);
+                return !result.IsError();
+            }
+        };
+    }
+
+    bool ParseJson(rapidjson::Document& document, std::string& text, JsonFloatPrecision precision)
+    {
+        if (precision == JsonFloatPrecision::Fast)
+        {
+            document.ParseInsitu(&text[0]);
+            return !document.HasParseError();
+        }
+
+        ExactGenerator generator{ text, {} };
+        document.Populate(generator);
+        if (generator.result.IsError())
+        {
+            // Populate() does not record errors; reparse so HasParseError() and the offset are set
+            document.Parse<rapidjson::kParseFullPrecisionFlag>(text.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    size_t FormatJsonFloat(float value, char* out)
+    {
+        if (!std::isfinite(value))
+        {
+            return 0;
+        }
+
+#if defined(UE_JSON_FLOAT_CHARCONV)
+        const std::to_chars_result result = std::to_chars(out, out + 24, value);     // Room left for ".0"
+        size_t length = static_cast<size_t>(result.ptr - out);
+#else
+        // Nine significant digits always round-trip a float, if not always the shortest
+        size_t length = static_cast<size_t>(std::snprintf(out, 32, "%.9g", static_cast<double>(value)));
+#endif
+        if (std::find_if(out, out + length, [](char c) { return c == '.' || c == 'e' || c == 'E'; }) == out + length)
+        {
+            out[length++] = '.';
+            out[length++] = '0';
+        }
+        out[length] = '\0';
+        return length;
+    }
+}
@@ -28,7 +28,37 @@
 // Standard Library
 #include "fstream"
 #include "sstream"
+#include "string"
 #include "unordered_map"
 #include "unordered_set"
 
+namespace Framework
+{
+    /**
+     * @brief How JSON numbers with a fraction or exponent are converted to double.
+     */
+    enum class JsonFloatPrecision
+    {
+        Fast,   // RapidJSON's in-place fast path, may be one ulp off; opt in where load time matters more
+        Exact,  // Correctly rounded, through std::from_chars instead of RapidJSON's big integers (default)
+    };
+
+    extern JsonFloatPrecision GlobalJsonFloatPrecision;    // Precision ParseJson uses by default, Exact unless set to Fast
+
+    /**
+     * @brief Parses a whole JSON file read into text. The fast path parses in place: strings in
+     *        the document point into text, which must outlive it and is modified.
+     * @return True if the text parsed. document.HasParseError() agrees for either precision.
+     */
+    bool ParseJson(rapidjson::Document& document, std::string& text, JsonFloatPrecision precision = GlobalJsonFloatPrecision);
+
+    /**
+     * @brief Shortest text that reads back as exactly this float, always with a fraction or
+     *        exponent so it stays a double in RapidJSON ("1.0", not "1").
+     * @param out At least 32 characters.
+     * @return Characters written, 0 for infinities and NaN, which JSON cannot hold.
+     */
+    size_t FormatJsonFloat(float value, char* out);
+}
+
 #endif // _JSONSERIALIZE_H_
\ No newline at end of file
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : JsonWriter.cpp
+/// @Brief : Implements the buffered file stream behind JsonWriter. Output
+///          goes to "<file>.tmp" and is renamed over the target only once
+///          everything was written, so a failed save never truncates a scene.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "JsonWriter.h"
+#include "FileWatcher.h"
+#include "VirtualFileSystem.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+namespace Framework
+{
+    JsonWriter::Style GlobalJsonStyle = JsonWriter::Style::Pretty;
+
+    /*******************/
+    //   File Stream   //
+    /*******************/
+
+    JsonFileStream::JsonFileStream(const std::string& path, size_t bufferSize)
+        : path(path), realPath(GlobalVirtualFileSystem.WritePath(path))
+        , buffer(std::make_unique<char[]>(std::max<size_t>(bufferSize, 4096)))
+    {
+        cursor = buffer.get();
+        end = buffer.get() + std::max<size_t>(bufferSize, 4096);
+        if (realPath.empty())
+        {
+            return;     // No writable mount, the VFS already said why
+        }
+
+        tempPath = realPath + ".tmp";
+        file.open(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cerr << "Error: Unable to open file " << tempPath << " for writing." << std::endl;
+        }
+    }
+
+    JsonFileStream::~JsonFileStream()
+    {
+        // Abandoned without Commit(), e.g. on an early return: leave the target as it was
+        if (!committed && file.is_open())
+        {
+            file.close();
+            std::error_code error;
+            std::filesystem::remove(tempPath, error);
+        }
+    }
+
+    void JsonFileStream::Write(const char* text, size_t length)
+    {
+        while (length > 0)
+        {
+            if (cursor == end)
+            {
+                Drain();
+            }
+            const size_t chunk = std::min(length, static_cast<size_t>(end - cursor));
+            std::memcpy(cursor, text, chunk);
+            cursor += chunk;
+            text += chunk;
+            length -= chunk;
+        }
+    }
+
+    void JsonFileStream::Drain()
+    {
+        const size_t size = static_cast<size_t>(cursor - buffer.get());
+        if (file.is_open())
+        {
+            file.write(buffer.get(), static_cast<std::streamsize>(size));
+        }
+        written += size;
+        cursor = buffer.get();
+    }
+
+    bool JsonFileStream::Commit()
+    {
+        if (!file.is_open() || committed)
+        {
+            return false;
+        }
+        Drain();
+        file.close();
+        committed = true;
+
+        std::error_code error;
+        if (file.fail())
+        {
+            std::cerr << "Error: Could not write " << tempPath << std::endl;
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+
+        std::filesystem::rename(tempPath, realPath, error);
+        if (error)
+        {
+            std::cerr << "Error: Could not replace " << realPath << ": " << error.message() << std::endl;
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+        GlobalVirtualFileSystem.Refresh(path);
+        GlobalFileWatcher.IgnoreOwnWrite(realPath);
+        return true;
+    }
+
+    /*******************/
+    //   Writer        //
+    /*******************/
+
+    JsonWriter::JsonWriter(const std::string& path, Style style)
+        : stream(path), compact(style == Style::Compact), compactWriter(stream), prettyWriter(stream)
+    {
+    }
+
+    bool JsonWriter::Commit()
+    {
+        // An unbalanced writer means a serializer bug, keep the old file
+        const bool complete = compact ? compactWriter.IsComplete() : prettyWriter.IsComplete();
+        if (!complete)
+        {
+            std::cerr << "Error: JSON left incomplete, not replacing the file" << std::endl;
+            return false;
+        }
+        return stream.Commit();
+    }
+}
@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : JsonWriter.h
+/// @Brief : Declares JsonWriter, a streaming JSON writer for the asset and
+///          scene serializers. Values go straight from the caller's data to
+///          a large file buffer through RapidJSON's writers, with no Document
+///          built first, so a save holds one buffer instead of a DOM plus the
+///          complete text. Pretty output keeps files diffable in the editor;
+///          compact output is for runtime saves.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _JSON_WRITER_H_
+#define _JSON_WRITER_H_
+#include "pch.h"
+#include "JsonSerialize.h"
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace Framework
+{
+    /**
+     * @class JsonFileStream
+     * @brief RapidJSON output stream that buffers into a fixed block and writes whole blocks to
+     *        a temporary file; Commit() renames it over the target.
+     */
+    class JsonFileStream
+    {
+    public:
+        typedef char Ch;
+
+        /**
+         * @param path Virtual path, resolved to the writable mount.
+         */
+        explicit JsonFileStream(const std::string& path, size_t bufferSize = 256 * 1024);
+        ~JsonFileStream();
+        JsonFileStream(const JsonFileStream&) = delete;
+        JsonFileStream& operator=(const JsonFileStream&) = delete;
+
+        bool IsOpen() const { return file.is_open(); }
+
+        void Put(char c)
+        {
+            if (cursor == end)
+            {
+                Drain();
+            }
+            *cursor++ = c;
+        }
+
+        void Write(const char* text, size_t length);
+        void Flush() {}         // Only whole blocks are written, Commit() writes the tail
+
+        /**
+         * @brief Writes what is buffered and replaces the target file.
+         * @return False if any write failed, the target is left untouched then.
+         */
+        bool Commit();
+
+        uint64_t GetBytesWritten() const { return written + static_cast<uint64_t>(cursor - buffer.get()); }
+
+    private:
+        void Drain();
+
+        std::string path;
+        std::string realPath;
+        std::string tempPath;
+        std::ofstream file;
+        std::unique_ptr<char[]> buffer;
+        char* cursor = nullptr;
+        char* end = nullptr;
+        uint64_t written = 0;
+        bool committed = false;
+    };
+
+    /**
+     * @class JsonWriter
+     * @brief SAX-style writer over a JsonFileStream. Calls mirror rapidjson::Writer; Member()
+     *        writes a key and its value in one call.
+     */
+    class JsonWriter
+    {
+    public:
+        enum class Style
+        {
+            Pretty,     // Four space indent, as the editor has always written
+            Compact,    // No whitespace, for runtime saves
+        };
+
+        explicit JsonWriter(const std::string& path, Style style = Style::Pretty);
+
+        bool IsOpen() const { return stream.IsOpen(); }
+
+        void StartObject() { compact ? compactWriter.StartObject() : prettyWriter.StartObject(); }
+        void EndObject() { compact ? compactWriter.EndObject() : prettyWriter.EndObject(); }
+        void StartArray() { compact ? compactWriter.StartArray() : prettyWriter.StartArray(); }
+        void EndArray() { compact ? compactWriter.EndArray() : prettyWriter.EndArray(); }
+
+        void Key(std::string_view key)
+        {
+            const rapidjson::SizeType length = static_cast<rapidjson::SizeType>(key.size());
+            compact ? compactWriter.Key(key.data(), length) : prettyWriter.Key(key.data(), length);
+        }
+
+        void Value(std::string_view value)
+        {
+            const rapidjson::SizeType length = static_cast<rapidjson::SizeType>(value.size());
+            compact ? compactWriter.String(value.data(), length) : prettyWriter.String(value.data(), length);
+        }
+        void Value(const std::string& value) { Value(std::string_view(value)); }
+        void Value(const char* value) { Value(std::string_view(value)); }
+        void Value(bool value) { compact ? compactWriter.Bool(value) : prettyWriter.Bool(value); }
+        void Value(int value) { compact ? compactWriter.Int(value) : prettyWriter.Int(value); }
+        void Value(unsigned value) { compact ? compactWriter.Uint(value) : prettyWriter.Uint(value); }
+        void Value(int64_t value) { compact ? compactWriter.Int64(value) : prettyWriter.Int64(value); }
+        void Value(uint64_t value) { compact ? compactWriter.Uint64(value) : prettyWriter.Uint64(value); }
+        void Value(float value)
+        {
+            // Shortest round-trip digits: "0.1" rather than the double "0.10000000149011612"
+            char text[32];
+            const size_t length = FormatJsonFloat(value, text);
+            if (length == 0)
+            {
+                Value(static_cast<double>(value));  // Not finite, RapidJSON rejects it as before
+                return;
+            }
+            compact ? compactWriter.RawValue(text, length, rapidjson::kNumberType) : prettyWriter.RawValue(text, length, rapidjson::kNumberType);
+        }
+        void Value(double value) { compact ? compactWriter.Double(value) : prettyWriter.Double(value); }
+
+        template <typename T>
+        void Member(std::string_view key, const T& value)
+        {
+            Key(key);
+            Value(value);
+        }
+
+        /**
+         * @brief Writes a key and an array of numbers, e.g. a colour or an offset.
+         */
+        template <typename... T>
+        void ArrayMember(std::string_view key, const T&... values)
+        {
+            Key(key);
+            StartArray();
+            (Value(values), ...);
+            EndArray();
+        }
+
+        /**
+         * @brief Finishes the file. Nothing replaces the target until this succeeds.
+         */
+        bool Commit();
+
+        uint64_t GetBytesWritten() const { return stream.GetBytesWritten(); }
+
+    private:
+        JsonFileStream stream;
+        bool compact = false;
+        rapidjson::Writer<JsonFileStream> compactWriter;
+        rapidjson::PrettyWriter<JsonFileStream> prettyWriter;
+    };
+
+    extern JsonWriter::Style GlobalJsonStyle;   // Style the serializers write with, Compact for runtime saves
+}
+#endif // !_JSON_WRITER_H_
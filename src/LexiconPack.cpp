@@ -0,0 +1,253 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : LexiconPack.cpp
+/// @Brief : Implements compiling and mapping lexicon packs. The file is a
+///          fixed header followed by the sections it points at, each 8 byte
+///          aligned:
+///            dictionary, prefixes, NSFW : encoded words + bucket offsets
+///            dictionary, NSFW           : displacements + fingerprints
+///          Values are stored in native byte order; a pack is a local cache
+///          of the JSON lists and is rebuilt rather than moved between
+///          machines.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "LexiconPack.h"
+#include "AssetManager.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace Framework
+{
+    namespace
+    {
+        constexpr uint32_t PackMagic = 0x584C4555;     // "UELX"
+        constexpr uint32_t PackVersion = 1;
+
+        struct ListSection
+        {
+            uint64_t dataOffset;
+            uint64_t dataSize;
+            uint64_t bucketOffset;
+            uint64_t bucketCount;
+            uint64_t wordCount;
+        };
+
+        struct IndexSection
+        {
+            uint64_t seed;
+            uint64_t displacementOffset;
+            uint64_t displacementCount;
+            uint64_t fingerprintOffset;
+            uint64_t fingerprintCount;
+        };
+
+        struct PackHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            ListSection dictionary;
+            ListSection prefixes;
+            ListSection nsfw;
+            IndexSection dictionaryIndex;
+            IndexSection nsfwIndex;
+        };
+
+        // Appends raw bytes at the next 8 byte boundary and returns where they start
+        uint64_t AppendAligned(std::vector<uint8_t>& out, const void* bytes, size_t size)
+        {
+            out.resize((out.size() + 7) & ~static_cast<size_t>(7), 0);
+            const uint64_t offset = out.size();
+            const uint8_t* begin = static_cast<const uint8_t*>(bytes);
+            out.insert(out.end(), begin, begin + size);
+            return offset;
+        }
+
+        ListSection AppendList(std::vector<uint8_t>& out, const FrontCodedWordList& list)
+        {
+            ListSection section{};
+            section.dataOffset = AppendAligned(out, list.GetData(), list.GetDataSize());
+            section.dataSize = list.GetDataSize();
+            section.bucketOffset = AppendAligned(out, list.GetBucketOffsets(), list.GetBucketCount() * sizeof(uint32_t));
+            section.bucketCount = list.GetBucketCount();
+            section.wordCount = list.size();
+            return section;
+        }
+
+        IndexSection AppendIndex(std::vector<uint8_t>& out, const PerfectHashIndex& index)
+        {
+            IndexSection section{};
+            section.seed = index.GetSeed();
+            section.displacementOffset = AppendAligned(out, index.GetDisplacements(), index.GetDisplacementCount() * sizeof(uint32_t));
+            section.displacementCount = index.GetDisplacementCount();
+            section.fingerprintOffset = AppendAligned(out, index.GetFingerprints(), index.size() * sizeof(uint32_t));
+            section.fingerprintCount = index.size();
+            return section;
+        }
+
+        bool InBounds(uint64_t offset, uint64_t count, uint64_t elementSize, size_t fileSize)
+        {
+            return offset <= fileSize && count <= (fileSize - offset) / elementSize && offset % alignof(uint32_t) == 0;
+        }
+
+        bool ValidList(const ListSection& section, size_t fileSize)
+        {
+            return InBounds(section.dataOffset, section.dataSize, 1, fileSize)
+                && InBounds(section.bucketOffset, section.bucketCount, sizeof(uint32_t), fileSize)
+                && section.bucketCount == (section.wordCount + FrontCodedWordList::BucketSize - 1) / FrontCodedWordList::BucketSize;
+        }
+
+        bool ValidIndex(const IndexSection& section, const ListSection& keys, size_t fileSize)
+        {
+            return InBounds(section.displacementOffset, section.displacementCount, sizeof(uint32_t), fileSize)
+                && InBounds(section.fingerprintOffset, section.fingerprintCount, sizeof(uint32_t), fileSize)
+                && section.fingerprintCount == keys.wordCount
+                && (section.displacementCount == 0) == (section.fingerprintCount == 0);
+        }
+
+        // Sorted and unique, as the word list and index require
+        std::vector<std::string> SortedWords(const std::string& path, const std::string& key, bool toLower)
+        {
+            std::vector<std::string> words = AssetManager::ParseWordArray(path, key, toLower);
+            std::sort(words.begin(), words.end());
+            words.erase(std::unique(words.begin(), words.end()), words.end());
+            return words;
+        }
+    }
+
+    bool LexiconPack::IsStale(const Sources& sources, const std::string& packPath)
+    {
+        std::error_code error;
+        const auto packTime = std::filesystem::last_write_time(packPath, error);
+        if (error)
+        {
+            return true;
+        }
+
+        for (const std::string* source : { &sources.dictionary, &sources.prefixes, &sources.nsfw })
+        {
+            const auto sourceTime = std::filesystem::last_write_time(*source, error);
+            if (!error && sourceTime > packTime)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::string LexiconPack::Compile(const Sources& sources, const std::string& packPath)
+    {
+        const std::vector<std::string> dictionaryWords = SortedWords(sources.dictionary, "words", true);
+        const std::vector<std::string> prefixWords = SortedWords(sources.prefixes, "prefixes", false);
+        const std::vector<std::string> nsfwWords = SortedWords(sources.nsfw, "nsfw", true);
+        if (dictionaryWords.empty())
+        {
+            std::cerr << "Error: Lexicon pack has no dictionary words: " << sources.dictionary << std::endl;
+            return "";
+        }
+
+        const FrontCodedWordList dictionaryList = FrontCodedWordList::FromSorted(dictionaryWords);
+        const FrontCodedWordList prefixList = FrontCodedWordList::FromSorted(prefixWords);
+        const FrontCodedWordList nsfwList = FrontCodedWordList::FromSorted(nsfwWords);
+        PerfectHashIndex dictionaryIndex, nsfwIndex;
+        if (!dictionaryIndex.Build(dictionaryList) || !nsfwIndex.Build(nsfwList))
+        {
+            std::cerr << "Error: Could not build the lexicon pack index for " << packPath << std::endl;
+            return "";
+        }
+
+        PackHeader header{};
+        header.magic = PackMagic;
+        header.version = PackVersion;
+        std::vector<uint8_t> bytes(sizeof(PackHeader), 0);
+        header.dictionary = AppendList(bytes, dictionaryList);
+        header.prefixes = AppendList(bytes, prefixList);
+        header.nsfw = AppendList(bytes, nsfwList);
+        header.dictionaryIndex = AppendIndex(bytes, dictionaryIndex);
+        header.nsfwIndex = AppendIndex(bytes, nsfwIndex);
+        std::copy_n(reinterpret_cast<const uint8_t*>(&header), sizeof(header), bytes.begin());
+
+        const std::string tempPath = packPath + ".tmp";
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!out)
+            {
+                std::cerr << "Error: Could not write lexicon pack: " << tempPath << std::endl;
+                return "";
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(tempPath, packPath, error);
+        if (error)
+        {
+            // Windows refuses to replace a file that is mapped, by another instance for example
+            std::cerr << "Error: Could not replace lexicon pack " << packPath << ": " << error.message() << std::endl;
+            std::filesystem::remove(tempPath, error);
+            return "";
+        }
+
+        std::cout << "Lexicon pack compiled: " << packPath << " (" << dictionaryWords.size() << " words, "
+            << bytes.size() / 1024 << " KB)" << std::endl;
+        return packPath;
+    }
+
+    std::shared_ptr<LexiconPack> LexiconPack::Open(const std::string& packPath)
+    {
+        auto pack = std::make_shared<LexiconPack>();
+        if (!pack->file.Open(packPath))
+        {
+            return nullptr;
+        }
+
+        const uint8_t* base = pack->file.Data();
+        const size_t fileSize = pack->file.Size();
+        PackHeader header{};
+        if (fileSize < sizeof(header))
+        {
+            std::cerr << "Error: Lexicon pack is truncated: " << packPath << std::endl;
+            return nullptr;
+        }
+        std::copy_n(base, sizeof(header), reinterpret_cast<uint8_t*>(&header));
+
+        if (header.magic != PackMagic || header.version != PackVersion
+            || !ValidList(header.dictionary, fileSize) || !ValidList(header.prefixes, fileSize) || !ValidList(header.nsfw, fileSize)
+            || !ValidIndex(header.dictionaryIndex, header.dictionary, fileSize) || !ValidIndex(header.nsfwIndex, header.nsfw, fileSize))
+        {
+            std::cerr << "Error: Invalid lexicon pack: " << packPath << std::endl;
+            return nullptr;
+        }
+
+        auto list = [base](const ListSection& section)
+        {
+            return FrontCodedWordList::FromMapped(base + section.dataOffset, static_cast<size_t>(section.dataSize),
+                reinterpret_cast<const uint32_t*>(base + section.bucketOffset), static_cast<size_t>(section.bucketCount),
+                static_cast<size_t>(section.wordCount));
+        };
+        auto index = [base](const IndexSection& section)
+        {
+            return PerfectHashIndex::FromMapped(section.seed,
+                reinterpret_cast<const uint32_t*>(base + section.displacementOffset), static_cast<size_t>(section.displacementCount),
+                reinterpret_cast<const uint32_t*>(base + section.fingerprintOffset), static_cast<size_t>(section.fingerprintCount));
+        };
+
+        pack->dictionary = list(header.dictionary);
+        pack->prefixes = list(header.prefixes);
+        pack->nsfw = list(header.nsfw);
+        pack->dictionaryIndex = index(header.dictionaryIndex);
+        pack->nsfwIndex = index(header.nsfwIndex);
+        if (pack->dictionaryIndex.size() != header.dictionaryIndex.fingerprintCount || pack->nsfwIndex.size() != header.nsfwIndex.fingerprintCount)
+        {
+            std::cerr << "Error: Invalid lexicon pack index: " << packPath << std::endl;
+            return nullptr;
+        }
+        return pack;
+    }
+}
@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : LexiconPack.h
+/// @Brief : Declares LexiconPack, the compiled word lists of one locale
+///          (dictionary, prefixes and NSFW list) in a single binary file.
+///          The file holds the front coded lists and the perfect hash tables
+///          exactly as they are used, so opening a pack is a memory mapping
+///          plus a header check; nothing is parsed or copied, and instances
+///          of the game running on the same machine share the pages.
+///          Packs are compiled from the locale's JSON word lists whenever
+///          those are newer than the pack.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _LEXICON_PACK_H_
+#define _LEXICON_PACK_H_
+#include "FrontCodedWordList.h"
+#include "MappedFile.h"
+#include "PerfectHashIndex.h"
+#include <memory>
+#include <string>
+
+namespace Framework
+{
+    /**
+     * @class LexiconPack
+     * @brief Read-only, memory mapped word lists of one locale.
+     */
+    class LexiconPack
+    {
+    public:
+        /**
+         * @brief JSON word lists a pack is compiled from.
+         */
+        struct Sources
+        {
+            std::string dictionary;     // "words" array
+            std::string prefixes;       // "prefixes" array
+            std::string nsfw;           // "nsfw" array
+        };
+
+        /**
+         * @brief Whether the pack is missing or older than one of its sources.
+         */
+        static bool IsStale(const Sources& sources, const std::string& packPath);
+
+        /**
+         * @brief Parses the sources and writes the pack. The file is written next to the
+         *        target and renamed over it, so a reader never sees a partial pack.
+         * @return packPath, or empty on failure (including when the old pack is mapped and
+         *         cannot be replaced).
+         */
+        static std::string Compile(const Sources& sources, const std::string& packPath);
+
+        /**
+         * @brief Maps a compiled pack.
+         * @return The pack, or nullptr if the file is missing or not a valid pack.
+         */
+        static std::shared_ptr<LexiconPack> Open(const std::string& packPath);
+
+        const FrontCodedWordList& GetDictionary() const { return dictionary; }
+        const FrontCodedWordList& GetPrefixes() const { return prefixes; }
+        const FrontCodedWordList& GetNSFW() const { return nsfw; }
+
+        bool ContainsWord(const std::string& word) const { return dictionaryIndex.Contains(word); }
+        bool IsNSFW(const std::string& word) const { return nsfwIndex.Contains(word); }
+
+        /**
+         * @brief Bytes of the mapped file (address space, not private memory).
+         */
+        size_t MappedSize() const { return file.Size(); }
+
+        LexiconPack() = default;
+        LexiconPack(const LexiconPack&) = delete;
+        LexiconPack& operator=(const LexiconPack&) = delete;
+
+    private:
+        MappedFile file;                        // Every view below points into this mapping
+        FrontCodedWordList dictionary;
+        PerfectHashIndex dictionaryIndex;
+        FrontCodedWordList prefixes;            // Sorted, order does not matter for random picks
+        FrontCodedWordList nsfw;
+        PerfectHashIndex nsfwIndex;
+    };
+}
+#endif // !_LEXICON_PACK_H_
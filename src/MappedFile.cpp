@@ -0,0 +1,145 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : MappedFile.cpp
+/// @Brief : Implements MappedFile with CreateFileMapping on Windows and mmap
+///          everywhere else.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "MappedFile.h"
+#include <iostream>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Framework
+{
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            std::swap(data, other.data);
+            std::swap(size, other.size);
+#if defined(_WIN32)
+            std::swap(fileHandle, other.fileHandle);
+            std::swap(mappingHandle, other.mappingHandle);
+#endif
+        }
+        return *this;
+    }
+
+#if defined(_WIN32)
+    bool MappedFile::Open(const std::string& path)
+    {
+        Close();
+
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            std::cerr << "Could not open file for mapping: " << path << std::endl;
+            return false;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (!view)
+        {
+            std::cerr << "Could not map file: " << path << std::endl;
+            if (mapping)
+                CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        data = static_cast<const uint8_t*>(view);
+        size = static_cast<size_t>(fileSize.QuadPart);
+        fileHandle = file;
+        mappingHandle = mapping;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (data)
+            UnmapViewOfFile(data);
+        if (mappingHandle)
+            CloseHandle(static_cast<HANDLE>(mappingHandle));
+        if (fileHandle)
+            CloseHandle(static_cast<HANDLE>(fileHandle));
+        data = nullptr;
+        size = 0;
+        fileHandle = nullptr;
+        mappingHandle = nullptr;
+    }
+#else
+    bool MappedFile::Open(const std::string& path)
+    {
+        Close();
+
+        const int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0)
+        {
+            std::cerr << "Could not open file for mapping: " << path << std::endl;
+            return false;
+        }
+
+        struct stat info {};
+        if (fstat(file, &info) != 0 || info.st_size == 0)
+        {
+            ::close(file);
+            return false;
+        }
+
+        // The mapping keeps its own reference to the file, the descriptor is not needed afterwards
+        void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, file, 0);
+        ::close(file);
+        if (view == MAP_FAILED)
+        {
+            std::cerr << "Could not map file: " << path << std::endl;
+            return false;
+        }
+
+        data = static_cast<const uint8_t*>(view);
+        size = static_cast<size_t>(info.st_size);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (data)
+            munmap(const_cast<uint8_t*>(data), size);
+        data = nullptr;
+        size = 0;
+    }
+#endif
+}
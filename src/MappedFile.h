@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : MappedFile.h
+/// @Brief : Declares MappedFile, a read-only memory mapping of a whole file.
+///          Pages are loaded by the OS on first touch and, being read-only
+///          file pages, are shared between every process that maps the same
+///          file, so two game instances on one machine keep a single copy.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _MAPPED_FILE_H_
+#define _MAPPED_FILE_H_
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Framework
+{
+    /**
+     * @class MappedFile
+     * @brief Owns a read-only view of a file. Move only; the view is released on destruction.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { Close(); }
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /**
+         * @brief Maps the file. Any previous mapping is released first.
+         * @return False if the file could not be opened or mapped, or is empty.
+         */
+        bool Open(const std::string& path);
+
+        void Close();
+
+        const uint8_t* Data() const { return data; }
+        size_t Size() const { return size; }
+        bool IsOpen() const { return data != nullptr; }
+
+    private:
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+#if defined(_WIN32)
+        void* fileHandle = nullptr;
+        void* mappingHandle = nullptr;
+#endif
+    };
+}
+#endif // !_MAPPED_FILE_H_
@@ -0,0 +1,307 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : Metrics.cpp
+/// @Brief : Implements the metrics registry, the lock-free metric types and
+///          the Prometheus text / JSON exporters.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "Metrics.h"
+#include "JsonSerialize.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace Framework
+{
+    MetricsRegistry GlobalMetrics;
+
+    /*************/
+    //   Gauge   //
+    /*************/
+
+    void Gauge::Add(double amount)
+    {
+        double current = value.load(std::memory_order_relaxed);
+        while (!value.compare_exchange_weak(current, current + amount, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /*****************/
+    //   Histogram   //
+    /*****************/
+
+    int Histogram::BucketIndex(uint64_t sample)
+    {
+        // Values below the sub bucket count are stored exactly
+        if (sample < SubBucketCount)
+        {
+            return static_cast<int>(sample);
+        }
+
+        int highestBit = 63;
+        while (!(sample & (uint64_t(1) << highestBit)))
+        {
+            --highestBit;
+        }
+
+        // Keep the top SubBucketBits + 1 bits, the leading one selects the octave
+        const int shift = highestBit - SubBucketBits;
+        return (shift + 1) * SubBucketCount + static_cast<int>((sample >> shift) - SubBucketCount);
+    }
+
+    uint64_t Histogram::BucketUpperBound(int index)
+    {
+        if (index < SubBucketCount)
+        {
+            return static_cast<uint64_t>(index);
+        }
+
+        const int shift = index / SubBucketCount - 1;
+        const uint64_t subBucket = static_cast<uint64_t>(index % SubBucketCount + SubBucketCount);
+        if (shift + SubBucketBits >= 63 && subBucket == 2 * SubBucketCount - 1)
+        {
+            return UINT64_MAX;
+        }
+        return ((subBucket + 1) << shift) - 1;
+    }
+
+    void Histogram::Record(uint64_t sample)
+    {
+        buckets[BucketIndex(sample)].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(sample, std::memory_order_relaxed);
+
+        uint64_t currentMin = min.load(std::memory_order_relaxed);
+        while (sample < currentMin && !min.compare_exchange_weak(currentMin, sample, std::memory_order_relaxed))
+        {
+        }
+        uint64_t currentMax = max.load(std::memory_order_relaxed);
+        while (sample > currentMax && !max.compare_exchange_weak(currentMax, sample, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    uint64_t Histogram::Min() const
+    {
+        const uint64_t value = min.load(std::memory_order_relaxed);
+        return value == UINT64_MAX ? 0 : value;
+    }
+
+    uint64_t Histogram::Percentile(double quantile) const
+    {
+        const uint64_t total = Count();
+        if (total == 0)
+        {
+            return 0;
+        }
+
+        const uint64_t rank = static_cast<uint64_t>(quantile * static_cast<double>(total - 1)) + 1;
+        uint64_t seen = 0;
+        for (int i = 0; i < BucketCount; ++i)
+        {
+            seen += BucketSamples(i);
+            if (seen >= rank)
+            {
+                // The bucket bound can overshoot the largest sample actually recorded
+                return std::min(BucketUpperBound(i), Max());
+            }
+        }
+        return Max();
+    }
+
+    /***********************/
+    //   MetricsRegistry   //
+    /***********************/
+
+    template <typename T>
+    T& MetricsRegistry::GetOrCreate(std::map<std::string, Entry<T>>& metrics, const std::string& name, const std::string& help)
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        Entry<T>& entry = metrics[name];
+        if (!entry.metric)
+        {
+            entry.metric = std::make_unique<T>();
+            entry.help = help;
+        }
+        return *entry.metric;
+    }
+
+    Counter& MetricsRegistry::GetCounter(const std::string& name, const std::string& help)
+    {
+        return GetOrCreate(counters, name, help);
+    }
+
+    Gauge& MetricsRegistry::GetGauge(const std::string& name, const std::string& help)
+    {
+        return GetOrCreate(gauges, name, help);
+    }
+
+    Histogram& MetricsRegistry::GetHistogram(const std::string& name, const std::string& help)
+    {
+        return GetOrCreate(histograms, name, help);
+    }
+
+    void MetricsRegistry::Initialize()
+    {
+        frameTime = &GetHistogram("ue_frame_time_us", "Frame time in microseconds");
+        std::cout << "Metrics initialized." << std::endl;
+    }
+
+    void MetricsRegistry::Update(float deltaTime)
+    {
+        if (frameTime && deltaTime > 0.0f)
+        {
+            frameTime->Record(static_cast<uint64_t>(deltaTime * 1000000.0f));
+        }
+
+        if (dumpPath.empty())
+        {
+            return;
+        }
+
+        timeSinceDump += deltaTime;
+        if (timeSinceDump >= dumpInterval)
+        {
+            timeSinceDump = 0.0f;
+            WriteToFile(dumpPath, dumpFormat);
+        }
+    }
+
+    void MetricsRegistry::StartPeriodicDump(const std::string& filePath, Format format, float intervalSeconds)
+    {
+        dumpPath = filePath;
+        dumpFormat = format;
+        dumpInterval = intervalSeconds;
+        timeSinceDump = 0.0f;
+    }
+
+    bool MetricsRegistry::WriteToFile(const std::string& filePath, Format format) const
+    {
+        const std::string text = (format == Format::Prometheus) ? ToPrometheus() : ToJson();
+
+        // Write to a temporary file first so a reader never sees a partial dump
+        const std::string tempPath = filePath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+            {
+                std::cerr << "Failed to open metrics file: " << tempPath << std::endl;
+                return false;
+            }
+            file << text;
+        }
+
+        std::remove(filePath.c_str());
+        if (std::rename(tempPath.c_str(), filePath.c_str()) != 0)
+        {
+            std::cerr << "Failed to write metrics file: " << filePath << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    std::string MetricsRegistry::ToPrometheus() const
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        std::ostringstream out;
+
+        for (const auto& [name, entry] : counters)
+        {
+            if (!entry.help.empty())
+                out << "# HELP " << name << " " << entry.help << "\n";
+            out << "# TYPE " << name << " counter\n";
+            out << name << " " << entry.metric->Value() << "\n";
+        }
+
+        for (const auto& [name, entry] : gauges)
+        {
+            if (!entry.help.empty())
+                out << "# HELP " << name << " " << entry.help << "\n";
+            out << "# TYPE " << name << " gauge\n";
+            out << name << " " << entry.metric->Value() << "\n";
+        }
+
+        for (const auto& [name, entry] : histograms)
+        {
+            const Histogram& histogram = *entry.metric;
+            if (!entry.help.empty())
+                out << "# HELP " << name << " " << entry.help << "\n";
+            out << "# TYPE " << name << " histogram\n";
+
+            // Prometheus buckets are cumulative, empty buckets are skipped to keep the dump small
+            uint64_t cumulative = 0;
+            for (int i = 0; i < Histogram::BucketCount; ++i)
+            {
+                const uint64_t samples = histogram.BucketSamples(i);
+                if (samples == 0)
+                    continue;
+                cumulative += samples;
+                out << name << "_bucket{le=\"" << Histogram::BucketUpperBound(i) << "\"} " << cumulative << "\n";
+            }
+            out << name << "_bucket{le=\"+Inf\"} " << histogram.Count() << "\n";
+            out << name << "_sum " << histogram.Sum() << "\n";
+            out << name << "_count " << histogram.Count() << "\n";
+        }
+
+        return out.str();
+    }
+
+    std::string MetricsRegistry::ToJson() const
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        rapidjson::StringBuffer buffer;
+        rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+
+        writer.StartObject();
+
+        writer.Key("timestamp");
+        writer.Int64(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+        writer.Key("counters");
+        writer.StartObject();
+        for (const auto& [name, entry] : counters)
+        {
+            writer.Key(name.c_str());
+            writer.Uint64(entry.metric->Value());
+        }
+        writer.EndObject();
+
+        writer.Key("gauges");
+        writer.StartObject();
+        for (const auto& [name, entry] : gauges)
+        {
+            writer.Key(name.c_str());
+            writer.Double(entry.metric->Value());
+        }
+        writer.EndObject();
+
+        writer.Key("histograms");
+        writer.StartObject();
+        for (const auto& [name, entry] : histograms)
+        {
+            const Histogram& histogram = *entry.metric;
+            writer.Key(name.c_str());
+            writer.StartObject();
+            writer.Key("count"); writer.Uint64(histogram.Count());
+            writer.Key("sum");   writer.Uint64(histogram.Sum());
+            writer.Key("min");   writer.Uint64(histogram.Min());
+            writer.Key("max");   writer.Uint64(histogram.Max());
+            writer.Key("p50");   writer.Uint64(histogram.Percentile(0.50));
+            writer.Key("p90");   writer.Uint64(histogram.Percentile(0.90));
+            writer.Key("p99");   writer.Uint64(histogram.Percentile(0.99));
+            writer.EndObject();
+        }
+        writer.EndObject();
+
+        writer.EndObject();
+        return buffer.GetString();
+    }
+}
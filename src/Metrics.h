@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : Metrics.h
+/// @Brief : Declares the metrics registry used by engine subsystems to publish
+///          machine readable counters, gauges and histograms (frame times,
+///          load latencies, pool occupancy, ...). Registration is done once
+///          under a mutex and returns a stable reference; updating a metric
+///          afterwards is a lock-free atomic operation, so metrics can be
+///          recorded from worker threads. The registry can be dumped to a
+///          file in Prometheus text or JSON format, either on demand or
+///          periodically from Update().
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _METRICS_H_
+#define _METRICS_H_
+#include "pch.h"
+#include "System.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace Framework
+{
+    /**
+     * @class Counter
+     * @brief Monotonically increasing count (e.g. textures loaded).
+     */
+    class Counter
+    {
+    public:
+        void Increment(uint64_t amount = 1) { value.fetch_add(amount, std::memory_order_relaxed); }
+        uint64_t Value() const { return value.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<uint64_t> value{ 0 };
+    };
+
+    /**
+     * @class Gauge
+     * @brief Value that can go up and down (e.g. active audio channels).
+     */
+    class Gauge
+    {
+    public:
+        void Set(double newValue) { value.store(newValue, std::memory_order_relaxed); }
+        void Add(double amount);
+        double Value() const { return value.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<double> value{ 0.0 };
+    };
+
+    /**
+     * @class Histogram
+     * @brief Log-linear (HDR style) histogram of non-negative integer samples.
+     *        Every power of two is split into 16 linear sub buckets, so any
+     *        recorded value is reported within 6.25% of its true value while
+     *        the whole 64-bit range fits in a fixed array of atomic counters.
+     */
+    class Histogram
+    {
+    public:
+        static constexpr int SubBucketBits = 4;
+        static constexpr int SubBucketCount = 1 << SubBucketBits;
+        static constexpr int BucketCount = (64 - SubBucketBits + 1) * SubBucketCount;
+
+        /**
+         * @brief Records one sample.
+         */
+        void Record(uint64_t sample);
+
+        /**
+         * @brief Records a duration in microseconds.
+         */
+        void RecordMicroseconds(std::chrono::steady_clock::duration duration)
+        {
+            Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+        }
+
+        uint64_t Count() const { return count.load(std::memory_order_relaxed); }
+        uint64_t Sum() const { return sum.load(std::memory_order_relaxed); }
+        uint64_t Min() const;
+        uint64_t Max() const { return max.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Approximate value at the given quantile.
+         * @param quantile Between 0 and 1 (0.99 = p99).
+         */
+        uint64_t Percentile(double quantile) const;
+
+        uint64_t BucketSamples(int index) const { return buckets[index].load(std::memory_order_relaxed); }
+
+        static int BucketIndex(uint64_t sample);
+        static uint64_t BucketUpperBound(int index);   // Largest value stored in a bucket
+
+    private:
+        std::array<std::atomic<uint64_t>, BucketCount> buckets{};
+        std::atomic<uint64_t> count{ 0 };
+        std::atomic<uint64_t> sum{ 0 };
+        std::atomic<uint64_t> min{ UINT64_MAX };
+        std::atomic<uint64_t> max{ 0 };
+    };
+
+    /**
+     * @class MetricsRegistry
+     * @brief Owns every metric and exports them. Subsystems fetch their metrics once
+     *        (typically into a function-local static reference) and update them freely.
+     *        Metric names follow Prometheus conventions, e.g. "ue_texture_load_us".
+     */
+    class MetricsRegistry : public ISystem
+    {
+    public:
+        enum class Format
+        {
+            Prometheus,
+            Json
+        };
+
+        /**
+         * @brief Returns the metric with the given name, creating it on first use.
+         *        The reference stays valid for the lifetime of the registry.
+         */
+        Counter& GetCounter(const std::string& name, const std::string& help = "");
+        Gauge& GetGauge(const std::string& name, const std::string& help = "");
+        Histogram& GetHistogram(const std::string& name, const std::string& help = "");
+
+        /**
+         * @brief Registers the frame time histogram.
+         */
+        void Initialize() override;
+
+        /**
+         * @brief Records the frame time and writes the periodic dump when it is due.
+         */
+        void Update(float deltaTime) override;
+
+        std::string GetName() override { return "Metrics"; }
+
+        /**
+         * @brief Writes every metric to the given file on a fixed interval.
+         * @param filePath Output file, replaced on every dump.
+         * @param format Prometheus text exposition or JSON.
+         * @param intervalSeconds Time between dumps.
+         */
+        void StartPeriodicDump(const std::string& filePath, Format format, float intervalSeconds = 5.0f);
+        void StopPeriodicDump() { dumpPath.clear(); }
+
+        /**
+         * @brief Writes every metric to a file once.
+         * @return True if the file was written.
+         */
+        bool WriteToFile(const std::string& filePath, Format format) const;
+
+        std::string ToPrometheus() const;
+        std::string ToJson() const;
+
+    private:
+        template <typename T>
+        struct Entry
+        {
+            std::string help;
+            std::unique_ptr<T> metric;
+        };
+
+        template <typename T>
+        T& GetOrCreate(std::map<std::string, Entry<T>>& metrics, const std::string& name, const std::string& help);
+
+        mutable std::mutex registryMutex;                       // Guards the maps, not the metric values
+        std::map<std::string, Entry<Counter>> counters;
+        std::map<std::string, Entry<Gauge>> gauges;
+        std::map<std::string, Entry<Histogram>> histograms;
+
+        Histogram* frameTime = nullptr;
+        std::string dumpPath;
+        Format dumpFormat = Format::Json;
+        float dumpInterval = 5.0f;
+        float timeSinceDump = 0.0f;
+    };
+
+    extern MetricsRegistry GlobalMetrics;   // Global instance of the metrics registry
+}
+#endif // !_METRICS_H_
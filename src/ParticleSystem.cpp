@@ -17,6 +17,9 @@
 #include "ParticleSystem.h"
 #include "Coordinator.h"
 #include "InputHandler.h"
+#include "Metrics.h"
+#include "EntityPool.h"
+#include "SpriteBatcher.h"
 
 extern Framework::Coordinator ecsInterface;
 namespace Framework
@@ -32,6 +35,7 @@ namespace Framework
         InputHandlerInstance = InputHandler::GetInstance();
         particleMesh = &Graphics::getMesh("sprite");
         particles.resize(maxParticles);
+        particleTextureSlots.resize(maxParticles);
     }
 
     void ParticleSystem::Initialize()
@@ -44,6 +48,7 @@ namespace Framework
         InputHandlerInstance = InputHandler::GetInstance();
         particleMesh = &Graphics::getMesh("sprite");
         particles.resize(maxParticles);
+        particleTextureSlots.assign(maxParticles, 0);
         for (ParticleComponent& p : particles)
         {
             p.active = false;
@@ -60,6 +65,12 @@ namespace Framework
 
         for (auto const& entityId : mEntities)
         {
+            // Parked pool instances keep their particle component but emit nothing
+            if (!GlobalEntityPool.IsActive(entityId))
+            {
+                continue;
+            }
+
             // Conditions for how particles will be emitted
             if (ecsInterface.HasComponent<CollisionComponent>(entityId))
             {
@@ -99,29 +110,37 @@ namespace Framework
             */
         }
 
-        for (ParticleComponent& p : particles)
+        // The batched scene pass draws the particles with the sprites
+        UpdateParticles(deltaTime, !GlobalSpriteBatcher.IsSceneRendering());
+    }
+
+    void ParticleSystem::UpdateParticles(float deltaTime, bool render)
+    {
+        static Gauge& activeParticles = GlobalMetrics.GetGauge("ue_particles_active", "Active particles in the pool");
+        static Gauge& poolSize = GlobalMetrics.GetGauge("ue_particle_pool_size", "Particles allocated in the pool");
+        size_t activeCount = 0;
+
+        for (size_t i = 0; i < particles.size(); ++i)
         {
+            ParticleComponent& p = particles[i];
             if (p.active)
             {
-                // Convert world position to viewport space (Main Viewport)
-                /*float viewportX = ((p.position.x - Graphics::viewportOffsetX) / Graphics::viewportWidth) * Graphics::viewportWidth + Graphics::viewportOffsetX;
-                float viewportY = ((p.position.y - Graphics::viewportOffsetY) / Graphics::viewportHeight) * Graphics::viewportHeight + Graphics::viewportOffsetY;
+                ++activeCount;
 
-                glm::vec2 viewportPos(viewportX, viewportY);
-                glm::vec2 viewportScale(p.size * (Graphics::viewportWidth / Graphics::viewportWidth),
-                    p.size * (Graphics::viewportHeight / Graphics::viewportHeight));*/
+                if (render)
+                {
+                    float normalizedX = (p.position.x / Graphics::projWidth) * Graphics::viewportWidth + Graphics::viewportOffsetX;
+                    float normalizedY = (p.position.y / Graphics::projHeight) * Graphics::viewportHeight + Graphics::viewportOffsetY;
 
-                float normalizedX = (p.position.x / Graphics::projWidth) * Graphics::viewportWidth + Graphics::viewportOffsetX;
-                float normalizedY = (p.position.y / Graphics::projHeight) * Graphics::viewportHeight + Graphics::viewportOffsetY;
+                    glm::vec2 viewportPos(normalizedX, normalizedY);
+                    glm::vec2 viewportScale(p.size * (Graphics::viewportWidth / Graphics::projWidth), p.size * (Graphics::viewportHeight / Graphics::projHeight));
 
-                glm::vec2 viewportPos(normalizedX, normalizedY);
-                glm::vec2 viewportScale(p.size * (Graphics::viewportWidth / Graphics::projWidth), p.size * (Graphics::viewportHeight / Graphics::projHeight));
-                
-                particleMesh->textureID = GlobalAssetManager.UE_LoadTextureToOpenGL(p.textureName);
-                particleMesh->modelMatrix = Graphics::calculate2DTransform(viewportPos, 0, viewportScale);
-                particleMesh->alpha = p.life / 5.0f;
-                particleMesh->color = p.color;
-                particleMesh->draw();
+                    particleMesh->textureID = GetSlotTexture(particleTextureSlots[i]);
+                    particleMesh->modelMatrix = Graphics::calculate2DTransform(viewportPos, 0, viewportScale);
+                    particleMesh->alpha = p.life / 5.0f;
+                    particleMesh->color = p.color;
+                    particleMesh->draw();
+                }
 
                 // Update particle movement
                 p.position += p.velocity * deltaTime;
@@ -134,6 +153,63 @@ namespace Framework
                 }
             }
         }
+
+        activeParticles.Set(static_cast<double>(activeCount));
+        poolSize.Set(static_cast<double>(particles.size()));
+    }
+
+    void ParticleSystem::SubmitParticles(SpriteBatcher& batcher)
+    {
+        const ViewportMapping mapping = SpriteBatcher::GetViewportMapping();
+        const glm::vec2 ratio = mapping.viewportSize / mapping.projectionSize;
+
+        for (size_t i = 0; i < particles.size(); ++i)
+        {
+            const ParticleComponent& p = particles[i];
+            if (!p.active)
+            {
+                continue;
+            }
+
+            SpriteInstance sprite;
+            sprite.position = p.position * ratio + mapping.viewportOffset;
+            sprite.scale = glm::vec2(p.size, p.size) * ratio;
+            sprite.color = glm::vec4(p.color, p.life / 5.0f);
+            batcher.Submit(sprite, static_cast<uint32_t>(Layer::Foreground), 0, GetSlotTexture(particleTextureSlots[i]));
+        }
+    }
+
+    void ParticleSystem::InvalidateTextures()
+    {
+        textureSlotIDs.assign(textureSlotNames.size(), 0);
+    }
+
+    uint32_t ParticleSystem::GetTextureSlot(const std::string& textureName)
+    {
+        // A handful of particle textures, a linear search beats hashing
+        for (size_t slot = 0; slot < textureSlotNames.size(); ++slot)
+        {
+            if (textureSlotNames[slot] == textureName)
+            {
+                return static_cast<uint32_t>(slot);
+            }
+        }
+        textureSlotNames.push_back(textureName);
+        textureSlotIDs.push_back(0);
+        return static_cast<uint32_t>(textureSlotNames.size() - 1);
+    }
+
+    GLuint ParticleSystem::GetSlotTexture(uint32_t slot)
+    {
+        if (slot >= textureSlotIDs.size())
+        {
+            return 0;
+        }
+        if (textureSlotIDs[slot] == 0)
+        {
+            textureSlotIDs[slot] = GlobalAssetManager.UE_LoadTextureToOpenGL(textureSlotNames[slot]);
+        }
+        return textureSlotIDs[slot];
     }
 
     std::string ParticleSystem::GetName()
@@ -156,6 +232,7 @@ namespace Framework
                 if (particleData.emitTimer >= particleData.emitDelay)       // Only emit if enough time has passed
                 {
                     glm::vec2 spawnPosition = transform.position;           // Get entity's position
+                    const uint32_t textureSlot = GetTextureSlot(particleData.textureName);
 
                     for (unsigned int i = 0; i < particleData.emissionRate; i++)
                     {
@@ -163,6 +240,7 @@ namespace Framework
                         if (p)
                         {
                             p->textureName = particleData.textureName;
+                            particleTextureSlots[p - particles.data()] = textureSlot;
                             p->position = spawnPosition;
                             p->velocity = randomVelocity(particleData.shape);
                             p->active = true;
@@ -186,6 +264,7 @@ namespace Framework
             std::string damageStr = std::to_string(damage); // Convert damage to string
 
             float offsetX = 0.0f; // Offset each digit slightly
+            const uint32_t textureSlot = GetTextureSlot("fire");
 
             for (char digit : damageStr)
             {
@@ -195,6 +274,7 @@ namespace Framework
                 {
                     //p->textureName = "hp_" + std::string(1, digit) + ".png"; // Assign texture based on digit
                     p->textureName = "fire";
+                    particleTextureSlots[p - particles.data()] = textureSlot;
                     p->position = spawnPosition + glm::vec2(offsetX, 0); // Offset each digit
                     p->velocity = glm::vec2(0.0f, -50.0f); // Move upward
                     p->active = true;
@@ -319,6 +399,7 @@ namespace Framework
 
             particles.clear();
             particles.resize(maxParticles);
+            particleTextureSlots.assign(maxParticles, GetTextureSlot(textureName));
 
             // Reset each particle
             for (auto& particle : particles)
@@ -28,6 +28,8 @@
 
 namespace Framework
 {
+	class SpriteBatcher;
+
 	class ParticleSystem : public ISystem
 	{
 	public:
@@ -47,7 +49,29 @@ namespace Framework
 		void Update(float deltaTime) override;
 		std::string GetName() override;
 
+		/**
+		 * @brief Moves, ages and (optionally) draws every active particle in the pool.
+		 * @param deltaTime Time since the last frame.
+		 * @param render Set to false to simulate without issuing draw calls (used by benchmarks).
+		 */
+		void UpdateParticles(float deltaTime, bool render = true);
+
+		/**
+		 * @brief Adds every active particle to a sprite batch, mapped to the viewport like the
+		 *        per-object draw. The batched scene pass uses this instead of drawing them here.
+		 */
+		void SubmitParticles(SpriteBatcher& batcher);
+
+		/**
+		 * @brief Forgets the OpenGL IDs of particle textures, so they are looked up by name again.
+		 *        Called when textures are reloaded or the texture manifest changes.
+		 */
+		void InvalidateTextures();
+
 		std::vector<ParticleComponent> particles;		// Dynamic Array of Particles
+		std::vector<uint32_t> particleTextureSlots;		// Same indexing as particles, set once per emission
+		std::vector<std::string> textureSlotNames;		// Texture name of each slot
+		std::vector<GLuint> textureSlotIDs;				// Same indexing as the names, 0 until looked up
 		unsigned int maxParticles = 10000;				// Maximum Number of Particles
 		glm::vec2 emitterPosition = { 0,0 };			// Position of the Particle Emitter
 
@@ -59,6 +83,8 @@ namespace Framework
 		InputHandler* InputHandlerInstance;
 
 	private:
+		uint32_t GetTextureSlot(const std::string& textureName);	// Slot of a texture name, added on first use
+		GLuint GetSlotTexture(uint32_t slot);						// OpenGL ID of a slot, loaded on first use
 		ParticleComponent* getInactiveParticle();		// Find an inactive particle to reuse
 		glm::vec2 randomVelocity();						// Generate some randomness in particle velocity
 		bool shouldEmit = false;						// Controls continuous emission
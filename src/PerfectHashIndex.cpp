@@ -0,0 +1,325 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : PerfectHashIndex.cpp
+/// @Brief : Implements the CHD minimal perfect hash. Keys are hashed into
+///          buckets of about two keys. Buckets are placed largest first by
+///          searching a displacement that sends all of their keys to free
+///          slots; buckets holding a single key take the next free slot
+///          directly, which is what keeps the table minimal without long
+///          searches at the end of the build.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "PerfectHashIndex.h"
+#include <algorithm>
+#include <istream>
+#include <ostream>
+
+namespace Framework
+{
+    namespace
+    {
+        constexpr uint32_t FileMagic = 0x48504D55;      // "UMPH"
+        constexpr uint32_t FileVersion = 1;
+        constexpr uint32_t MaxDisplacement = 1u << 20;  // Give up and reseed past this
+
+        inline uint32_t Fingerprint(uint64_t hash)
+        {
+            return static_cast<uint32_t>(hash >> 32);
+        }
+
+        // Reads in chunks, so a corrupt count fails at the end of the data instead of allocating it all up front
+        bool ReadTable(std::istream& in, std::vector<uint32_t>& table, size_t count)
+        {
+            constexpr size_t ChunkSize = 64 * 1024;
+            table.clear();
+            while (table.size() < count)
+            {
+                const size_t offset = table.size();
+                const size_t chunk = std::min(ChunkSize, count - offset);
+                table.resize(offset + chunk);
+                if (!in.read(reinterpret_cast<char*>(table.data() + offset), static_cast<std::streamsize>(chunk * sizeof(uint32_t))))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    uint64_t PerfectHashIndex::Mix(uint64_t value)
+    {
+        // MurmurHash3 64-bit finalizer
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+
+    uint64_t PerfectHashIndex::Hash(const std::string& key, uint64_t seed)
+    {
+        // FNV-1a over the bytes, then a finalizer so every output bit depends on every input bit
+        uint64_t hash = 0xcbf29ce484222325ULL ^ seed;
+        for (unsigned char c : key)
+        {
+            hash ^= c;
+            hash *= 0x100000001b3ULL;
+        }
+        return Mix(hash);
+    }
+
+    size_t PerfectHashIndex::Position(uint64_t hash, uint32_t displacement) const
+    {
+        if (displacement & DirectSlot)
+        {
+            return displacement & ~DirectSlot;
+        }
+        return static_cast<size_t>(Mix(hash ^ (static_cast<uint64_t>(displacement) * 0x9E3779B97F4A7C15ULL)) % fingerprintCount);
+    }
+
+    void PerfectHashIndex::Clear()
+    {
+        seed = 0;
+        displacements.clear();
+        fingerprints.clear();
+        ViewOwned();
+    }
+
+    void PerfectHashIndex::ViewOwned()
+    {
+        displacementTable = displacements.data();
+        displacementCount = displacements.size();
+        fingerprintTable = fingerprints.data();
+        fingerprintCount = fingerprints.size();
+    }
+
+    bool PerfectHashIndex::ValidTables(const uint32_t* displacementData, size_t displacementSize, size_t fingerprintSize)
+    {
+        if (displacementSize != (fingerprintSize + KeysPerBucket - 1) / KeysPerBucket)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < displacementSize; ++i)
+        {
+            if ((displacementData[i] & DirectSlot) && (displacementData[i] & ~DirectSlot) >= fingerprintSize)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    PerfectHashIndex PerfectHashIndex::FromMapped(uint64_t mappedSeed, const uint32_t* mappedDisplacements, size_t mappedDisplacementCount,
+        const uint32_t* mappedFingerprints, size_t mappedFingerprintCount)
+    {
+        PerfectHashIndex index;
+        if ((mappedDisplacementCount > 0 && !mappedDisplacements) || (mappedFingerprintCount > 0 && !mappedFingerprints)
+            || !ValidTables(mappedDisplacements, mappedDisplacementCount, mappedFingerprintCount))
+        {
+            return index;
+        }
+        index.seed = mappedSeed;
+        index.displacementTable = mappedDisplacements;
+        index.displacementCount = mappedDisplacementCount;
+        index.fingerprintTable = mappedFingerprints;
+        index.fingerprintCount = mappedFingerprintCount;
+        return index;
+    }
+
+    PerfectHashIndex::PerfectHashIndex(const PerfectHashIndex& other)
+        : seed(other.seed), displacements(other.displacements), fingerprints(other.fingerprints)
+    {
+        if (other.displacements.empty() && other.fingerprints.empty())
+        {
+            displacementTable = other.displacementTable;    // Mapped, share the same memory
+            displacementCount = other.displacementCount;
+            fingerprintTable = other.fingerprintTable;
+            fingerprintCount = other.fingerprintCount;
+        }
+        else
+        {
+            ViewOwned();
+        }
+    }
+
+    PerfectHashIndex& PerfectHashIndex::operator=(const PerfectHashIndex& other)
+    {
+        if (this != &other)
+        {
+            PerfectHashIndex copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    PerfectHashIndex::PerfectHashIndex(PerfectHashIndex&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    PerfectHashIndex& PerfectHashIndex::operator=(PerfectHashIndex&& other) noexcept
+    {
+        if (this != &other)
+        {
+            // Moving a vector keeps its buffer, so the views stay valid
+            seed = other.seed;
+            displacements = std::move(other.displacements);
+            fingerprints = std::move(other.fingerprints);
+            displacementTable = other.displacementTable;
+            displacementCount = other.displacementCount;
+            fingerprintTable = other.fingerprintTable;
+            fingerprintCount = other.fingerprintCount;
+
+            other.displacements.clear();
+            other.fingerprints.clear();
+            other.Clear();
+        }
+        return *this;
+    }
+
+    bool PerfectHashIndex::Place(const std::vector<uint64_t>& hashes, uint64_t newSeed)
+    {
+        Clear();
+        seed = newSeed;
+        if (hashes.empty())
+        {
+            return true;
+        }
+
+        const size_t slotCount = hashes.size();
+        const size_t bucketCount = (slotCount + KeysPerBucket - 1) / KeysPerBucket;
+        displacements.assign(bucketCount, 0);
+        fingerprints.assign(slotCount, 0);
+        ViewOwned();
+
+        std::vector<std::vector<uint32_t>> buckets(bucketCount);
+        for (size_t i = 0; i < slotCount; ++i)
+        {
+            buckets[hashes[i] % bucketCount].push_back(static_cast<uint32_t>(i));
+        }
+
+        std::vector<uint32_t> order(bucketCount);
+        for (size_t i = 0; i < bucketCount; ++i)
+        {
+            order[i] = static_cast<uint32_t>(i);
+        }
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+
+        std::vector<bool> taken(slotCount, false);
+        std::vector<size_t> positions;
+        size_t nextFree = 0;
+
+        for (uint32_t bucket : order)
+        {
+            const std::vector<uint32_t>& members = buckets[bucket];
+            if (members.empty())
+            {
+                break;  // Sorted by size, the rest are empty too
+            }
+
+            if (members.size() == 1)
+            {
+                while (taken[nextFree])
+                {
+                    ++nextFree;
+                }
+                taken[nextFree] = true;
+                fingerprints[nextFree] = Fingerprint(hashes[members[0]]);
+                displacements[bucket] = static_cast<uint32_t>(nextFree) | DirectSlot;
+                continue;
+            }
+
+            // Search a displacement that sends every key of the bucket to a distinct free slot
+            bool placed = false;
+            for (uint32_t displacement = 0; displacement < MaxDisplacement && !placed; ++displacement)
+            {
+                positions.clear();
+                placed = true;
+                for (uint32_t member : members)
+                {
+                    const size_t position = Position(hashes[member], displacement);
+                    if (taken[position] || std::find(positions.begin(), positions.end(), position) != positions.end())
+                    {
+                        placed = false;
+                        break;
+                    }
+                    positions.push_back(position);
+                }
+
+                if (placed)
+                {
+                    for (size_t i = 0; i < members.size(); ++i)
+                    {
+                        taken[positions[i]] = true;
+                        fingerprints[positions[i]] = Fingerprint(hashes[members[i]]);
+                    }
+                    displacements[bucket] = displacement;
+                }
+            }
+
+            if (!placed)
+            {
+                return false;   // Two keys with the same hash, retry with another seed
+            }
+        }
+
+        return true;
+    }
+
+    size_t PerfectHashIndex::Slot(const std::string& key) const
+    {
+        if (fingerprintCount == 0)
+        {
+            return NotFound;
+        }
+        const uint64_t hash = Hash(key, seed);
+        return Position(hash, displacementTable[hash % displacementCount]);
+    }
+
+    bool PerfectHashIndex::Contains(const std::string& key) const
+    {
+        if (fingerprintCount == 0)
+        {
+            return false;
+        }
+        const uint64_t hash = Hash(key, seed);
+        return fingerprintTable[Position(hash, displacementTable[hash % displacementCount])] == Fingerprint(hash);
+    }
+
+    void PerfectHashIndex::Save(std::ostream& out) const
+    {
+        const uint32_t header[4] = { FileMagic, FileVersion, static_cast<uint32_t>(displacementCount), static_cast<uint32_t>(fingerprintCount) };
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(&seed), sizeof(seed));
+        out.write(reinterpret_cast<const char*>(displacementTable), displacementCount * sizeof(uint32_t));
+        out.write(reinterpret_cast<const char*>(fingerprintTable), fingerprintCount * sizeof(uint32_t));
+    }
+
+    bool PerfectHashIndex::Load(std::istream& in)
+    {
+        Clear();
+
+        uint32_t header[4] = {};
+        in.read(reinterpret_cast<char*>(header), sizeof(header));
+        if (!in || header[0] != FileMagic || header[1] != FileVersion)
+        {
+            return false;
+        }
+
+        in.read(reinterpret_cast<char*>(&seed), sizeof(seed));
+        if (!in || !ReadTable(in, displacements, header[2]) || !ReadTable(in, fingerprints, header[3])
+            || !ValidTables(displacements.data(), displacements.size(), fingerprints.size()))
+        {
+            Clear();
+            return false;
+        }
+        ViewOwned();
+        return true;
+    }
+}
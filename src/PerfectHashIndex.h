@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : PerfectHashIndex.h
+/// @Brief : Declares PerfectHashIndex, a minimal perfect hash (CHD, "hash,
+///          displace and compress") over a fixed set of words. Every word of
+///          the set maps to its own slot in a table of exactly as many slots
+///          as there are words, and each slot stores a 32-bit fingerprint of
+///          the word it belongs to. Checking whether a string is in the set
+///          is one hash, one displacement lookup and one fingerprint compare,
+///          touching two small arrays. Strings outside the set are rejected
+///          unless their fingerprint collides (probability 2^-32).
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _PERFECT_HASH_INDEX_H_
+#define _PERFECT_HASH_INDEX_H_
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @class PerfectHashIndex
+     * @brief Constant time membership test for a static word set.
+     */
+    class PerfectHashIndex
+    {
+    public:
+        static constexpr size_t KeysPerBucket = 2;         // Average bucket load, larger buckets build much slower
+
+        /**
+         * @brief Builds the index from any range of unique strings (a vector, a FrontCodedWordList, ...).
+         *        Only the key hashes are kept while building.
+         * @return False if no placement was found (only with duplicate keys).
+         */
+        template <typename Range>
+        bool Build(const Range& keys)
+        {
+            std::vector<uint64_t> hashes;
+            for (int attempt = 0; attempt < MaxSeeds; ++attempt)
+            {
+                const uint64_t attemptSeed = Mix(static_cast<uint64_t>(attempt) + 1);
+                hashes.clear();
+                for (const std::string& key : keys)
+                {
+                    hashes.push_back(Hash(key, attemptSeed));
+                }
+                if (Place(hashes, attemptSeed))
+                {
+                    return true;
+                }
+            }
+            Clear();
+            return false;
+        }
+
+        /**
+         * @brief Whether the key is in the set.
+         */
+        bool Contains(const std::string& key) const;
+
+        static constexpr size_t NotFound = static_cast<size_t>(-1);
+
+        /**
+         * @brief Slot of a key in [0, size()). Only meaningful for keys in the set, which makes
+         *        it usable as a dense id for per-word data.
+         * @return NotFound if the index is empty.
+         */
+        size_t Slot(const std::string& key) const;
+
+        size_t size() const { return fingerprintCount; }
+        bool empty() const { return fingerprintCount == 0; }
+        void Clear();
+
+        /**
+         * @brief Heap memory used by the index, in bytes. A mapped index uses none.
+         */
+        size_t MemoryUsage() const { return (displacements.capacity() + fingerprints.capacity()) * sizeof(uint32_t); }
+
+        /**
+         * @brief Writes the index in a compact binary form, so it can be stored in a dictionary file.
+         */
+        void Save(std::ostream& out) const;
+
+        /**
+         * @brief Reads an index written by Save().
+         * @return False if the data is not a valid index.
+         */
+        bool Load(std::istream& in);
+
+        /**
+         * @brief Raw tables, used to store the index in a file that is mapped later.
+         */
+        uint64_t GetSeed() const { return seed; }
+        const uint32_t* GetDisplacements() const { return displacementTable; }
+        size_t GetDisplacementCount() const { return displacementCount; }
+        const uint32_t* GetFingerprints() const { return fingerprintTable; }
+
+        /**
+         * @brief Wraps tables that live elsewhere (a mapped file) without copying.
+         *        The memory must stay valid and unchanged for as long as the index is used.
+         *        The caller checks the tables lie inside the mapping; their contents are
+         *        checked here.
+         * @return An empty index if the tables are inconsistent.
+         */
+        static PerfectHashIndex FromMapped(uint64_t mappedSeed, const uint32_t* mappedDisplacements, size_t mappedDisplacementCount,
+            const uint32_t* mappedFingerprints, size_t mappedFingerprintCount);
+
+        PerfectHashIndex() = default;
+        PerfectHashIndex(const PerfectHashIndex& other);
+        PerfectHashIndex(PerfectHashIndex&& other) noexcept;
+        PerfectHashIndex& operator=(const PerfectHashIndex& other);
+        PerfectHashIndex& operator=(PerfectHashIndex&& other) noexcept;
+
+    private:
+        static constexpr uint32_t DirectSlot = 0x80000000u;    // Displacement holds the slot itself
+        static constexpr int MaxSeeds = 16;                     // Hash seeds tried before giving up
+
+        bool Place(const std::vector<uint64_t>& hashes, uint64_t newSeed);
+
+        static uint64_t Hash(const std::string& key, uint64_t seed);
+        static uint64_t Mix(uint64_t value);
+        size_t Position(uint64_t hash, uint32_t displacement) const;
+
+        // Bucket count matches the slot count and every direct slot is inside the table
+        static bool ValidTables(const uint32_t* displacementData, size_t displacementSize, size_t fingerprintSize);
+
+        // Rebinds the views below to the owned vectors
+        void ViewOwned();
+
+        uint64_t seed = 0;
+        std::vector<uint32_t> displacements;    // One per bucket, empty for a mapped index
+        std::vector<uint32_t> fingerprints;     // One per slot, empty for a mapped index
+
+        // What lookups read: the owned vectors or mapped memory
+        const uint32_t* displacementTable = nullptr;
+        size_t displacementCount = 0;
+        const uint32_t* fingerprintTable = nullptr;
+        size_t fingerprintCount = 0;
+    };
+}
+#endif // !_PERFECT_HASH_INDEX_H_
@@ -0,0 +1,332 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : RenderQueue.cpp
+/// @Brief : Implements the frame hand-off between simulation and the render
+///          thread, and GL work forwarding.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "RenderQueue.h"
+#include "Metrics.h"
+#include <GLFW/glfw3.h>
+#include <chrono>
+#include <iostream>
+
+namespace Framework
+{
+    RenderQueue GlobalRenderQueue;
+
+    /*******************/
+    //   Frame data    //
+    /*******************/
+
+    void FrameCommands::CaptureSprites(const SpriteBatcher& batcher)
+    {
+        sprites.assign(batcher.GetSortedInstances().begin(), batcher.GetSortedInstances().end());
+        spriteDraws.assign(batcher.GetCommands().begin(), batcher.GetCommands().end());
+    }
+
+    void FrameCommands::AddText(const TextLayoutCache::Layout& layout, glm::vec2 origin, const glm::vec4& color)
+    {
+        for (const GlyphQuad& quad : layout.glyphs)
+        {
+            if (quad.texture == 0)
+            {
+                continue;
+            }
+
+            // Sprite instances are centred, glyph quads are anchored at their bottom-left corner
+            SpriteInstance glyph;
+            glyph.position = origin + quad.offset + quad.size * 0.5f;
+            glyph.scale = quad.size;
+            glyph.color = color;
+
+            // Each glyph has its own texture, so only repeated letters share a draw
+            if (glyphDraws.empty() || glyphDraws.back().texture != quad.texture)
+            {
+                glyphDraws.push_back(SpriteDrawCommand{ quad.texture, static_cast<uint32_t>(glyphs.size()), 0 });
+            }
+            ++glyphDraws.back().instanceCount;
+            glyphs.push_back(glyph);
+        }
+    }
+
+    void FrameCommands::Clear()
+    {
+        // clear() keeps the capacity, a steady scene fills the same memory every frame
+        sprites.clear();
+        spriteDraws.clear();
+        glyphs.clear();
+        glyphDraws.clear();
+        releases.clear();
+    }
+
+    /*******************/
+    //   Thread        //
+    /*******************/
+
+    bool RenderQueue::Start(RenderFunction render, ContextFunction attachContext, ContextFunction detachContext)
+    {
+        if (IsRunning())
+        {
+            std::cerr << "Error: Render thread already running." << std::endl;
+            return false;
+        }
+
+        renderFrame = std::move(render);
+        stopRequested = false;
+        pendingIndex = renderingIndex = -1;
+        running.store(true, std::memory_order_release);
+
+        // The render thread waits on the lock until its ID is recorded
+        std::lock_guard<std::mutex> lock(mutex);
+        renderThread = std::thread(&RenderQueue::RenderLoop, this, std::move(attachContext), std::move(detachContext));
+        renderThreadId = renderThread.get_id();
+        return true;
+    }
+
+    bool RenderQueue::StartOnCurrentWindow()
+    {
+        if (IsRunning())
+        {
+            std::cerr << "Error: Render thread already running." << std::endl;
+            return false;
+        }
+
+        GLFWwindow* window = glfwGetCurrentContext();
+        if (window == nullptr)
+        {
+            std::cerr << "Error: No GL context to hand to the render thread." << std::endl;
+            return false;
+        }
+
+        glfwMakeContextCurrent(nullptr);    // A context can only be current on one thread
+        contextWindow = window;
+        const bool started = Start([this, window](const FrameCommands& frame)
+            {
+                glClear(GL_COLOR_BUFFER_BIT);
+                windowBatcher.DrawCommands(frame.sprites, frame.spriteDraws, frame.viewProjection);
+                if (windowGlyphBatcher.InitializeGL(SpriteBatcher::GlyphVertexShader, SpriteBatcher::GlyphFragmentShader))
+                {
+                    windowGlyphBatcher.DrawCommands(frame.glyphs, frame.glyphDraws, frame.viewProjection);
+                }
+                glfwSwapBuffers(window);
+            },
+            [window]() { glfwMakeContextCurrent(window); },
+            [this]()
+            {
+                windowBatcher.ShutdownGL();
+                windowGlyphBatcher.ShutdownGL();
+                glfwMakeContextCurrent(nullptr);
+            });
+        if (!started)
+        {
+            glfwMakeContextCurrent(window);
+            contextWindow = nullptr;
+        }
+        return started;
+    }
+
+    bool RenderQueue::IsWindowClosing() const
+    {
+        // Without the thread the window is the one current on the calling thread
+        GLFWwindow* window = contextWindow != nullptr ? contextWindow : glfwGetCurrentContext();
+        return window != nullptr && glfwWindowShouldClose(window);
+    }
+
+    void RenderQueue::Stop()
+    {
+        if (!renderThread.joinable())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopRequested = true;
+        }
+        renderWake.notify_one();
+        renderThread.join();
+        renderThreadId = std::thread::id();
+        running.store(false, std::memory_order_release);
+
+        // The render thread released the window's context, it belongs to this thread again
+        if (contextWindow != nullptr)
+        {
+            glfwMakeContextCurrent(contextWindow);
+            contextWindow = nullptr;
+        }
+
+        // Releases not yet published belong to frames that will never be drawn
+        for (auto& release : deferredReleases)
+        {
+            release();
+        }
+        deferredReleases.clear();
+    }
+
+    void RenderQueue::RenderLoop(ContextFunction attachContext, ContextFunction detachContext)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+        }
+        if (attachContext)
+        {
+            attachContext();
+        }
+
+        std::vector<std::function<void()>> work;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                renderWake.wait(lock, [this]() { return stopRequested || pendingIndex != -1 || !tasks.empty(); });
+
+                if (pendingIndex == -1 && tasks.empty())
+                {
+                    break;  // Stop requested and nothing left to do
+                }
+
+                work.assign(std::make_move_iterator(tasks.begin()), std::make_move_iterator(tasks.end()));
+                tasks.clear();
+                if (pendingIndex != -1)
+                {
+                    renderingIndex = pendingIndex;
+                    pendingIndex = -1;
+                }
+            }
+            simulationWake.notify_all();    // The pending slot is free to publish into again
+
+            // Uploads first, the frame may use what they create
+            if (!work.empty())
+            {
+                for (auto& task : work)
+                {
+                    task();
+                }
+                work.clear();
+                simulationWake.notify_all();    // Wakes Execute() callers
+            }
+
+            if (renderingIndex != -1)
+            {
+                FrameCommands& frame = frames[renderingIndex];
+                renderFrame(frame);
+                for (auto& release : frame.releases)
+                {
+                    release();
+                }
+
+                {
+                    // Counted under the lock, so a woken BeginFrame() never sees the slot free but the frame uncounted
+                    std::lock_guard<std::mutex> lock(mutex);
+                    renderingIndex = -1;
+                    renderedFrames.fetch_add(1, std::memory_order_release);
+                }
+                simulationWake.notify_all();
+            }
+        }
+
+        if (detachContext)
+        {
+            detachContext();
+        }
+    }
+
+    /*******************/
+    //   Hand-off      //
+    /*******************/
+
+    FrameCommands& RenderQueue::BeginFrame()
+    {
+        static Histogram& waitLatency = GlobalMetrics.GetHistogram("ue_render_wait_us", "Simulation time spent waiting for the render thread in microseconds");
+        const auto waitStart = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            simulationWake.wait(lock, [this]() { return pendingIndex != writeIndex && renderingIndex != writeIndex; });
+        }
+        waitLatency.RecordMicroseconds(std::chrono::steady_clock::now() - waitStart);
+
+        FrameCommands& frame = frames[writeIndex];
+        frame.Clear();
+        return frame;
+    }
+
+    void RenderQueue::Publish()
+    {
+        FrameCommands& frame = frames[writeIndex];
+        frame.frameNumber = ++publishedFrames;
+        for (auto& release : deferredReleases)
+        {
+            frame.releases.push_back(std::move(release));
+        }
+        deferredReleases.clear();
+
+        if (!IsRunning())
+        {
+            // Nothing draws it; still honour the releases
+            for (auto& release : frame.releases)
+            {
+                release();
+            }
+            frame.releases.clear();
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            simulationWake.wait(lock, [this]() { return pendingIndex == -1; });
+            pendingIndex = writeIndex;
+            writeIndex = 1 - writeIndex;
+        }
+        renderWake.notify_one();
+    }
+
+    void RenderQueue::Execute(const std::function<void()>& task)
+    {
+        if (!IsRunning() || IsRenderThread())
+        {
+            task();
+            return;
+        }
+
+        bool done = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back([this, &task, &done]()
+                {
+                    task();
+                    std::lock_guard<std::mutex> doneLock(mutex);
+                    done = true;
+                });
+        }
+        renderWake.notify_one();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        simulationWake.wait(lock, [&done]() { return done; });
+    }
+
+    void RenderQueue::ReleaseAfterFrame(std::function<void()> release)
+    {
+        if (!IsRunning())
+        {
+            release();
+            return;
+        }
+        deferredReleases.push_back(std::move(release));
+    }
+
+    void RenderQueue::WaitIdle()
+    {
+        if (!IsRunning())
+        {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        simulationWake.wait(lock, [this]() { return pendingIndex == -1 && renderingIndex == -1 && tasks.empty(); });
+    }
+}
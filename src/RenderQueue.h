@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : RenderQueue.h
+/// @Brief : Declares RenderQueue, which moves rendering onto its own thread.
+///          Simulation fills an immutable FrameCommands (sorted sprites and
+///          particles, text glyphs) and publishes it; the render thread
+///          draws frame N while simulation builds frame N+1. Two frame slots
+///          are used, so simulation is never more than one frame ahead.
+///
+///          GL ownership: while the queue runs, the GL context is current on
+///          the render thread only and every GL call must happen there.
+///            - Execute() runs GL work (texture creation and uploads by the
+///              AssetManager) on the render thread and waits for it.
+///            - ReleaseAfterFrame() defers GL deletes until the frames that
+///              may still reference the object have been drawn.
+///          GL object names are plain values in the frame, so the render
+///          thread never reads AssetManager containers.
+///          When the queue is not running, both run inline on the caller,
+///          which keeps the single threaded path unchanged.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _RENDER_QUEUE_H_
+#define _RENDER_QUEUE_H_
+#include "pch.h"
+#include "SpriteBatcher.h"
+#include "TextLayoutCache.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct GLFWwindow;
+
+namespace Framework
+{
+    /**
+     * @brief Everything the render thread needs to draw one frame. Built by simulation,
+     *        read-only once published.
+     */
+    struct FrameCommands
+    {
+        uint64_t frameNumber = 0;
+        glm::mat4 viewProjection{ 1.0f };
+
+        std::vector<SpriteInstance> sprites;            // Sprites and particles, in draw order
+        std::vector<SpriteDrawCommand> spriteDraws;
+        std::vector<SpriteInstance> glyphs;             // Text quads, drawn after the sprites with the font shader
+        std::vector<SpriteDrawCommand> glyphDraws;
+
+        std::vector<std::function<void()>> releases;    // GL deletes run after this frame is drawn
+
+        /**
+         * @brief Copies the batcher's sorted sprites and draw commands into the frame.
+         */
+        void CaptureSprites(const SpriteBatcher& batcher);
+
+        /**
+         * @brief Appends the glyphs of a laid-out text placed at origin (baseline, left).
+         */
+        void AddText(const TextLayoutCache::Layout& layout, glm::vec2 origin, const glm::vec4& color);
+
+        void Clear();
+    };
+
+    /**
+     * @class RenderQueue
+     * @brief Double-buffered hand-off of frames from simulation to the render thread.
+     *        BeginFrame() / Publish() are called from the simulation thread only.
+     */
+    class RenderQueue
+    {
+    public:
+        using RenderFunction = std::function<void(const FrameCommands&)>;
+        using ContextFunction = std::function<void()>;
+
+        ~RenderQueue() { Stop(); }     // Too late for a window queue, GLFW is gone by then: call Stop() first
+
+        /**
+         * @brief Starts the render thread.
+         * @param render Draws one frame, on the render thread.
+         * @param attachContext Makes the GL context current on the render thread (the caller must
+         *        have released it first). Empty for headless use.
+         * @param detachContext Releases the context before the thread exits, so the caller can
+         *        make it current again after Stop().
+         */
+        bool Start(RenderFunction render, ContextFunction attachContext = {}, ContextFunction detachContext = {});
+
+        /**
+         * @brief Starts the render thread on the GLFW window current on the calling thread. The
+         *        context moves to the render thread, which clears, draws each frame's sprites and
+         *        text and swaps buffers. The caller must not issue GL calls or swap until Stop().
+         */
+        bool StartOnCurrentWindow();
+
+        /**
+         * @brief Draws the frame already published, runs the pending GL work and joins the thread.
+         *        The render thread releases its GL objects, and a window's context is made current
+         *        on the calling thread again. Must be called before the window is destroyed.
+         */
+        void Stop();
+
+        /**
+         * @brief Whether the window the render thread draws to, or the one current on the calling
+         *        thread when the queue is not running, has been asked to close, so GL objects can
+         *        be released while the window still exists.
+         */
+        bool IsWindowClosing() const;
+
+        bool IsRunning() const { return running.load(std::memory_order_acquire); }
+        bool IsRenderThread() const { return std::this_thread::get_id() == renderThreadId; }
+
+        /**
+         * @brief Slot for the next frame, cleared. Waits while the render thread still draws
+         *        the frame that used it two frames ago.
+         */
+        FrameCommands& BeginFrame();
+
+        /**
+         * @brief Hands the frame from BeginFrame() to the render thread.
+         */
+        void Publish();
+
+        /**
+         * @brief Runs GL work on the render thread and waits for it. Inline when called from
+         *        the render thread or when the queue is not running.
+         */
+        void Execute(const std::function<void()>& task);
+
+        /**
+         * @brief Runs GL work, typically a delete, once every frame built so far has been
+         *        drawn. Inline when the queue is not running.
+         */
+        void ReleaseAfterFrame(std::function<void()> release);
+
+        /**
+         * @brief Waits until every published frame has been drawn.
+         */
+        void WaitIdle();
+
+        uint64_t GetPublishedFrames() const { return publishedFrames; }
+        uint64_t GetRenderedFrames() const { return renderedFrames.load(std::memory_order_acquire); }
+
+    private:
+        void RenderLoop(ContextFunction attachContext, ContextFunction detachContext);
+
+        FrameCommands frames[2];
+        int writeIndex = 0;             // Slot simulation fills next
+        int pendingIndex = -1;          // Published, not yet taken by the render thread
+        int renderingIndex = -1;        // Being drawn
+        uint64_t publishedFrames = 0;
+        std::atomic<uint64_t> renderedFrames{ 0 };
+        std::vector<std::function<void()>> deferredReleases;   // Collected until the next Publish()
+
+        RenderFunction renderFrame;
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+        std::condition_variable renderWake;     // Frame published, task queued or stop requested
+        std::condition_variable simulationWake; // Slot freed or task finished
+        bool stopRequested = false;
+        std::atomic<bool> running{ false };
+        std::thread renderThread;
+        std::thread::id renderThreadId;
+
+        // GL objects of the render thread started by StartOnCurrentWindow(), released by Stop()
+        GLFWwindow* contextWindow = nullptr;
+        SpriteBatcher windowBatcher;
+        SpriteBatcher windowGlyphBatcher;
+    };
+
+    extern RenderQueue GlobalRenderQueue;   // Global instance of the RenderQueue
+}
+#endif // !_RENDER_QUEUE_H_
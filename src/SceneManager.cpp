@@ -23,6 +23,19 @@
 #include "AssetManager.h"
 #include "EngineState.h"
 #include "PlayerSystem.h"
+#include "Metrics.h"
+#include "FrameScheduler.h"
+#include "TargetMatcher.h"
+#include "EntityPool.h"
+#include "TransformCache.h"
+#include "TextLayoutCache.h"
+#include "ThumbnailCache.h"
+#include "TimelineEvaluator.h"
+#include "TimingWheel.h"
+#include "RenderQueue.h"
+#include "SpatialHash.h"
+#include "SpriteBatcher.h"
+#include "VirtualFileSystem.h"
 
 extern Framework::Coordinator ecsInterface;
 
@@ -43,6 +56,40 @@ namespace Framework {
         GlobalSceneManager.nextScene = "";
         GlobalSceneManager.sceneTransitionFlag = false;
 
+        // Enemies waiting on their spawnTimer appear when their wheel timer fires
+        GlobalTimingWheel.SetHandler(TimerKind::EnemySpawn, [](const TimerEvent& event) {
+            if (ecsInterface.HasComponent<EnemyComponent>(event.entity)) {
+                auto& enemy = ecsInterface.GetComponent<EnemyComponent>(event.entity);
+                enemy.spawned = true;
+                enemy.spawnTimer = 0.0f;
+            }
+        });
+
+        // Broad phase once per fixed step: only colliders whose transform changed are moved
+        GlobalFrameScheduler.AddFixedPass([]() {
+            GlobalTransformCache.Refresh(SpriteBatcher::GetViewportMapping());
+            GlobalSpatialHash.Refresh(GlobalTransformCache.GetChangedEntities(), GlobalTransformCache.GetRemovedEntities());
+            GlobalTransformCache.ClearChanges();
+            GlobalSpatialHash.UpdateStepPairs();
+        });
+
+        // The batched scene pass draws after every system has updated, paused or not
+        GlobalFrameScheduler.AddRenderPass([]() {
+            // Thumbnail atlases are deleted while the window, and so the context, still exists
+            if (GlobalRenderQueue.IsWindowClosing() && GlobalThumbnailCache.IsRunning()) {
+                GlobalThumbnailCache.Shutdown();
+            }
+            if (GlobalSpriteBatcher.IsSceneRendering()) {
+                GlobalSpriteBatcher.DrawScene();
+            }
+        });
+
+        // Curves have to be known before the first scene binds its transition callbacks
+        if (GlobalVirtualFileSystem.Exists("Assets/JsonData/TimelineAsset.json"))
+        {
+            GlobalTimelineEvaluator.LoadCurves("Assets/JsonData/TimelineAsset.json");
+        }
+
         std::cout << "SceneManager initialized with DefaultScene." << std::endl;
     }
 
@@ -53,14 +100,34 @@ namespace Framework {
         engineState.player_health = engineState.player_maxHealth;
         Framework::PlayerSystem::playerText.clear();
         engineState.TimeScale = 1.f; // Reset timescale to default in case of slow
+        GlobalFrameScheduler.Reset(); // Don't carry simulation time into the next scene
         engineState.winCheat = false;
     }
 
 
     void SceneManager::Update(float deltaTime) {
 
-        (void)deltaTime;
- 
+        // Animations run on scaled game time and hold while paused
+        if (engineState.IsPlay() && !engineState.IsPaused())
+        {
+            GlobalAssetManager.GetAnimationClips().Advance(deltaTime * engineState.TimeScale);
+        }
+
+        // Gameplay timers step with the fixed simulation step; outside play only the render passes
+        // run. When the engine loop already drives the scheduler, this update runs inside its Tick
+        // and must not tick it again
+        if (!GlobalFrameScheduler.IsTicking())
+        {
+            GlobalFrameScheduler.Tick(engineState.IsPlay() && !engineState.IsPaused() ? deltaTime : 0.0f);
+        }
+
+        if (engineState.IsPlay())
+        {
+            // UI transitions and cooldowns run on real time, so menus still work while paused
+            GlobalTimelineEvaluator.Update(deltaTime);
+            GlobalUITimingWheel.Advance(deltaTime);
+        }
+
         // GlobalAudio.ClearInactiveChannels();
         GlobalAudio.UE_CleanupDeadChannels();
 
@@ -97,6 +164,14 @@ namespace Framework {
 
         if (GlobalSceneManager.sceneTransitionFlag) {
 
+            // Leaving the editor: its asset browser is gone, stop the workers and free the atlas
+            if (GlobalSceneManager.currentScene == "Assets/Scene/EditorInstance.json" &&
+                GlobalSceneManager.nextScene != "Assets/Scene/EditorInstance.json" &&
+                GlobalThumbnailCache.IsRunning())
+            {
+                GlobalThumbnailCache.Shutdown();
+            }
+
             // Clear the current scene
             GlobalSceneManager.ClearCurrentScene();
 
@@ -106,6 +181,16 @@ namespace Framework {
             // Reset the flag
             GlobalSceneManager.sceneTransitionFlag = false;
 
+            // The editor's asset browser shows every asset, start generating their thumbnails
+            if (GlobalSceneManager.currentScene == "Assets/Scene/EditorInstance.json")
+            {
+                if (!GlobalThumbnailCache.IsRunning())
+                {
+                    GlobalThumbnailCache.Initialize();
+                }
+                GlobalThumbnailCache.RequestAll();
+            }
+
             std::cout << "Scene transitioned to: "
                 << GlobalSceneManager.currentScene
                 << std::endl;
@@ -127,6 +212,12 @@ namespace Framework {
                 hasPlayedGameLevelAudio = false;
             }
         }
+
+        // Once per frame: text layouts unused for EvictionInterval frames are dropped
+        GlobalTextLayoutCache.EndFrame();
+
+        // Finished thumbnails go into the atlas here, on the thread that loads textures
+        GlobalThumbnailCache.Update();
     }
 
     std::string SceneManager::GetName() {
@@ -146,13 +237,28 @@ namespace Framework {
 
     void SceneManager::ClearCurrentScene() {
         ecsInterface.ClearEntities();
+        GlobalTargetMatcher.Clear();
+        GlobalEntityPool.Clear();
+        GlobalTransformCache.Clear();
+        GlobalTextLayoutCache.Clear();
+        GlobalTimelineEvaluator.Clear();
+        GlobalTimingWheel.Clear();
+        GlobalUITimingWheel.Clear();
+        GlobalSpatialHash.Clear();
+        GlobalAssetManager.GetAnimationClips().ClearPlayback();
         std::cout << "Cleared all entities for scene transition." << std::endl;
     }
 
     void SceneManager::LoadScene(const std::string& sceneName) {
 
+        static Histogram& loadLatency = GlobalMetrics.GetHistogram("ue_scene_load_us", "Scene load time in microseconds");
+        const auto loadStart = std::chrono::steady_clock::now();
+
         GlobalAssetManager.UE_LoadEntities(sceneName); // Temporarily load this scene
         GlobalSceneManager.currentScene = sceneName;
+        GlobalEntityPool.Prewarm(sceneName);    // Instantiate this scene's pooled prefabs up front, not mid-game
+
+        loadLatency.RecordMicroseconds(std::chrono::steady_clock::now() - loadStart);
         std::cout << "Loaded scene: " << GlobalSceneManager.currentScene << std::endl;
     }
 
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : SerializedEnums.h
+/// @Brief : Name tables of every enum written to or read from the JSON
+///          assets, for use with EnumToString / EnumFromString. The names
+///          are the exact strings found in the scene, prefab and audio
+///          files.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _SERIALIZED_ENUMS_H_
+#define _SERIALIZED_ENUMS_H_
+#include "EnumReflection.h"
+#include "ComponentList.h"
+#include "Audio.h"
+#include "TimelineEvaluator.h"
+
+namespace Framework
+{
+    template <>
+    struct EnumTraits<RenderType>
+    {
+        static constexpr std::array<EnumEntry<RenderType>, 4> entries =
+        { {
+            { RenderType::Sprite, "Sprite" },
+            { RenderType::Particle, "Particle" },
+            { RenderType::Text, "Text" },
+            { RenderType::PauseUI, "PauseUI" },
+        } };
+    };
+
+    template <>
+    struct EnumTraits<Layer>
+    {
+        static constexpr std::array<EnumEntry<Layer>, 5> entries =
+        { {
+            { Layer::Background, "Background" },
+            { Layer::Character, "Character" },
+            { Layer::Foreground, "Foreground" },
+            { Layer::UI, "UI" },
+            { Layer::Debug, "Debug" },
+        } };
+    };
+
+    template <>
+    struct EnumTraits<EmissionShape>
+    {
+        static constexpr std::array<EnumEntry<EmissionShape>, 10> entries =
+        { {
+            { EmissionShape::CIRCLE, "CIRCLE" },
+            { EmissionShape::BOX, "BOX" },
+            { EmissionShape::ELLIPSE, "ELLIPSE" },
+            { EmissionShape::LINE, "LINE" },
+            { EmissionShape::SPIRAL, "SPIRAL" },
+            { EmissionShape::RADIAL, "RADIAL" },
+            { EmissionShape::RANDOM, "RANDOM" },
+            { EmissionShape::WAVE, "WAVE" },
+            { EmissionShape::CONE, "CONE" },
+            { EmissionShape::EXPLOSION, "EXPLOSION" },
+        } };
+    };
+
+    template <>
+    struct EnumTraits<EnemyType>
+    {
+        static constexpr std::array<EnumEntry<EnemyType>, 6> entries =
+        { {
+            { EnemyType::Minion, "Minion" },
+            { EnemyType::Boss, "Boss" },
+            { EnemyType::Poison, "Poison" },
+            { EnemyType::MC, "MC" },
+            { EnemyType::Spawner, "Spawner" },
+            { EnemyType::Smoke, "Smoke" },
+        } };
+    };
+
+    template <>
+    struct EnumTraits<ObjectType>
+    {
+        static constexpr std::array<EnumEntry<ObjectType>, 5> entries =
+        { {
+            { ObjectType::Enemy, "Enemy" },
+            { ObjectType::CollidableObject, "CollidableObject" },
+            { ObjectType::Player, "Player" },
+            { ObjectType::Bullet, "Bullet" },
+            { ObjectType::TextBox, "TextBox" },
+        } };
+    };
+
+    template <>
+    struct EnumTraits<Audio::SoundType>
+    {
+        static constexpr std::array<EnumEntry<Audio::SoundType>, 3> entries =
+        { {
+            { Audio::SoundType::EMPTY, "Empty" },
+            { Audio::SoundType::BACKGROUND_MUSIC, "background" },
+            { Audio::SoundType::SOUND_EFFECT, "effect" },
+        } };
+    };
+
+    template <>
+    struct EnumTraits<Audio::PlaybackMode>
+    {
+        static constexpr std::array<EnumEntry<Audio::PlaybackMode>, 2> entries =
+        { {
+            { Audio::PlaybackMode::OneShot, "oneshot" },
+            { Audio::PlaybackMode::Loop, "loop" },
+        } };
+    };
+
+    template <>
+    struct EnumTraits<TimelineChannel>
+    {
+        static constexpr std::array<EnumEntry<TimelineChannel>, 4> entries =
+        { {
+            { TimelineChannel::Alpha, "Alpha" },
+            { TimelineChannel::PositionX, "PositionX" },
+            { TimelineChannel::PositionY, "PositionY" },
+            { TimelineChannel::Scale, "Scale" },
+        } };
+    };
+
+    template <>
+    struct EnumTraits<Easing>
+    {
+        static constexpr std::array<EnumEntry<Easing>, 7> entries =
+        { {
+            { Easing::Linear, "Linear" },
+            { Easing::InQuad, "InQuad" },
+            { Easing::OutQuad, "OutQuad" },
+            { Easing::InOutQuad, "InOutQuad" },
+            { Easing::OutCubic, "OutCubic" },
+            { Easing::OutBack, "OutBack" },
+            { Easing::OutElastic, "OutElastic" },
+        } };
+    };
+}
+#endif // !_SERIALIZED_ENUMS_H_
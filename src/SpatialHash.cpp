@@ -0,0 +1,330 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : SpatialHash.cpp
+/// @Brief : Implements incremental maintenance of the collision grid and the
+///          masked pair and box queries.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "SpatialHash.h"
+#include "ComponentList.h"
+#include "Metrics.h"
+#include <algorithm>
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework
+{
+    SpatialHash GlobalSpatialHash;
+
+    namespace
+    {
+        // Box holding both the circle and the collision box the narrow phase may test
+        glm::vec2 HalfExtentOf(const CollisionComponent& collision)
+        {
+            return glm::vec2(std::max(collision.radius, std::abs(collision.scale.x) * 0.5f),
+                std::max(collision.radius, std::abs(collision.scale.y) * 0.5f));
+        }
+    }
+
+    /*******************/
+    //   Tracking      //
+    /*******************/
+
+    void SpatialHash::Track(Entity entity)
+    {
+        if (!ecsInterface.HasComponent<TransformComponent>(entity) || !ecsInterface.HasComponent<CollisionComponent>(entity))
+        {
+            return;
+        }
+
+        const CollisionComponent& collision = ecsInterface.GetComponent<CollisionComponent>(entity);
+        Insert(entity, static_cast<int>(collision.type), ecsInterface.GetComponent<TransformComponent>(entity).position, HalfExtentOf(collision));
+    }
+
+    void SpatialHash::TrackAll()
+    {
+        for (Entity entity : ecsInterface.GetEntities())
+        {
+            Track(entity);
+        }
+    }
+
+    void SpatialHash::Untrack(Entity entity)
+    {
+        auto it = indices.find(entity);
+        if (it != indices.end())
+        {
+            Remove(it->second);
+        }
+    }
+
+    void SpatialHash::Clear()
+    {
+        proxies.clear();
+        indices.clear();
+        cells.clear();
+        stepPairs.clear();
+    }
+
+    void SpatialHash::Insert(Entity entity, int objectType, glm::vec2 center, glm::vec2 halfExtent)
+    {
+        auto [it, inserted] = indices.try_emplace(entity, static_cast<uint32_t>(proxies.size()));
+        if (inserted)
+        {
+            proxies.emplace_back();
+            proxies.back().entity = entity;
+        }
+        proxies[it->second].mask = CollisionMask(objectType);
+        Place(it->second, center, halfExtent);
+    }
+
+    void SpatialHash::Refresh()
+    {
+        size_t moved = 0;
+        for (size_t i = 0; i < proxies.size();)
+        {
+            // A dropped collider's index now holds the last one, which is visited next
+            i += Reread(static_cast<uint32_t>(i), moved) ? 1 : 0;
+        }
+        lastMovedCount = moved;
+    }
+
+    void SpatialHash::Refresh(const std::vector<Entity>& changedEntities, const std::vector<Entity>& removedEntities)
+    {
+        for (Entity entity : removedEntities)
+        {
+            Untrack(entity);
+        }
+
+        size_t moved = 0;
+        for (Entity entity : changedEntities)
+        {
+            auto it = indices.find(entity);
+            if (it != indices.end())
+            {
+                Reread(it->second, moved);
+            }
+        }
+        lastMovedCount = moved;
+    }
+
+    bool SpatialHash::Reread(uint32_t index, size_t& moved)
+    {
+        const Entity entity = proxies[index].entity;
+        if (!ecsInterface.HasComponent<TransformComponent>(entity) || !ecsInterface.HasComponent<CollisionComponent>(entity))
+        {
+            Remove(index);
+            return false;
+        }
+
+        const CollisionComponent& collision = ecsInterface.GetComponent<CollisionComponent>(entity);
+        const glm::vec2 center = ecsInterface.GetComponent<TransformComponent>(entity).position;
+        const glm::vec2 halfExtent = HalfExtentOf(collision);
+        proxies[index].mask = CollisionMask(static_cast<int>(collision.type));
+
+        // Most colliders sit still (walls, idle enemies), comparing is cheaper than re-placing
+        if (center != proxies[index].center || halfExtent != proxies[index].halfExtent)
+        {
+            const CellRange before = proxies[index].cells;
+            Place(index, center, halfExtent);
+            moved += before == proxies[index].cells ? 0 : 1;
+        }
+        return true;
+    }
+
+    void SpatialHash::UpdateStepPairs()
+    {
+        stepPairs.clear();
+        QueryPairs(~0u, ~0u, stepPairs);
+    }
+
+    /*******************/
+    //   Grid          //
+    /*******************/
+
+    SpatialHash::CellRange SpatialHash::CellsOf(glm::vec2 min, glm::vec2 max) const
+    {
+        return CellRange{ CellCoordinate(min.x), CellCoordinate(min.y), CellCoordinate(max.x), CellCoordinate(max.y) };
+    }
+
+    void SpatialHash::Place(uint32_t index, glm::vec2 center, glm::vec2 halfExtent)
+    {
+        Proxy& proxy = proxies[index];
+        proxy.center = center;
+        proxy.halfExtent = halfExtent;
+        proxy.min = center - halfExtent;
+        proxy.max = center + halfExtent;
+
+        // Only colliders that crossed a cell border touch the cell lists
+        const CellRange range = CellsOf(proxy.min, proxy.max);
+        if (range == proxy.cells)
+        {
+            return;
+        }
+        RemoveFromCells(index);
+        proxy.cells = range;
+        AddToCells(index);
+    }
+
+    void SpatialHash::AddToCells(uint32_t index)
+    {
+        const CellRange& range = proxies[index].cells;
+        for (int y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int x = range.minX; x <= range.maxX; ++x)
+            {
+                cells[CellKey(x, y)].push_back(index);
+            }
+        }
+    }
+
+    void SpatialHash::RemoveFromCells(uint32_t index)
+    {
+        const CellRange& range = proxies[index].cells;
+        for (int y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int x = range.minX; x <= range.maxX; ++x)
+            {
+                auto cell = cells.find(CellKey(x, y));
+                if (cell == cells.end())
+                {
+                    continue;
+                }
+                std::vector<uint32_t>& members = cell->second;
+                auto member = std::find(members.begin(), members.end(), index);
+                if (member != members.end())
+                {
+                    *member = members.back();
+                    members.pop_back();
+                }
+                if (members.empty())
+                {
+                    cells.erase(cell);
+                }
+            }
+        }
+    }
+
+    void SpatialHash::ReplaceInCells(uint32_t from, uint32_t to)
+    {
+        const CellRange& range = proxies[from].cells;
+        for (int y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int x = range.minX; x <= range.maxX; ++x)
+            {
+                std::vector<uint32_t>& members = cells[CellKey(x, y)];
+                std::replace(members.begin(), members.end(), from, to);
+            }
+        }
+    }
+
+    void SpatialHash::Remove(uint32_t index)
+    {
+        RemoveFromCells(index);
+        indices.erase(proxies[index].entity);
+
+        // Keep the proxies dense: the last one takes the freed index
+        const uint32_t last = static_cast<uint32_t>(proxies.size() - 1);
+        if (index != last)
+        {
+            ReplaceInCells(last, index);
+            proxies[index] = proxies[last];
+            indices[proxies[index].entity] = index;
+        }
+        proxies.pop_back();
+    }
+
+    /*******************/
+    //   Queries       //
+    /*******************/
+
+    void SpatialHash::QueryPairs(uint32_t maskA, uint32_t maskB, std::vector<EntityPair>& pairs) const
+    {
+        static Gauge& pairMetric = GlobalMetrics.GetGauge("ue_collision_pairs", "Overlapping collider pairs found by the last broad phase query");
+        const size_t firstPair = pairs.size();
+
+        for (uint32_t i = 0; i < proxies.size(); ++i)
+        {
+            const Proxy& a = proxies[i];
+            if (!(a.mask & maskA))
+            {
+                continue;
+            }
+            const bool aInB = (a.mask & maskB) != 0;
+
+            for (int y = a.cells.minY; y <= a.cells.maxY; ++y)
+            {
+                for (int x = a.cells.minX; x <= a.cells.maxX; ++x)
+                {
+                    auto cell = cells.find(CellKey(x, y));
+                    if (cell == cells.end())
+                    {
+                        continue;
+                    }
+
+                    for (uint32_t j : cell->second)
+                    {
+                        const Proxy& b = proxies[j];
+                        if (j == i || !(b.mask & maskB))
+                        {
+                            continue;
+                        }
+                        // Both sides match both masks: report the pair from the lower index only
+                        if (aInB && (b.mask & maskA) && j < i)
+                        {
+                            continue;
+                        }
+                        if (a.max.x < b.min.x || b.max.x < a.min.x || a.max.y < b.min.y || b.max.y < a.min.y)
+                        {
+                            continue;
+                        }
+                        // Pairs sharing several cells are reported from the cell holding their overlap's corner
+                        if (CellCoordinate(std::max(a.min.x, b.min.x)) != x || CellCoordinate(std::max(a.min.y, b.min.y)) != y)
+                        {
+                            continue;
+                        }
+                        pairs.emplace_back(a.entity, b.entity);
+                    }
+                }
+            }
+        }
+
+        pairMetric.Set(static_cast<double>(pairs.size() - firstPair));
+    }
+
+    void SpatialHash::QueryBox(glm::vec2 min, glm::vec2 max, uint32_t mask, std::vector<Entity>& entities) const
+    {
+        const CellRange range = CellsOf(min, max);
+        for (int y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int x = range.minX; x <= range.maxX; ++x)
+            {
+                auto cell = cells.find(CellKey(x, y));
+                if (cell == cells.end())
+                {
+                    continue;
+                }
+
+                for (uint32_t index : cell->second)
+                {
+                    const Proxy& proxy = proxies[index];
+                    if (!(proxy.mask & mask) || proxy.max.x < min.x || max.x < proxy.min.x || proxy.max.y < min.y || max.y < proxy.min.y)
+                    {
+                        continue;
+                    }
+                    // Same rule as QueryPairs: only the cell holding the overlap's corner reports it
+                    if (CellCoordinate(std::max(proxy.min.x, min.x)) != x || CellCoordinate(std::max(proxy.min.y, min.y)) != y)
+                    {
+                        continue;
+                    }
+                    entities.push_back(proxy.entity);
+                }
+            }
+        }
+    }
+}
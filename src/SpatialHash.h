@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : SpatialHash.h
+/// @Brief : Declares SpatialHash, the broad phase for CollisionComponent.
+///          Every collider is kept in the cells of a uniform grid that its
+///          bounds touch. Refresh() re-reads the TransformComponents and
+///          only moves colliders whose bounds changed, and only between
+///          cells when they crossed a cell border. Pair queries take two
+///          ObjectType masks (e.g. bullets against enemies) and only compare
+///          colliders sharing a cell, so the cost follows the number of
+///          nearby colliders instead of every pair in the scene.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _SPATIAL_HASH_H_
+#define _SPATIAL_HASH_H_
+#include "pch.h"
+#include "Coordinator.h"
+#include <glm.hpp>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @brief Bit of an ObjectType in a collision mask.
+     */
+    constexpr uint32_t CollisionMask(int objectType) { return 1u << objectType; }
+
+    /**
+     * @class SpatialHash
+     * @brief Uniform grid broad phase. A collider's bounds are the box holding both its
+     *        radius and its collision scale, so the narrow phase can use either.
+     */
+    class SpatialHash
+    {
+    public:
+        using EntityPair = std::pair<Entity, Entity>;
+
+        explicit SpatialHash(float cellSize = 128.0f) : cellSize(cellSize), inverseCellSize(1.0f / cellSize) {}
+
+        /**
+         * @brief Adds an entity with TransformComponent and CollisionComponent, or re-reads it
+         *        if already tracked.
+         */
+        void Track(Entity entity);
+
+        /**
+         * @brief Tracks every entity that has a CollisionComponent, e.g. after a scene load.
+         */
+        void TrackAll();
+
+        void Untrack(Entity entity);
+
+        void Clear();
+
+        /**
+         * @brief Re-reads the tracked colliders and moves those whose bounds changed. Entities
+         *        that lost their components are dropped.
+         */
+        void Refresh();
+
+        /**
+         * @brief Re-reads only the listed colliders, e.g. the TransformCache's changed and
+         *        removed entities, instead of every tracked one. Entities that are not tracked
+         *        are ignored.
+         */
+        void Refresh(const std::vector<Entity>& changedEntities, const std::vector<Entity>& removedEntities);
+
+        /**
+         * @brief Runs QueryPairs() over every collider type and keeps the result for this step.
+         *        The collision narrow phase reads GetStepPairs() instead of testing every pair.
+         */
+        void UpdateStepPairs();
+        const std::vector<EntityPair>& GetStepPairs() const { return stepPairs; }
+
+        /**
+         * @brief Adds or moves a collider without reading components (headless use and tests).
+         * @param objectType The collider's ObjectType.
+         */
+        void Insert(Entity entity, int objectType, glm::vec2 center, glm::vec2 halfExtent);
+
+        /**
+         * @brief Every overlapping pair with one collider in maskA and the other in maskB,
+         *        reported once, first entity from maskA.
+         */
+        void QueryPairs(uint32_t maskA, uint32_t maskB, std::vector<EntityPair>& pairs) const;
+
+        /**
+         * @brief Colliders in mask whose bounds overlap the box.
+         */
+        void QueryBox(glm::vec2 min, glm::vec2 max, uint32_t mask, std::vector<Entity>& entities) const;
+
+        bool IsTracked(Entity entity) const { return indices.count(entity) != 0; }
+        size_t size() const { return proxies.size(); }
+        size_t GetMovedCount() const { return lastMovedCount; }    // Colliders that changed cells in the last Refresh()
+        float GetCellSize() const { return cellSize; }
+
+    private:
+        struct CellRange
+        {
+            int minX = 0, minY = 0, maxX = -1, maxY = -1;
+            bool operator==(const CellRange& other) const
+            {
+                return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+            }
+        };
+
+        struct Proxy
+        {
+            Entity entity = 0;
+            uint32_t mask = 0;
+            glm::vec2 center{ 0.0f, 0.0f };
+            glm::vec2 halfExtent{ 0.0f, 0.0f };
+            glm::vec2 min{ 0.0f, 0.0f };
+            glm::vec2 max{ 0.0f, 0.0f };
+            CellRange cells;
+        };
+
+        static uint64_t CellKey(int x, int y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+        }
+
+        int CellCoordinate(float value) const { return static_cast<int>(std::floor(value * inverseCellSize)); }
+        CellRange CellsOf(glm::vec2 min, glm::vec2 max) const;
+        void AddToCells(uint32_t index);
+        void RemoveFromCells(uint32_t index);
+        void ReplaceInCells(uint32_t from, uint32_t to);
+        void Remove(uint32_t index);
+        void Place(uint32_t index, glm::vec2 center, glm::vec2 halfExtent);
+        bool Reread(uint32_t index, size_t& moved);     // False if the collider was dropped
+
+        float cellSize;
+        float inverseCellSize;
+        std::vector<Proxy> proxies;
+        std::unordered_map<Entity, uint32_t> indices;
+        std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+        std::vector<EntityPair> stepPairs;
+        size_t lastMovedCount = 0;
+    };
+
+    extern SpatialHash GlobalSpatialHash;   // Global instance of the SpatialHash
+}
+#endif // !_SPATIAL_HASH_H_
@@ -0,0 +1,581 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : SpriteBatcher.cpp
+/// @Brief : Implements sprite gathering, the key radix sort, draw command
+///          building and the instanced OpenGL draw.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "SpriteBatcher.h"
+#include "AssetManager.h"
+#include "Coordinator.h"
+#include "ComponentList.h"
+#include "EngineState.h"
+#include "EntityPool.h"
+#include "Graphics.h"
+#include "Metrics.h"
+#include "ParticleSystem.h"
+#include "RenderQueue.h"
+#include "TextLayoutCache.h"
+#include "TextureImport.h"
+#include <gtc/matrix_transform.hpp>
+#include <gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework
+{
+    SpriteBatcher GlobalSpriteBatcher;
+
+    namespace
+    {
+        SpriteBatcher glyphBatcher;     // Draws the text of the scene pass when it runs on this thread
+        FrameCommands textFrame;        // Glyphs of that text, only the glyph lists are used
+
+        constexpr uint32_t MaxSortID = (1u << 24) - 1;
+        constexpr int64_t SortIDBias = 1 << 23;     // sortID 0 sits mid-range, so negative IDs keep their order
+
+        GLuint CompileShader(GLenum type, const std::string& source, const std::string& path)
+        {
+            const GLuint shader = glCreateShader(type);
+            const char* text = source.c_str();
+            glShaderSource(shader, 1, &text, nullptr);
+            glCompileShader(shader);
+
+            GLint compiled = GL_FALSE;
+            glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+            if (compiled != GL_TRUE)
+            {
+                char log[1024];
+                glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+                std::cerr << "Error: Could not compile " << path << ": " << log << std::endl;
+                glDeleteShader(shader);
+                return 0;
+            }
+            return shader;
+        }
+    }
+
+    uint64_t SpriteBatcher::MakeKey(uint32_t layer, int32_t sortID, GLuint texture)
+    {
+        const int64_t biased = std::clamp<int64_t>(static_cast<int64_t>(sortID) + SortIDBias, 0, MaxSortID);
+        return (static_cast<uint64_t>(layer & 0xFF) << 56)
+            | (static_cast<uint64_t>(biased) << 32)
+            | static_cast<uint64_t>(texture);
+    }
+
+    ViewportMapping SpriteBatcher::GetViewportMapping()
+    {
+        ViewportMapping mapping;
+        mapping.projectionSize = glm::vec2(static_cast<float>(Graphics::projWidth), static_cast<float>(Graphics::projHeight));
+        mapping.viewportSize = glm::vec2(static_cast<float>(Graphics::viewportWidth), static_cast<float>(Graphics::viewportHeight));
+        mapping.viewportOffset = glm::vec2(static_cast<float>(Graphics::viewportOffsetX), static_cast<float>(Graphics::viewportOffsetY));
+        return mapping;
+    }
+
+    glm::mat4 SpriteBatcher::GetViewportProjection()
+    {
+        // The viewport is letterboxed in the middle of the window, with the offset on both sides
+        const ViewportMapping mapping = GetViewportMapping();
+        const glm::vec2 windowSize = mapping.viewportSize + mapping.viewportOffset * 2.0f;
+        return glm::ortho(0.0f, windowSize.x, 0.0f, windowSize.y);
+    }
+
+    /*******************/
+    //   Gathering     //
+    /*******************/
+
+    void SpriteBatcher::Begin()
+    {
+        instances.clear();
+        keys.clear();
+        commands.clear();
+        built = false;
+    }
+
+    void SpriteBatcher::Submit(const SpriteInstance& sprite, uint32_t layer, int32_t sortID, GLuint texture)
+    {
+        instances.push_back(sprite);
+        keys.push_back(MakeKey(layer, sortID, texture));
+        built = false;
+    }
+
+    void SpriteBatcher::SubmitEntities()
+    {
+        // Once per frame: only transforms that changed since the last frame are rebuilt
+        GlobalTransformCache.Refresh(GetViewportMapping());
+        const std::vector<Entity>& entities = GlobalTransformCache.GetEntities();
+        const std::vector<CachedTransform>& transforms = GlobalTransformCache.GetTransforms();
+
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            const Entity entity = entities[i];
+            if (!ecsInterface.HasComponent<RenderComponent>(entity) || !GlobalEntityPool.IsActive(entity))
+            {
+                continue;
+            }
+
+            const RenderComponent& render = ecsInterface.GetComponent<RenderComponent>(entity);
+            if (!render.isActive || render.renderType != RenderType::Sprite)
+            {
+                continue;
+            }
+
+            const CachedTransform& transform = transforms[i];
+            SpriteInstance sprite;
+            sprite.position = glm::vec2(transform.viewportRect.x, transform.viewportRect.y);
+            sprite.scale = glm::vec2(transform.viewportRect.z, transform.viewportRect.w);
+            sprite.rotation = transform.rotation;
+            sprite.color = glm::vec4(render.color, render.alpha);
+
+            // Animated sprites show the current frame of their clip
+            if (ecsInterface.HasComponent<AnimationComponent>(entity))
+            {
+                if (const FrameUV* frame = GlobalAssetManager.GetAnimationClips().FindFrame(entity))
+                {
+                    sprite.uvRect = glm::vec4(frame->offset, frame->scale);
+                }
+            }
+
+            uint32_t layer = static_cast<uint32_t>(Layer::Background);
+            int32_t sortID = 0;
+            if (ecsInterface.HasComponent<LayerComponent>(entity))
+            {
+                const LayerComponent& layerComponent = ecsInterface.GetComponent<LayerComponent>(entity);
+                layer = static_cast<uint32_t>(layerComponent.layerID);
+                sortID = static_cast<int32_t>(layerComponent.sortID);
+            }
+
+            Submit(sprite, layer, sortID, GlobalAssetManager.UE_LoadTextureToOpenGL(render.textureID));
+        }
+    }
+
+    bool SpriteBatcher::HasMainThreadPasses()
+    {
+        // The editor draws ImGui between frames
+        if (!engineState.IsPlay())
+        {
+            return true;
+        }
+
+        // Pause menus and other UI are drawn by the per-object renderer
+        for (Entity entity : GlobalTransformCache.GetEntities())
+        {
+            if (ecsInterface.HasComponent<RenderComponent>(entity))
+            {
+                const RenderComponent& render = ecsInterface.GetComponent<RenderComponent>(entity);
+                if (render.isActive && render.renderType == RenderType::PauseUI && GlobalEntityPool.IsActive(entity))
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void SpriteBatcher::SubmitText(FrameCommands& frame) const
+    {
+        const ViewportMapping mapping = GetViewportMapping();
+        const glm::vec2 ratio = mapping.viewportSize / mapping.projectionSize;
+
+        for (Entity entity : GlobalTransformCache.GetEntities())
+        {
+            if (!ecsInterface.HasComponent<TextComponent>(entity) || !GlobalEntityPool.IsActive(entity))
+            {
+                continue;
+            }
+            const TextComponent& text = ecsInterface.GetComponent<TextComponent>(entity);
+            if (text.text.empty())
+            {
+                continue;
+            }
+
+            float alpha = 1.0f;
+            if (ecsInterface.HasComponent<RenderComponent>(entity))
+            {
+                const RenderComponent& render = ecsInterface.GetComponent<RenderComponent>(entity);
+                if (!render.isActive)
+                {
+                    continue;
+                }
+                alpha = render.alpha;
+            }
+
+            // Only a changed suffix is laid out again, e.g. while the player types
+            const TextLayoutCache::Layout& layout = GlobalTextLayoutCache.Get(entity, text.text, text.fontName, text.fontSize);
+            const glm::vec2 position = ecsInterface.GetComponent<TransformComponent>(entity).position + text.offset;
+            frame.AddText(layout, position * ratio + mapping.viewportOffset, glm::vec4(text.color, alpha));
+        }
+    }
+
+    void SpriteBatcher::DrawScene()
+    {
+        // The render thread owns the context, so it only runs while this pass draws everything.
+        // It is stopped while the window still exists, before the engine loop destroys it
+        const bool threaded = renderThread && !HasMainThreadPasses() && !GlobalRenderQueue.IsWindowClosing();
+        if (threaded && !GlobalRenderQueue.IsRunning())
+        {
+            GlobalRenderQueue.StartOnCurrentWindow();
+        }
+        else if (!threaded && GlobalRenderQueue.IsRunning())
+        {
+            GlobalRenderQueue.Stop();
+        }
+
+        Begin();
+        SubmitEntities();
+        GlobalParticleSystem.SubmitParticles(*this);
+
+        if (!GlobalRenderQueue.IsRunning())
+        {
+            const glm::mat4 projection = GetViewportProjection();
+            Draw(projection);
+
+            // Text goes over the sprites, with the shader that reads glyph coverage
+            textFrame.Clear();
+            SubmitText(textFrame);
+            if (glyphBatcher.InitializeGL(GlyphVertexShader, GlyphFragmentShader))
+            {
+                glyphBatcher.DrawCommands(textFrame.glyphs, textFrame.glyphDraws, projection);
+            }
+            return;
+        }
+
+        // The frame is copied out, so this batcher is free to gather the next one
+        Build();
+        FrameCommands& frame = GlobalRenderQueue.BeginFrame();
+        frame.viewProjection = GetViewportProjection();
+        frame.CaptureSprites(*this);
+        SubmitText(frame);
+        GlobalRenderQueue.Publish();
+    }
+
+    /*******************/
+    //   Batching      //
+    /*******************/
+
+    void SpriteBatcher::SortKeys()
+    {
+        // LSD radix sort, 8 bits per pass; stable, so equal keys keep submission order
+        const size_t count = keys.size();
+        sortedKeys.assign(keys.begin(), keys.end());
+        order.resize(count);
+        keyScratch.resize(count);
+        orderScratch.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            order[i] = static_cast<uint32_t>(i);
+        }
+
+        // All eight histograms in one read of the keys
+        uint32_t histograms[8][256] = {};
+        for (uint64_t key : sortedKeys)
+        {
+            for (int digit = 0; digit < 8; ++digit)
+            {
+                ++histograms[digit][(key >> (digit * 8)) & 0xFF];
+            }
+        }
+
+        for (int digit = 0; digit < 8; ++digit)
+        {
+            uint32_t* histogram = histograms[digit];
+            const int shift = digit * 8;
+
+            // A byte shared by every key (unused texture bits, one layer) needs no pass
+            if (histogram[(sortedKeys[0] >> shift) & 0xFF] == count)
+            {
+                continue;
+            }
+
+            uint32_t offset = 0;
+            for (int bucket = 0; bucket < 256; ++bucket)
+            {
+                const uint32_t bucketSize = histogram[bucket];
+                histogram[bucket] = offset;
+                offset += bucketSize;
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint32_t position = histogram[(sortedKeys[i] >> shift) & 0xFF]++;
+                keyScratch[position] = sortedKeys[i];
+                orderScratch[position] = order[i];
+            }
+            sortedKeys.swap(keyScratch);
+            order.swap(orderScratch);
+        }
+    }
+
+    const std::vector<SpriteDrawCommand>& SpriteBatcher::Build()
+    {
+        if (built)
+        {
+            return commands;
+        }
+
+        commands.clear();
+        sorted.resize(keys.size());
+        if (!keys.empty())
+        {
+            SortKeys();
+
+            // Adjacent sprites with the same texture share a draw, whatever their layer
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                sorted[i] = instances[order[i]];
+                const GLuint texture = static_cast<GLuint>(sortedKeys[i] & 0xFFFFFFFF);
+                if (commands.empty() || commands.back().texture != texture)
+                {
+                    commands.push_back(SpriteDrawCommand{ texture, static_cast<uint32_t>(i), 0 });
+                }
+                ++commands.back().instanceCount;
+            }
+        }
+        built = true;
+
+        static Gauge& spriteCount = GlobalMetrics.GetGauge("ue_sprites_batched", "Sprites submitted to the batcher last frame");
+        static Gauge& drawCount = GlobalMetrics.GetGauge("ue_sprite_draw_calls", "Draw calls issued for sprites last frame");
+        spriteCount.Set(static_cast<double>(sorted.size()));
+        drawCount.Set(static_cast<double>(commands.size()));
+        return commands;
+    }
+
+    /*******************/
+    //   OpenGL        //
+    /*******************/
+
+    std::vector<SpriteBatcher*>& SpriteBatcher::InitializedBatchers()
+    {
+        // Only touched on the GL thread. Never destroyed: global batchers unregister in their destructors
+        static std::vector<SpriteBatcher*>* batchers = new std::vector<SpriteBatcher*>();
+        return *batchers;
+    }
+
+    SpriteBatcher::~SpriteBatcher()
+    {
+        auto& batchers = InitializedBatchers();
+        batchers.erase(std::remove(batchers.begin(), batchers.end(), this), batchers.end());
+    }
+
+    GLuint SpriteBatcher::LinkProgram() const
+    {
+        GLuint vertexShader = 0, fragmentShader = 0;
+        try
+        {
+            vertexShader = CompileShader(GL_VERTEX_SHADER, GlobalAssetManager.UE_LoadGraphicsShader(vertexPath), vertexPath);
+            fragmentShader = CompileShader(GL_FRAGMENT_SHADER, GlobalAssetManager.UE_LoadGraphicsShader(fragmentPath), fragmentPath);
+        }
+        catch (const std::runtime_error& error)
+        {
+            std::cerr << "Error: " << error.what() << std::endl;
+        }
+        if (vertexShader == 0 || fragmentShader == 0)
+        {
+            glDeleteShader(vertexShader);
+            glDeleteShader(fragmentShader);
+            return 0;
+        }
+
+        GLuint newProgram = glCreateProgram();
+        glAttachShader(newProgram, vertexShader);
+        glAttachShader(newProgram, fragmentShader);
+        glLinkProgram(newProgram);
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+
+        GLint linked = GL_FALSE;
+        glGetProgramiv(newProgram, GL_LINK_STATUS, &linked);
+        if (linked != GL_TRUE)
+        {
+            char log[1024];
+            glGetProgramInfoLog(newProgram, sizeof(log), nullptr, log);
+            std::cerr << "Error: Could not link the sprite shader: " << log << std::endl;
+            glDeleteProgram(newProgram);
+            return 0;
+        }
+        return newProgram;
+    }
+
+    void SpriteBatcher::UseProgram(GLuint newProgram)
+    {
+        if (program != 0)
+        {
+            glDeleteProgram(program);
+        }
+        program = newProgram;
+        viewProjectionLocation = glGetUniformLocation(program, "viewProjection");
+        useTextureLocation = glGetUniformLocation(program, "useTexture");
+        premultipliedAlphaLocation = glGetUniformLocation(program, "premultipliedAlpha");
+    }
+
+    void SpriteBatcher::ReloadShaders(const std::string& shaderPath)
+    {
+        for (SpriteBatcher* batcher : InitializedBatchers())
+        {
+            if (batcher->vertexPath != shaderPath && batcher->fragmentPath != shaderPath)
+            {
+                continue;
+            }
+            const GLuint newProgram = batcher->LinkProgram();
+            if (newProgram == 0)
+            {
+                std::cerr << "Sprite shader " << shaderPath << " did not build, keeping the previous program" << std::endl;
+                continue;
+            }
+            batcher->UseProgram(newProgram);
+            std::cout << "Sprite shader reloaded: " << shaderPath << std::endl;
+        }
+    }
+
+    bool SpriteBatcher::InitializeGL(const std::string& vertexShaderPath, const std::string& fragmentShaderPath)
+    {
+        if (mode != Mode::OpenGL)
+        {
+            return false;
+        }
+        if (program != 0)
+        {
+            return true;
+        }
+
+        vertexPath = vertexShaderPath;
+        fragmentPath = fragmentShaderPath;
+        const GLuint newProgram = LinkProgram();
+        if (newProgram == 0)
+        {
+            return false;
+        }
+        UseProgram(newProgram);
+        InitializedBatchers().push_back(this);
+
+        // Unit quad centred on the origin, drawn as a triangle strip
+        const float quad[] =
+        {
+            -0.5f, -0.5f, 0.0f, 1.0f,
+             0.5f, -0.5f, 1.0f, 1.0f,
+            -0.5f,  0.5f, 0.0f, 0.0f,
+             0.5f,  0.5f, 1.0f, 0.0f,
+        };
+
+        glGenVertexArrays(1, &vertexArray);
+        glBindVertexArray(vertexArray);
+
+        glGenBuffers(1, &quadBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, quadBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quad), quad, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), reinterpret_cast<void*>(0));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 4 * sizeof(float), reinterpret_cast<void*>(2 * sizeof(float)));
+
+        glGenBuffers(1, &instanceBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+        const GLsizei stride = sizeof(SpriteInstance);
+        const struct { GLuint location; GLint size; size_t offset; } attributes[] =
+        {
+            { 2, 4, offsetof(SpriteInstance, position) },   // position + scale
+            { 3, 4, offsetof(SpriteInstance, uvRect) },
+            { 4, 4, offsetof(SpriteInstance, color) },
+            { 5, 1, offsetof(SpriteInstance, rotation) },
+        };
+        for (const auto& attribute : attributes)
+        {
+            glEnableVertexAttribArray(attribute.location);
+            glVertexAttribPointer(attribute.location, attribute.size, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<void*>(attribute.offset));
+            glVertexAttribDivisor(attribute.location, 1);
+        }
+
+        glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        return true;
+    }
+
+    void SpriteBatcher::ShutdownGL()
+    {
+        if (program == 0)
+        {
+            return;
+        }
+        glDeleteBuffers(1, &instanceBuffer);
+        glDeleteBuffers(1, &quadBuffer);
+        glDeleteVertexArrays(1, &vertexArray);
+        glDeleteProgram(program);
+        program = vertexArray = quadBuffer = instanceBuffer = 0;
+        auto& batchers = InitializedBatchers();
+        batchers.erase(std::remove(batchers.begin(), batchers.end(), this), batchers.end());
+        instanceCapacity = 0;
+    }
+
+    void SpriteBatcher::Draw(const glm::mat4& viewProjection)
+    {
+        Build();
+        DrawCommands(sorted, commands, viewProjection);
+    }
+
+    void SpriteBatcher::DrawCommands(const std::vector<SpriteInstance>& drawInstances, const std::vector<SpriteDrawCommand>& drawCommands,
+        const glm::mat4& viewProjection)
+    {
+        if (mode != Mode::OpenGL || drawInstances.empty() || !InitializeGL())
+        {
+            return;
+        }
+
+        // Orphan the buffer each frame so the driver never waits on last frame's draws
+        glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+        instanceCapacity = std::max(instanceCapacity, drawInstances.size());
+        glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(SpriteInstance), nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, drawInstances.size() * sizeof(SpriteInstance), drawInstances.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        // The rest of the frame is drawn by other renderers, so their blend state is put back afterwards
+        GLint previousBlend[4] = {};
+        glGetIntegerv(GL_BLEND_SRC_RGB, &previousBlend[0]);
+        glGetIntegerv(GL_BLEND_DST_RGB, &previousBlend[1]);
+        glGetIntegerv(GL_BLEND_SRC_ALPHA, &previousBlend[2]);
+        glGetIntegerv(GL_BLEND_DST_ALPHA, &previousBlend[3]);
+        const GLboolean blendWasEnabled = glIsEnabled(GL_BLEND);
+        const GLboolean srgbWasEnabled = glIsEnabled(GL_FRAMEBUFFER_SRGB);
+
+        // Textures arrive in GlobalTextureLayout; the shader premultiplies the tint to match
+        const TextureLayout& layout = GlobalTextureLayout;
+        glEnable(GL_BLEND);
+        glBlendFunc(layout.premultipliedAlpha ? GL_ONE : GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        if (layout.srgb)
+        {
+            glEnable(GL_FRAMEBUFFER_SRGB);  // Blend in linear light, write back sRGB
+        }
+
+        glUseProgram(program);
+        glUniformMatrix4fv(viewProjectionLocation, 1, GL_FALSE, glm::value_ptr(viewProjection));
+        glUniform1i(premultipliedAlphaLocation, layout.premultipliedAlpha);
+        glBindVertexArray(vertexArray);
+        glActiveTexture(GL_TEXTURE0);
+
+        for (const SpriteDrawCommand& command : drawCommands)
+        {
+            glBindTexture(GL_TEXTURE_2D, command.texture);
+            glUniform1i(useTextureLocation, command.texture != 0);
+            glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, 4, command.instanceCount, command.firstInstance);
+        }
+
+        glBindVertexArray(0);
+        glUseProgram(0);
+        glBlendFuncSeparate(previousBlend[0], previousBlend[1], previousBlend[2], previousBlend[3]);
+        if (!blendWasEnabled)
+        {
+            glDisable(GL_BLEND);
+        }
+        if (layout.srgb && !srgbWasEnabled)
+        {
+            glDisable(GL_FRAMEBUFFER_SRGB);
+        }
+    }
+}
@@ -0,0 +1,228 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : SpriteBatcher.h
+/// @Brief : Declares SpriteBatcher, which draws every visible sprite of a
+///          frame with as few draw calls as possible. Sprites are gathered
+///          into one instance array, radix sorted by a 64-bit key built from
+///          (layer, sortID, texture), and consecutive sprites sharing a
+///          texture become one instanced draw. The command list mode builds
+///          the same draw commands without touching OpenGL, so the batching
+///          can be checked and benchmarked headless.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _SPRITE_BATCHER_H_
+#define _SPRITE_BATCHER_H_
+#include "pch.h"
+#include "TransformCache.h"
+#include <glew.h>
+#include <glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Framework
+{
+    struct FrameCommands;
+
+    /**
+     * @brief Per-instance data uploaded for one sprite. The layout matches the instance
+     *        attributes of UE_Sprite.vert.
+     */
+    struct SpriteInstance
+    {
+        glm::vec2 position{ 0.0f, 0.0f };
+        glm::vec2 scale{ 1.0f, 1.0f };
+        glm::vec4 uvRect{ 0.0f, 0.0f, 1.0f, 1.0f };    // Offset xy, size zw
+        glm::vec4 color{ 1.0f, 1.0f, 1.0f, 1.0f };     // Tint rgb, alpha
+        float rotation = 0.0f;                          // Degrees, as stored in TransformComponent
+    };
+
+    /**
+     * @brief One instanced draw: instanceCount sprites starting at firstInstance of the
+     *        sorted instance array, all using the same texture (0 for untextured).
+     */
+    struct SpriteDrawCommand
+    {
+        GLuint texture = 0;
+        uint32_t firstInstance = 0;
+        uint32_t instanceCount = 0;
+    };
+
+    /**
+     * @class SpriteBatcher
+     * @brief Collects sprites between Begin() and Build()/Draw(). Buffers are reused across
+     *        frames, so a steady scene does not allocate.
+     */
+    class SpriteBatcher
+    {
+    public:
+        enum class Mode
+        {
+            OpenGL,         // Build() then issue the draws
+            CommandList     // Build() only, for tests and benchmarks without a GL context
+        };
+
+        explicit SpriteBatcher(Mode batcherMode = Mode::OpenGL) : mode(batcherMode) {}
+        ~SpriteBatcher();   // GL objects are released by ShutdownGL(), while the context exists
+
+        SpriteBatcher(const SpriteBatcher&) = delete;
+        SpriteBatcher& operator=(const SpriteBatcher&) = delete;
+
+        /**
+         * @brief Sort key: layer in the top 8 bits, then sortID (biased so negative IDs sort first,
+         *        clamped to 24 bits), then the texture, so draws follow layer and sortID and
+         *        same-texture sprites are adjacent.
+         */
+        static uint64_t MakeKey(uint32_t layer, int32_t sortID, GLuint texture);
+
+        /**
+         * @brief How TransformComponent values map to the viewport, from the Graphics projection
+         *        and viewport sizes the per-object renderer uses.
+         */
+        static ViewportMapping GetViewportMapping();
+
+        /**
+         * @brief Orthographic projection over the window, for sprites in viewport coordinates.
+         */
+        static glm::mat4 GetViewportProjection();
+
+        /**
+         * @brief Starts a new frame, dropping the sprites of the previous one.
+         */
+        void Begin();
+
+        /**
+         * @brief Adds one sprite. Its position and scale are in viewport coordinates.
+         */
+        void Submit(const SpriteInstance& sprite, uint32_t layer, int32_t sortID, GLuint texture);
+
+        /**
+         * @brief Refreshes GlobalTransformCache and submits every tracked, active sprite entity
+         *        at its cached viewport rectangle. Entities without a LayerComponent are drawn
+         *        on the background layer.
+         */
+        void SubmitEntities();
+
+        /**
+         * @brief Adds the text of every tracked, active entity with a TextComponent to the frame's
+         *        glyph list, laid out through GlobalTextLayoutCache. The text starts at the
+         *        entity's position plus the TextComponent offset, mapped to the viewport.
+         */
+        void SubmitText(FrameCommands& frame) const;
+
+        /**
+         * @brief The batched scene pass: gathers this frame's sprite entities, particles and text
+         *        and draws them, or publishes them to GlobalRenderQueue while it runs. Called once
+         *        per frame from the render step while scene rendering is on.
+         */
+        void DrawScene();
+
+        /**
+         * @brief Draws sprite entities and text with DrawScene() instead of the per-object path.
+         *        Off by default; while it is on, the per-object renderers must skip sprites and
+         *        TextComponent text.
+         */
+        void SetSceneRendering(bool enable) { sceneRendering = enable; }
+        bool IsSceneRendering() const { return sceneRendering; }
+
+        /**
+         * @brief Draws the scene pass on a render thread: DrawScene() hands the window's context
+         *        to GlobalRenderQueue and publishes frames to it. The thread is only used while no
+         *        pass drawn on the main thread exists (editor ImGui, active PauseUI entities), and
+         *        is stopped once the window is asked to close.
+         */
+        void SetRenderThread(bool enable) { renderThread = enable; }
+
+        /**
+         * @brief Whether anything this pass does not draw (editor ImGui, active PauseUI entities)
+         *        needs the GL context on the main thread this frame.
+         */
+        static bool HasMainThreadPasses();
+
+        /**
+         * @brief Sorts the submitted sprites and builds the draw commands.
+         */
+        const std::vector<SpriteDrawCommand>& Build();
+
+        /**
+         * @brief Builds and, in OpenGL mode, draws the frame with one instanced call per command.
+         * @param viewProjection Maps TransformComponent positions to clip space.
+         */
+        void Draw(const glm::mat4& viewProjection);
+
+        /**
+         * @brief Draws instances and commands built earlier, possibly by another batcher. The
+         *        render thread uses this with the sprites of a published frame; only the GL
+         *        objects of this batcher are touched.
+         */
+        void DrawCommands(const std::vector<SpriteInstance>& drawInstances, const std::vector<SpriteDrawCommand>& drawCommands,
+            const glm::mat4& viewProjection);
+
+        static constexpr const char* GlyphVertexShader = "Assets/GraphicShaders/UE_Sprite.vert";
+        static constexpr const char* GlyphFragmentShader = "Assets/GraphicShaders/UE_Glyph.frag";  // Coverage in the red channel
+
+        /**
+         * @brief Loads UE_Sprite.vert / UE_Sprite.frag and creates the buffers. Called once a
+         *        GL context exists; Draw() calls it on first use.
+         */
+        bool InitializeGL(const std::string& vertexShaderPath = "Assets/GraphicShaders/UE_Sprite.vert",
+            const std::string& fragmentShaderPath = "Assets/GraphicShaders/UE_Sprite.frag");
+
+        /**
+         * @brief Deletes the shader and buffers. Called before the GL context is destroyed.
+         */
+        void ShutdownGL();
+
+        /**
+         * @brief Rebuilds the program of every initialized batcher that uses the shader file, from
+         *        the source cached in the AssetManager. Runs on the thread owning the GL context.
+         *        A shader that fails to compile or link leaves the previous program in use.
+         */
+        static void ReloadShaders(const std::string& shaderPath);
+
+        Mode GetMode() const { return mode; }
+        size_t GetSpriteCount() const { return keys.size(); }
+        const std::vector<SpriteDrawCommand>& GetCommands() const { return commands; }
+        const std::vector<SpriteInstance>& GetSortedInstances() const { return sorted; }
+
+    private:
+        void SortKeys();
+        GLuint LinkProgram() const;
+        void UseProgram(GLuint newProgram);
+
+        static std::vector<SpriteBatcher*>& InitializedBatchers();
+
+        Mode mode;
+        bool built = false;
+        bool sceneRendering = false;
+        bool renderThread = false;
+
+        std::vector<SpriteInstance> instances;  // Submission order
+        std::vector<uint64_t> keys;             // Same indexing as instances
+        std::vector<uint64_t> sortedKeys;
+        std::vector<uint32_t> order;            // Sorted position -> submission index
+        std::vector<uint64_t> keyScratch;
+        std::vector<uint32_t> orderScratch;
+        std::vector<SpriteInstance> sorted;     // Instances in draw order, uploaded as one buffer
+        std::vector<SpriteDrawCommand> commands;
+
+        std::string vertexPath;
+        std::string fragmentPath;
+        GLuint program = 0;
+        GLuint vertexArray = 0;
+        GLuint quadBuffer = 0;
+        GLuint instanceBuffer = 0;
+        size_t instanceCapacity = 0;            // Sprites the instance buffer can hold
+        GLint viewProjectionLocation = -1;
+        GLint useTextureLocation = -1;
+        GLint premultipliedAlphaLocation = -1;
+    };
+
+    extern SpriteBatcher GlobalSpriteBatcher;   // Global instance of the SpriteBatcher
+}
+#endif // !_SPRITE_BATCHER_H_
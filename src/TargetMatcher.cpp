@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TargetMatcher.cpp
+/// @Brief : Implements the TargetMatcher trie of active enemy words.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "TargetMatcher.h"
+#include <algorithm>
+#include <cctype>
+
+namespace Framework
+{
+    TargetMatcher GlobalTargetMatcher;
+
+    TargetMatcher::TargetMatcher()
+    {
+        nodes.emplace_back();   // Root
+    }
+
+    void TargetMatcher::ToLower(const std::string& text, std::string& lower)
+    {
+        lower.assign(text);     // Reuses the buffer of an earlier word
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    }
+
+    uint32_t TargetMatcher::FindChild(uint32_t node, char c) const
+    {
+        for (const auto& [key, child] : nodes[node].children)
+        {
+            if (key == c)
+            {
+                return child;
+            }
+        }
+        return NoNode;
+    }
+
+    uint32_t TargetMatcher::FindNode(const std::string& word) const
+    {
+        uint32_t node = 0;
+        for (char c : word)
+        {
+            node = FindChild(node, static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+            if (node == NoNode)
+            {
+                return NoNode;
+            }
+        }
+        return node;
+    }
+
+    uint32_t TargetMatcher::AllocateNode()
+    {
+        if (!freeNodes.empty())
+        {
+            uint32_t index = freeNodes.back();
+            freeNodes.pop_back();
+            return index;
+        }
+        nodes.emplace_back();
+        return static_cast<uint32_t>(nodes.size() - 1);
+    }
+
+    void TargetMatcher::EraseEntity(std::vector<Entity>& list, Entity entity)
+    {
+        auto it = std::find(list.begin(), list.end(), entity);
+        if (it != list.end())
+        {
+            *it = list.back();  // Order does not matter, swap with the last one
+            list.pop_back();
+        }
+    }
+
+    void TargetMatcher::AddTarget(Entity entity, const std::string& word)
+    {
+        if (HasTarget(entity))
+        {
+            RemoveTarget(entity);
+        }
+
+        Target& target = targets[entity];
+        ToLower(word, target.word);
+        const std::string& lower = target.word;
+        uint32_t node = 0;
+        nodes[node].passing.push_back(entity);
+        for (char c : lower)
+        {
+            uint32_t child = FindChild(node, c);
+            if (child == NoNode)
+            {
+                child = AllocateNode();     // May reallocate nodes, index again below
+                nodes[node].children.emplace_back(c, child);
+            }
+            node = child;
+            nodes[node].passing.push_back(entity);
+        }
+        nodes[node].ending.push_back(entity);
+
+        target.active = true;
+        ++activeCount;
+    }
+
+    void TargetMatcher::RemoveTarget(Entity entity)
+    {
+        auto it = targets.find(entity);
+        if (it == targets.end() || !it->second.active)
+        {
+            return;
+        }
+        it->second.active = false;
+        --activeCount;
+        const std::string& word = it->second.word;
+
+        uint32_t node = 0;
+        EraseEntity(nodes[node].passing, entity);
+        for (char c : word)
+        {
+            uint32_t child = FindChild(node, c);
+            EraseEntity(nodes[child].passing, entity);
+
+            // Nobody else uses this branch, detach it and free the rest of the word's path
+            if (nodes[child].passing.empty())
+            {
+                auto& siblings = nodes[node].children;
+                siblings.erase(std::find(siblings.begin(), siblings.end(), std::make_pair(c, child)));
+
+                uint32_t freed = child;
+                while (freed != NoNode)
+                {
+                    uint32_t next = nodes[freed].children.empty() ? NoNode : nodes[freed].children.front().second;
+                    nodes[freed].children.clear();
+                    nodes[freed].passing.clear();
+                    nodes[freed].ending.clear();
+                    freeNodes.push_back(freed);
+                    freed = next;
+                }
+                return;
+            }
+            node = child;
+        }
+        EraseEntity(nodes[node].ending, entity);
+    }
+
+    void TargetMatcher::Clear()
+    {
+        nodes.clear();
+        nodes.emplace_back();
+        freeNodes.clear();
+        targets.clear();
+        activeCount = 0;
+    }
+
+    const std::vector<Entity>& TargetMatcher::Match(const std::string& typed) const
+    {
+        static const std::vector<Entity> noMatches;
+
+        uint32_t node = FindNode(typed);
+        return node == NoNode ? noMatches : nodes[node].passing;
+    }
+
+    std::vector<Entity> TargetMatcher::MatchExact(const std::string& typed) const
+    {
+        uint32_t node = FindNode(typed);
+        return node == NoNode ? std::vector<Entity>() : nodes[node].ending;
+    }
+}
@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TargetMatcher.h
+/// @Brief : Declares the TargetMatcher, a small dynamic trie of the words
+///          shown on active enemies. Enemies are added when they spawn and
+///          removed when they die, and every node keeps the list of enemies
+///          whose word passes through it, so the enemies still matching the
+///          player's typed text are found in O(prefix + matches) per keystroke
+///          instead of comparing the text against every enemy.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _TARGET_MATCHER_H_
+#define _TARGET_MATCHER_H_
+#include "pch.h"
+#include "Coordinator.h"
+#include "ComponentList.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @class TargetMatcher
+     * @brief Index of active target words, matched against the player's typed prefix.
+     *        Matching is case insensitive.
+     */
+    class TargetMatcher
+    {
+    public:
+        TargetMatcher();
+
+        /**
+         * @brief Adds an enemy and its word. An enemy already present has its word replaced.
+         */
+        void AddTarget(Entity entity, const std::string& word);
+
+        /**
+         * @brief Removes an enemy, e.g. when it dies or is destroyed.
+         */
+        void RemoveTarget(Entity entity);
+
+        /**
+         * @brief Removes every target, called when the scene is cleared.
+         */
+        void Clear();
+
+        /**
+         * @brief Returns the enemies whose word starts with the typed text.
+         * @param typed Text typed so far.
+         * @return Matching enemies. The reference stays valid until the next Add/Remove/Clear.
+         */
+        const std::vector<Entity>& Match(const std::string& typed) const;
+
+        /**
+         * @brief Matches against the text the player has typed so far.
+         */
+        const std::vector<Entity>& Match(const PlayerComponent& player) const { return Match(player.CurrentText); }
+
+        /**
+         * @brief Returns the enemies whose whole word equals the typed text.
+         */
+        std::vector<Entity> MatchExact(const std::string& typed) const;
+
+        bool HasTarget(Entity entity) const
+        {
+            auto it = targets.find(entity);
+            return it != targets.end() && it->second.active;
+        }
+        size_t GetTargetCount() const { return activeCount; }
+
+    private:
+        /**
+         * @struct Node
+         * @brief Trie node. Children are few per node, so a small array beats a hash map.
+         */
+        struct Node
+        {
+            std::vector<std::pair<char, uint32_t>> children;
+            std::vector<Entity> passing;    // Enemies whose word goes through this node
+            std::vector<Entity> ending;     // Enemies whose word ends at this node
+        };
+
+        static constexpr uint32_t NoNode = UINT32_MAX;
+
+        uint32_t FindChild(uint32_t node, char c) const;
+        uint32_t FindNode(const std::string& word) const;
+        uint32_t AllocateNode();
+        static void EraseEntity(std::vector<Entity>& list, Entity entity);
+        static void ToLower(const std::string& text, std::string& lower);
+
+        struct Target
+        {
+            std::string word;       // Lowercase
+            bool active = false;
+        };
+
+        std::vector<Node> nodes;                                // Node 0 is the root
+        std::vector<uint32_t> freeNodes;                        // Pruned nodes ready for reuse
+        std::unordered_map<Entity, Target> targets;             // Kept when removed, so a recycled entity reuses its entry
+        size_t activeCount = 0;
+    };
+
+    extern TargetMatcher GlobalTargetMatcher;   // Global instance of the TargetMatcher
+}
+#endif // !_TARGET_MATCHER_H_
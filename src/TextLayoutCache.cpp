@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TextLayoutCache.cpp
+/// @Brief : Implements cached text layout with prefix reuse and eviction of
+///          unused layouts.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "TextLayoutCache.h"
+#include "AssetManager.h"
+#include "Metrics.h"
+#include <algorithm>
+
+namespace Framework
+{
+    TextLayoutCache GlobalTextLayoutCache;
+
+    const TextLayoutCache::Layout& TextLayoutCache::Get(Entity entity, const std::string& text, const std::string& fontName, float fontSize)
+    {
+        static Counter& fullLayouts = GlobalMetrics.GetCounter("ue_text_layout_full_total", "Texts laid out from the first character");
+        static Counter& partialLayouts = GlobalMetrics.GetCounter("ue_text_layout_partial_total", "Texts laid out from a changed suffix");
+
+        Layout& layout = layouts[entity];
+        layout.lastUsedFrame = frame;
+
+        if (layout.fontName != fontName || layout.fontSize != fontSize)
+        {
+            layout.fontName = fontName;
+            layout.fontSize = fontSize;
+            layout.text = text;
+            LayOut(layout, 0);
+            fullLayouts.Increment();
+        }
+        else if (layout.text != text)
+        {
+            // Keep the glyphs of the common prefix, as when the player types or erases a letter
+            const size_t common = static_cast<size_t>(std::mismatch(layout.text.begin(), layout.text.begin() + std::min(layout.text.size(), text.size()),
+                text.begin()).first - layout.text.begin());
+            layout.text = text;
+            LayOut(layout, common);
+            (common == 0 ? fullLayouts : partialLayouts).Increment();
+        }
+        return layout;
+    }
+
+    void TextLayoutCache::LayOut(Layout& layout, size_t start) const
+    {
+        layout.glyphs.resize(layout.text.size());
+        layout.penAfter.resize(layout.text.size());
+
+        const auto& fonts = GlobalAssetManager.GetFontCacheAssets();
+        auto font = fonts.find(layout.fontName);
+        float pen = start > 0 ? layout.penAfter[start - 1] : 0.0f;
+        const float scale = layout.fontSize;
+
+        for (size_t i = start; i < layout.text.size(); ++i)
+        {
+            GlyphQuad& quad = layout.glyphs[i];
+            quad = GlyphQuad{};
+
+            if (font != fonts.end())
+            {
+                auto glyph = font->second.find(layout.text[i]);
+                if (glyph != font->second.end())
+                {
+                    const AssetManager::Character& ch = glyph->second;
+                    quad.texture = ch.TextureID;
+                    quad.offset = glm::vec2(pen + ch.Bearing.x * scale, -(ch.Size.y - ch.Bearing.y) * scale);
+                    quad.size = glm::vec2(ch.Size.x * scale, ch.Size.y * scale);
+                    pen += (ch.Advance >> 6) * scale;   // Advance is in 1/64 pixels
+                }
+            }
+            layout.penAfter[i] = pen;
+        }
+
+        layout.width = pen;
+        layout.height = 0.0f;
+        for (const GlyphQuad& quad : layout.glyphs)
+        {
+            layout.height = std::max(layout.height, quad.offset.y + quad.size.y);
+        }
+    }
+
+    void TextLayoutCache::InvalidateFont(const std::string& fontName)
+    {
+        for (auto it = layouts.begin(); it != layouts.end();)
+        {
+            it = it->second.fontName == fontName ? layouts.erase(it) : std::next(it);
+        }
+    }
+
+    void TextLayoutCache::EndFrame()
+    {
+        ++frame;
+        if (frame % EvictionInterval != 0)
+        {
+            return;
+        }
+
+        for (auto it = layouts.begin(); it != layouts.end();)
+        {
+            it = frame - it->second.lastUsedFrame >= EvictionInterval ? layouts.erase(it) : std::next(it);
+        }
+    }
+}
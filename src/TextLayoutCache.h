@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TextLayoutCache.h
+/// @Brief : Declares TextLayoutCache, which keeps the laid-out glyph quads
+///          of every drawn TextComponent so text is not shaped again, glyph
+///          by glyph through the font's Character map, every frame. A layout
+///          is reused while its text, font and size stay the same. When only
+///          the end of the text changes (the typing field), the unchanged
+///          prefix is kept and only the new suffix is laid out.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _TEXT_LAYOUT_CACHE_H_
+#define _TEXT_LAYOUT_CACHE_H_
+#include "pch.h"
+#include "Coordinator.h"
+#include <glew.h>
+#include <glm.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @brief One character of a laid-out text, relative to the text's origin (baseline, left).
+     *        Characters the font has no glyph for have texture 0 and take no space.
+     */
+    struct GlyphQuad
+    {
+        GLuint texture = 0;
+        glm::vec2 offset{ 0.0f, 0.0f };     // Bottom-left corner
+        glm::vec2 size{ 0.0f, 0.0f };
+    };
+
+    /**
+     * @class TextLayoutCache
+     * @brief Glyph quads per entity, laid out with the same Bearing / Advance rules as the
+     *        text renderer, scaled by the TextComponent's fontSize.
+     */
+    class TextLayoutCache
+    {
+    public:
+        struct Layout
+        {
+            std::string text;
+            std::string fontName;
+            float fontSize = 0.0f;
+            std::vector<GlyphQuad> glyphs;  // One per character of text
+            std::vector<float> penAfter;    // Pen position after each character, where a changed suffix resumes
+            float width = 0.0f;             // Advance of the whole text
+            float height = 0.0f;            // Tallest glyph above the baseline
+            uint64_t lastUsedFrame = 0;
+        };
+
+        /**
+         * @brief Layout of an entity's text, laid out again only where it changed.
+         */
+        const Layout& Get(Entity entity, const std::string& text, const std::string& fontName, float fontSize);
+
+        void Invalidate(Entity entity) { layouts.erase(entity); }
+
+        /**
+         * @brief Drops every layout using a font, for when its glyphs are reloaded.
+         */
+        void InvalidateFont(const std::string& fontName);
+
+        void Clear() { layouts.clear(); }
+
+        /**
+         * @brief Advances the frame counter and, every EvictionInterval frames, drops layouts
+         *        not used for that long (destroyed entities, hidden popups).
+         */
+        void EndFrame();
+
+        size_t size() const { return layouts.size(); }
+
+        static constexpr uint64_t EvictionInterval = 300;
+
+    private:
+        // Lays out text from character index start onward; earlier glyphs are kept
+        void LayOut(Layout& layout, size_t start) const;
+
+        std::unordered_map<Entity, Layout> layouts;
+        uint64_t frame = 0;
+    };
+
+    extern TextLayoutCache GlobalTextLayoutCache;   // Global instance of the TextLayoutCache
+}
+#endif // !_TEXT_LAYOUT_CACHE_H_
@@ -17,22 +17,20 @@
 #include "pch.h"
 #include "TextureAsset.h"
 #include "AssetManager.h"
+#include "VirtualFileSystem.h"
+#include "JsonWriter.h"
 
 void TextureAsset::Deserialize(const std::string& filePath, std::unordered_map<std::string, TextureAsset::Texture>& imageAssets)
 {
-    std::ifstream file(filePath);
-    if (!file.is_open())
+    std::string contents;
+    if (!Framework::GlobalVirtualFileSystem.ReadFile(filePath, contents))
     {
         std::cerr << "Failed to open file: " << filePath << std::endl;
         return;
     }
 
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    file.close();
-
     rapidjson::Document document;
-    document.Parse(buffer.str().c_str());
+    Framework::ParseJson(document, contents);
 
     if (!document.IsObject())
     {
@@ -73,70 +71,30 @@ void TextureAsset::Deserialize(const std::string& filePath, std::unordered_map<s
 
 void TextureAsset::Serialize(const std::string& filePath, const std::unordered_map<std::string, TextureAsset::Texture>& imageAssets)
 {
-    rapidjson::Document document;
-
-    // Open file for reading (if it exists) and parse it
-    std::ifstream inFile(filePath);
-    if (inFile.is_open())
-    {
-        std::string fileContents((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
-        document.Parse(fileContents.c_str());
-
-        // Check for any parse errors
-        if (document.HasParseError()) 
-        {
-            std::cerr << "Failed to parse JSON file." << std::endl;
-            return;
-        }
-
-        // Check if the 'textures' key exists and is an array, if not, initialize it as an array
-        if (!document.HasMember("textures") || !document["textures"].IsArray()) 
-        {
-            rapidjson::Value texturesArray(rapidjson::kArrayType);
-            document.AddMember("textures", texturesArray, document.GetAllocator());  // Ensure we add an empty array if it's missing
-        }
-    }
-    else
+    // The manifest is rewritten from the map, straight to the file
+    Framework::JsonWriter writer(filePath, Framework::GlobalJsonStyle);
+    if (!writer.IsOpen())
     {
-        // If file does not exist, initialize document and add empty textures array
-        document.SetObject();
-        rapidjson::Value texturesArray(rapidjson::kArrayType);
-        document.AddMember("textures", texturesArray, document.GetAllocator());
+        std::cerr << "Failed to open file for writing: " << filePath << std::endl;
+        return;
     }
 
-    // Now we ensure that texturesArray is accessible
-    rapidjson::Value& texturesArray = document["textures"];
-
-    // Clear the textures array first, so we don't retain deleted textures
-    texturesArray.Clear();
-
-    // Iterate over the imageAssets map and add each texture to the texturesArray
-    rapidjson::Document::AllocatorType& allocator = document.GetAllocator();
-
-    // Iterate over each texture in the provided imageAssets map
+    writer.StartObject();
+    writer.Key("textures");
+    writer.StartArray();
     for (const auto& texturePair : imageAssets)
     {
         const TextureAsset::Texture& texture = texturePair.second;
-
-        // Create a JSON object for this texture
-        rapidjson::Value textureObject(rapidjson::kObjectType);
-        textureObject.AddMember("name", rapidjson::Value(texture.name.c_str(), allocator), allocator);
-        textureObject.AddMember("path", rapidjson::Value(texture.path.c_str(), allocator), allocator);
-
-        // Add this texture to the textures array
-        texturesArray.PushBack(textureObject, allocator);
+        writer.StartObject();
+        writer.Member("name", texture.name);
+        writer.Member("path", texture.path);
+        writer.EndObject();
     }
+    writer.EndArray();
+    writer.EndObject();
 
-    // Write the updated document to the file
-    rapidjson::StringBuffer buffer;
-    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
-    document.Accept(writer);
-
-    std::ofstream outFile(filePath);
-    if (outFile.is_open())
+    if (writer.Commit())
     {
-        outFile << buffer.GetString();  // Write the JSON string to the file
-        outFile.close();
         std::cout << "Successfully serialized textures to " << filePath << std::endl;
     }
     else
@@ -0,0 +1,167 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TextureImport.cpp
+/// @Brief : Implements the texture normalization pass. Straight alpha is
+///          premultiplied with the exact round(c * a / 255) in gamma space,
+///          or through 16 bit linear light tables for sRGB layouts.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "TextureImport.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UE_TEXTURE_IMPORT_SSE2 1
+#endif
+
+namespace Framework
+{
+    TextureLayout GlobalTextureLayout;
+
+    namespace
+    {
+        constexpr int LinearBits = 12;
+        constexpr int LinearSteps = 1 << LinearBits;
+
+        struct SrgbTables
+        {
+            uint16_t toLinear[256];             // sRGB byte -> linear light, 0..65535
+            uint8_t toSrgb[LinearSteps];        // Linear light, 12 bit -> nearest sRGB byte
+
+            SrgbTables()
+            {
+                for (int i = 0; i < 256; ++i)
+                {
+                    const double c = i / 255.0;
+                    const double linear = c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4);
+                    toLinear[i] = static_cast<uint16_t>(std::lround(linear * 65535.0));
+                }
+                for (int i = 0; i < LinearSteps; ++i)
+                {
+                    const double linear = i / static_cast<double>(LinearSteps - 1);
+                    const double c = linear <= 0.0031308 ? linear * 12.92 : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+                    toSrgb[i] = static_cast<uint8_t>(std::lround(std::clamp(c, 0.0, 1.0) * 255.0));
+                }
+            }
+        };
+
+        const SrgbTables& Tables()
+        {
+            static const SrgbTables tables;
+            return tables;
+        }
+
+        // round(value * alpha / 255) without a division
+        inline uint8_t MultiplyAlpha(uint32_t value, uint32_t alpha)
+        {
+            const uint32_t t = value * alpha + 128;
+            return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+        }
+
+        inline void PremultiplyPixel(uint8_t* pixel, bool srgb, const SrgbTables* tables)
+        {
+            const uint32_t alpha = pixel[3];
+            if (alpha == 255)
+            {
+                return;
+            }
+            for (int channel = 0; channel < 3; ++channel)
+            {
+                if (srgb)
+                {
+                    const uint32_t linear = (tables->toLinear[pixel[channel]] * alpha + 127) / 255;
+                    pixel[channel] = tables->toSrgb[std::min<uint32_t>((linear + 8) >> (16 - LinearBits), LinearSteps - 1)];
+                }
+                else
+                {
+                    pixel[channel] = MultiplyAlpha(pixel[channel], alpha);
+                }
+            }
+        }
+    }
+
+    namespace TextureImport
+    {
+        void NormalizeScalar(uint8_t* rgba, size_t pixelCount, const TextureLayout& layout)
+        {
+            if (!layout.premultipliedAlpha)
+            {
+                return;
+            }
+            const SrgbTables* tables = layout.srgb ? &Tables() : nullptr;
+            for (size_t i = 0; i < pixelCount; ++i)
+            {
+                PremultiplyPixel(rgba + i * 4, layout.srgb, tables);
+            }
+        }
+
+        void Normalize(uint8_t* rgba, size_t pixelCount, const TextureLayout& layout)
+        {
+#if defined(UE_TEXTURE_IMPORT_SSE2)
+            if (!layout.premultipliedAlpha)
+            {
+                return;
+            }
+            const SrgbTables* tables = layout.srgb ? &Tables() : nullptr;
+
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+            const __m128i colourLanes = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+            const __m128i alphaLaneOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);   // Alpha is multiplied by 255/255
+            const __m128i rounding = _mm_set1_epi16(128);
+
+            // Two pixels widened to 16 bits per channel, colour times alpha, alpha unchanged
+            auto premultiplyPair = [&](__m128i pair)
+            {
+                __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(pair, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+                alpha = _mm_or_si128(_mm_and_si128(alpha, colourLanes), alphaLaneOne);
+                const __m128i t = _mm_add_epi16(_mm_mullo_epi16(pair, alpha), rounding);
+                return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+            };
+
+            size_t i = 0;
+            for (; i + 4 <= pixelCount; i += 4)
+            {
+                uint8_t* pixels = rgba + i * 4;
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+                const __m128i alpha = _mm_and_si128(block, alphaMask);
+
+                // Sprites are mostly solid or empty: skip opaque runs, clear transparent ones
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xFFFF)
+                {
+                    continue;
+                }
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) == 0xFFFF)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels), zero);
+                    continue;
+                }
+
+                if (tables)
+                {
+                    for (int p = 0; p < 4; ++p)
+                    {
+                        PremultiplyPixel(pixels + p * 4, true, tables);
+                    }
+                    continue;
+                }
+                const __m128i low = premultiplyPair(_mm_unpacklo_epi8(block, zero));
+                const __m128i high = premultiplyPair(_mm_unpackhi_epi8(block, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels), _mm_packus_epi16(low, high));
+            }
+            for (; i < pixelCount; ++i)
+            {
+                PremultiplyPixel(rgba + i * 4, layout.srgb, tables);
+            }
+#else
+            NormalizeScalar(rgba, pixelCount, layout);
+#endif
+        }
+    }
+}
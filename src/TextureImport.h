@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TextureImport.h
+/// @Brief : Declares the texture layout the renderer samples and the import
+///          pass that converts decoded images into it. Every texture path
+///          (compressed containers, the decode fallback and hot reload) goes
+///          through Normalize, so the renderer only ever sees one layout.
+///          The default is straight alpha linear RGBA8, what the engine's
+///          shaders and glBlendFunc(GL_SRC_ALPHA, ...) expect. The batched
+///          sprite path switches to premultiplied alpha tagged sRGB, which
+///          blends with glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA) and
+///          filters and mips without dark fringes around cut-outs.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _TEXTURE_IMPORT_H_
+#define _TEXTURE_IMPORT_H_
+#include "pch.h"
+#include <glew.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace Framework
+{
+    /**
+     * @brief How texture texels are stored on the GPU.
+     */
+    struct TextureLayout
+    {
+        bool premultipliedAlpha = false;
+        bool srgb = false;      // Sampled through an sRGB format, blended in linear light
+
+        uint32_t Flags() const { return (premultipliedAlpha ? 1u : 0u) | (srgb ? 2u : 0u); }
+        bool operator==(const TextureLayout& other) const { return Flags() == other.Flags(); }
+        bool operator!=(const TextureLayout& other) const { return !(*this == other); }
+
+        /**
+         * @brief Internal format for uncompressed RGBA8 texels in this layout.
+         */
+        GLenum InternalFormat() const { return srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8; }
+    };
+
+    extern TextureLayout GlobalTextureLayout;   // Layout the renderer expects, set before textures load (Window::Deserialize)
+
+    namespace TextureImport
+    {
+        /**
+         * @brief Converts straight alpha RGBA8 pixels to the layout in place. sRGB layouts
+         *        premultiply in linear light, so the GPU's sRGB decode gives colour * alpha.
+         *        Fully opaque and fully transparent pixels, most of a sprite, take an SSE2 path
+         *        four at a time.
+         */
+        void Normalize(uint8_t* rgba, size_t pixelCount, const TextureLayout& layout = GlobalTextureLayout);
+
+        /**
+         * @brief Scalar reference of Normalize, used on platforms without SSE2.
+         */
+        void NormalizeScalar(uint8_t* rgba, size_t pixelCount, const TextureLayout& layout);
+    }
+}
+#endif // !_TEXTURE_IMPORT_H_
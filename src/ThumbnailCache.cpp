@@ -0,0 +1,500 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : ThumbnailCache.cpp
+/// @Brief : Implements thumbnail generation, the content hashed disk cache
+///          and the atlas. A cached thumbnail is a small header followed by
+///          the straight alpha RGBA8 texels the editor UI draws; its file
+///          name holds the content hash, the size and the kind, so changing
+///          any of them simply misses the cache.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "ThumbnailCache.h"
+#include "AssetManager.h"
+#include "Audio.h"
+#include "Metrics.h"
+#include "RenderQueue.h"
+#include "VirtualFileSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+namespace Framework
+{
+    ThumbnailCache GlobalThumbnailCache;
+
+    namespace
+    {
+        constexpr uint32_t ThumbnailMagic = 0x48544555;     // "UETH"
+        constexpr uint32_t ThumbnailVersion = 2;     // 2: straight alpha, whatever the renderer's layout
+        const char* const HashIndexFile = "ContentHashes.txt";
+        constexpr int AtlasSize = 2048;
+
+        struct ThumbnailHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t size;
+            uint32_t kind;
+        };
+
+        void Fill(std::vector<uint8_t>& pixels, int size, int x, int y, const uint8_t colour[4])
+        {
+            std::copy_n(colour, 4, pixels.data() + (static_cast<size_t>(y) * size + x) * 4);
+        }
+    }
+
+    /*******************/
+    //   Lifetime      //
+    /*******************/
+
+    void ThumbnailCache::Initialize(const std::string& folder, int size, unsigned workerCount)
+    {
+        // Requests made before the first Initialize() wait in the queue
+        if (IsRunning())
+        {
+            Shutdown();
+        }
+        cacheFolder = folder;
+        thumbnailSize = std::clamp(size, 64, 128);
+        cellsPerRow = AtlasSize / thumbnailSize;
+
+        std::error_code error;
+        std::filesystem::create_directories(cacheFolder, error);
+        if (error)
+        {
+            std::cerr << "ThumbnailCache: could not create " << cacheFolder << " (" << error.message() << "), thumbnails will not be cached" << std::endl;
+        }
+        LoadHashIndex();
+
+        if (workerCount == 0)
+        {
+            // Leave a core for the editor itself
+            workerCount = std::max(2u, std::thread::hardware_concurrency()) - 1;
+        }
+        stopping = false;
+        for (unsigned i = 0; i < workerCount; ++i)
+        {
+            workers.emplace_back(&ThumbnailCache::WorkerLoop, this);
+        }
+    }
+
+    void ThumbnailCache::Shutdown()
+    {
+        StopWorkers();
+        Clear();
+    }
+
+    void ThumbnailCache::StopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+            jobs.clear();
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+        workers.clear();
+        SaveHashIndex();
+    }
+
+    /*******************/
+    //   Content hash  //
+    /*******************/
+
+    bool ThumbnailCache::HashOf(const std::string& path, uint64_t& hash) const
+    {
+        // Archived files have no modification time and don't change while running, they are always hashed
+        ContentHash entry;
+        const std::string realPath = GlobalVirtualFileSystem.RealPath(path);
+        std::error_code error;
+        if (!realPath.empty())
+        {
+            entry.size = std::filesystem::file_size(realPath, error);
+            if (!error)
+            {
+                entry.modified = static_cast<int64_t>(std::filesystem::last_write_time(realPath, error).time_since_epoch().count());
+            }
+        }
+        const bool stamped = !realPath.empty() && !error;
+        const std::string key = VirtualFileSystem::Normalize(path);
+
+        if (stamped)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = contentHashes.find(key);
+            if (it != contentHashes.end() && it->second.size == entry.size && it->second.modified == entry.modified)
+            {
+                hash = it->second.hash;
+                return true;
+            }
+        }
+
+        // FNV-1a over the file's bytes
+        std::vector<uint8_t> contents;
+        if (!GlobalVirtualFileSystem.ReadFile(path, contents))
+        {
+            return false;
+        }
+        hash = 0xcbf29ce484222325ULL;
+        for (uint8_t byte : contents)
+        {
+            hash ^= byte;
+            hash *= 0x100000001b3ULL;
+        }
+
+        if (stamped)
+        {
+            entry.hash = hash;
+            std::lock_guard<std::mutex> lock(mutex);
+            contentHashes[key] = entry;
+            hashesChanged = true;
+        }
+        return true;
+    }
+
+    void ThumbnailCache::LoadHashIndex()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        contentHashes.clear();
+        hashesChanged = false;
+
+        // One "hash size modified path" line per file
+        std::ifstream in(cacheFolder + "/" + HashIndexFile);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            std::istringstream fields(line);
+            ContentHash entry;
+            std::string path;
+            if (fields >> std::hex >> entry.hash >> std::dec >> entry.size >> entry.modified && std::getline(fields >> std::ws, path) && !path.empty())
+            {
+                contentHashes[path] = entry;
+            }
+        }
+    }
+
+    void ThumbnailCache::SaveHashIndex()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!hashesChanged || cacheFolder.empty())
+        {
+            return;
+        }
+
+        // Written beside the target and renamed, another editor may be reading it
+        const std::string indexPath = cacheFolder + "/" + HashIndexFile;
+        const std::string tempPath = indexPath + ".tmp";
+        {
+            std::ofstream out(tempPath, std::ios::trunc);
+            for (const auto& [path, entry] : contentHashes)
+            {
+                out << std::hex << entry.hash << std::dec << ' ' << entry.size << ' ' << entry.modified << ' ' << path << '\n';
+            }
+        }
+        std::error_code error;
+        std::filesystem::rename(tempPath, indexPath, error);
+        if (error)
+        {
+            std::filesystem::remove(tempPath, error);
+            return;
+        }
+        hashesChanged = false;
+    }
+
+    void ThumbnailCache::Clear()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            jobs.clear();
+            results.clear();
+        }
+        thumbnails.clear();
+        usedCells = 0;
+
+        if (!atlasPages.empty())
+        {
+            std::vector<GLuint> pages;
+            pages.swap(atlasPages);
+            GlobalRenderQueue.Execute([&pages]() { glDeleteTextures(static_cast<GLsizei>(pages.size()), pages.data()); });
+        }
+    }
+
+    /*******************/
+    //   Requests      //
+    /*******************/
+
+    std::string ThumbnailCache::KeyOf(const std::string& path, Kind kind)
+    {
+        return std::to_string(static_cast<uint32_t>(kind)) + ':' + std::filesystem::path(path).lexically_normal().generic_string();
+    }
+
+    const ThumbnailCache::Thumbnail& ThumbnailCache::Request(const std::string& path, Kind kind)
+    {
+        auto [it, inserted] = thumbnails.try_emplace(KeyOf(path, kind));
+        if (inserted)
+        {
+            // Queued even before Initialize(), the workers pick it up once they start
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                jobs.push_back(Job{ path, kind });
+            }
+            wake.notify_one();
+        }
+        return it->second;
+    }
+
+    const ThumbnailCache::Thumbnail& ThumbnailCache::RequestTexture(const std::string& textureName)
+    {
+        return Request(GlobalAssetManager.UE_GetTexturePath(textureName), Kind::Texture);
+    }
+
+    const ThumbnailCache::Thumbnail& ThumbnailCache::RequestAudio(const std::string& audioName)
+    {
+        const AudioAsset::MusicAsset* asset = GlobalAssetManager.UE_GetMusicAssetByName(audioName);
+        return Request(asset ? asset->filePath : std::string(), Kind::Audio);
+    }
+
+    void ThumbnailCache::RequestAll()
+    {
+        for (const auto& [name, texture] : GlobalAssetManager.UE_GetAllTextureAssets())
+        {
+            Request(texture.path, Kind::Texture);
+        }
+        for (const std::string& name : GlobalAssetManager.UE_GetAllAudioNames())
+        {
+            RequestAudio(name);
+        }
+    }
+
+    size_t ThumbnailCache::GetPendingCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return jobs.size() + inProgress + results.size();
+    }
+
+    void ThumbnailCache::Update(size_t maxUploads)
+    {
+        static Counter& generatedCount = GlobalMetrics.GetCounter("ue_thumbnails_generated_total", "Asset browser thumbnails rendered from their asset");
+        static Counter& cachedCount = GlobalMetrics.GetCounter("ue_thumbnails_cached_total", "Asset browser thumbnails read from the disk cache");
+
+        std::vector<Result> finished;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const size_t count = std::min(maxUploads, results.size());
+            finished.assign(std::make_move_iterator(results.begin()), std::make_move_iterator(results.begin() + count));
+            results.erase(results.begin(), results.begin() + count);
+        }
+
+        for (Result& result : finished)
+        {
+            auto it = thumbnails.find(result.key);
+            if (it == thumbnails.end())
+            {
+                continue;   // Cleared while the worker was busy
+            }
+            if (result.pixels.empty())
+            {
+                it->second.failed = true;
+                continue;
+            }
+            Upload(it->second, result.pixels);
+            (result.fromDisk ? cachedCount : generatedCount).Increment();
+        }
+    }
+
+    void ThumbnailCache::Upload(Thumbnail& thumbnail, const std::vector<uint8_t>& pixels)
+    {
+        const size_t cellsPerPage = static_cast<size_t>(cellsPerRow) * cellsPerRow;
+        const size_t page = usedCells / cellsPerPage;
+        const size_t cell = usedCells % cellsPerPage;
+        const int x = static_cast<int>(cell % cellsPerRow) * thumbnailSize;
+        const int y = static_cast<int>(cell / cellsPerRow) * thumbnailSize;
+        ++usedCells;
+
+        GlobalRenderQueue.Execute([&]()
+            {
+                if (page == atlasPages.size())
+                {
+                    GLuint texture = 0;
+                    glGenTextures(1, &texture);
+                    glBindTexture(GL_TEXTURE_2D, texture);
+                    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, AtlasSize, AtlasSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                    atlasPages.push_back(texture);
+                }
+                glBindTexture(GL_TEXTURE_2D, atlasPages[page]);
+                glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, thumbnailSize, thumbnailSize, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+            });
+
+        thumbnail.ready = page < atlasPages.size();
+        thumbnail.failed = !thumbnail.ready;
+        if (thumbnail.ready)
+        {
+            const float scale = 1.0f / static_cast<float>(AtlasSize);
+            thumbnail.texture = atlasPages[page];
+            thumbnail.uvRect = glm::vec4(x * scale, y * scale, thumbnailSize * scale, thumbnailSize * scale);
+        }
+    }
+
+    /*******************/
+    //   Workers       //
+    /*******************/
+
+    void ThumbnailCache::WorkerLoop()
+    {
+        for (;;)
+        {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this]() { return stopping || !jobs.empty(); });
+                if (stopping)
+                {
+                    return;
+                }
+                job = std::move(jobs.front());
+                jobs.pop_front();
+                ++inProgress;
+            }
+
+            Result result;
+            result.key = KeyOf(job.path, job.kind);
+            result.pixels = Generate(job, result.fromDisk);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            --inProgress;
+            results.push_back(std::move(result));
+        }
+    }
+
+    std::vector<uint8_t> ThumbnailCache::Generate(const Job& job, bool& fromDisk) const
+    {
+        fromDisk = false;
+        uint64_t hash = 0;
+        if (job.path.empty() || !HashOf(job.path, hash))
+        {
+            return {};
+        }
+
+        const size_t byteCount = static_cast<size_t>(thumbnailSize) * thumbnailSize * 4;
+        char fileName[96];
+        std::snprintf(fileName, sizeof(fileName), "%016llx_%d_%u.uethumb", static_cast<unsigned long long>(hash), thumbnailSize,
+            static_cast<uint32_t>(job.kind));
+        const std::string cachePath = cacheFolder + "/" + fileName;
+
+        std::vector<uint8_t> pixels(byteCount);
+        {
+            std::ifstream cached(cachePath, std::ios::binary);
+            ThumbnailHeader header{};
+            if (cached.read(reinterpret_cast<char*>(&header), sizeof(header)) && header.magic == ThumbnailMagic && header.version == ThumbnailVersion
+                && header.size == static_cast<uint32_t>(thumbnailSize) && cached.read(reinterpret_cast<char*>(pixels.data()), static_cast<std::streamsize>(byteCount)))
+            {
+                fromDisk = true;
+                return pixels;
+            }
+        }
+
+        pixels = job.kind == Kind::Audio ? RenderWaveform(job.path) : RenderTexture(job.path);
+        if (pixels.empty())
+        {
+            return pixels;
+        }
+
+        // Written beside the target and renamed, another editor may be reading the cache
+        const std::string tempPath = cachePath + "." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp";
+        {
+            const ThumbnailHeader header{ ThumbnailMagic, ThumbnailVersion, static_cast<uint32_t>(thumbnailSize), static_cast<uint32_t>(job.kind) };
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            out.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+        }
+        std::error_code error;
+        std::filesystem::rename(tempPath, cachePath, error);
+        if (error)
+        {
+            std::filesystem::remove(tempPath, error);
+        }
+        return pixels;
+    }
+
+    std::vector<uint8_t> ThumbnailCache::RenderTexture(const std::string& path) const
+    {
+        std::vector<uint8_t> encoded;
+        if (!GlobalVirtualFileSystem.ReadFile(path, encoded))
+        {
+            return {};
+        }
+        int width = 0, height = 0, channels = 0;
+        unsigned char* image = stbi_load_from_memory(encoded.data(), static_cast<int>(encoded.size()), &width, &height, &channels, 4);
+        if (!image)
+        {
+            return {};
+        }
+
+        // Fit inside the cell keeping the aspect ratio, centred on a transparent background
+        const float scale = std::min(static_cast<float>(thumbnailSize) / width, static_cast<float>(thumbnailSize) / height);
+        const int fitWidth = std::clamp(static_cast<int>(std::lround(width * scale)), 1, thumbnailSize);
+        const int fitHeight = std::clamp(static_cast<int>(std::lround(height * scale)), 1, thumbnailSize);
+        std::vector<uint8_t> fitted(static_cast<size_t>(fitWidth) * fitHeight * 4);
+        // Filtered in linear light with alpha weighting, stored back as straight alpha sRGB bytes like the source
+        const bool resized = stbir_resize_uint8_srgb(image, width, height, 0, fitted.data(), fitWidth, fitHeight, 0, STBIR_RGBA) != nullptr;
+        stbi_image_free(image);
+        if (!resized)
+        {
+            return {};
+        }
+
+        std::vector<uint8_t> pixels(static_cast<size_t>(thumbnailSize) * thumbnailSize * 4, 0);
+        const int left = (thumbnailSize - fitWidth) / 2;
+        const int top = (thumbnailSize - fitHeight) / 2;
+        for (int row = 0; row < fitHeight; ++row)
+        {
+            std::copy_n(fitted.data() + static_cast<size_t>(row) * fitWidth * 4, static_cast<size_t>(fitWidth) * 4,
+                pixels.data() + (static_cast<size_t>(top + row) * thumbnailSize + left) * 4);
+        }
+        return pixels;
+    }
+
+    std::vector<uint8_t> ThumbnailCache::RenderWaveform(const std::string& path) const
+    {
+        const std::vector<float> peaks = GlobalAudio.UE_ReadWaveformPeaks(path, static_cast<size_t>(thumbnailSize));
+        if (peaks.empty())
+        {
+            return {};
+        }
+
+        static const uint8_t background[4] = { 28, 30, 36, 230 };
+        static const uint8_t wave[4] = { 110, 190, 255, 255 };
+        static const uint8_t centre[4] = { 60, 70, 90, 255 };
+
+        std::vector<uint8_t> pixels(static_cast<size_t>(thumbnailSize) * thumbnailSize * 4);
+        const int middle = thumbnailSize / 2;
+        for (int x = 0; x < thumbnailSize; ++x)
+        {
+            // Mirrored bar per column, at least the centre line so silence still reads as audio
+            const int halfHeight = static_cast<int>(peaks[x] * (middle - 2));
+            for (int y = 0; y < thumbnailSize; ++y)
+            {
+                const int distance = std::abs(y - middle);
+                Fill(pixels, thumbnailSize, x, y, distance <= halfHeight && halfHeight > 0 ? wave : distance == 0 ? centre : background);
+            }
+        }
+        return pixels;
+    }
+}
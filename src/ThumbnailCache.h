@@ -0,0 +1,164 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : ThumbnailCache.h
+/// @Brief : Declares ThumbnailCache, the small previews shown by the editor's
+///          asset browser. Textures are shrunk with stb_image_resize2 and
+///          audio files get a waveform picture, both on worker threads.
+///          Finished thumbnails are cached on disk under the hash of the
+///          file's contents, so renamed or moved assets keep their preview
+///          and an edited file gets a new one. Each file's hash is kept with
+///          its size and modification time, so unchanged files are not read
+///          again to find their thumbnail. Previews are packed into a
+///          few atlas textures, so the panel draws hundreds of entries with
+///          a handful of textures and opens without decoding any asset.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _THUMBNAIL_CACHE_H_
+#define _THUMBNAIL_CACHE_H_
+#include "pch.h"
+#include <glew.h>
+#include <glm.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @class ThumbnailCache
+     * @brief Request() from the editor UI, Update() once per editor frame on the thread that
+     *        loads textures. Thumbnails become ready over the following frames.
+     */
+    class ThumbnailCache
+    {
+    public:
+        enum class Kind : uint32_t
+        {
+            Texture = 0,
+            Audio = 1,
+        };
+
+        struct Thumbnail
+        {
+            bool ready = false;
+            bool failed = false;                        // Missing or undecodable file, nothing will show
+            GLuint texture = 0;                         // Atlas page holding the thumbnail
+            glm::vec4 uvRect{ 0.0f, 0.0f, 0.0f, 0.0f }; // Offset xy, size zw, as SpriteInstance::uvRect
+        };
+
+        ThumbnailCache() = default;
+        ~ThumbnailCache() { StopWorkers(); }   // GL objects are released by Shutdown(), while the context exists
+        ThumbnailCache(const ThumbnailCache&) = delete;
+        ThumbnailCache& operator=(const ThumbnailCache&) = delete;
+
+        /**
+         * @brief Starts the workers. Called once the GL context exists. Requests made before
+         *        are kept and generated once the workers run.
+         * @param thumbnailSize Edge of a thumbnail in pixels, clamped to 64..128.
+         * @param workerCount Worker threads, 0 for one per core but one.
+         */
+        void Initialize(const std::string& cacheFolder = "Assets/Cache/Thumbnails", int thumbnailSize = 96, unsigned workerCount = 0);
+
+        /**
+         * @brief Stops the workers and deletes the atlas textures.
+         */
+        void Shutdown();
+
+        bool IsRunning() const { return !workers.empty(); }
+
+        /**
+         * @brief Thumbnail of an image or audio file, queued for generation on first request.
+         *        The reference stays valid until Clear() or Shutdown().
+         */
+        const Thumbnail& Request(const std::string& path, Kind kind);
+
+        /**
+         * @brief Queues every texture and audio asset of the AssetManager, e.g. when the asset
+         *        browser opens.
+         */
+        void RequestAll();
+
+        const Thumbnail& RequestTexture(const std::string& textureName);
+        const Thumbnail& RequestAudio(const std::string& audioName);
+
+        /**
+         * @brief Copies finished thumbnails into the atlas.
+         * @param maxUploads Thumbnails uploaded this call, the rest wait for the next frame.
+         */
+        void Update(size_t maxUploads = 64);
+
+        /**
+         * @brief Forgets every thumbnail and atlas slot; the disk cache is kept.
+         */
+        void Clear();
+
+        int GetThumbnailSize() const { return thumbnailSize; }
+        size_t GetPendingCount() const;
+        size_t GetAtlasPageCount() const { return atlasPages.size(); }
+
+    private:
+        struct Job
+        {
+            std::string path;
+            Kind kind = Kind::Texture;
+        };
+
+        struct Result
+        {
+            std::string key;
+            std::vector<uint8_t> pixels;    // thumbnailSize squared straight alpha RGBA8, empty on failure
+            bool fromDisk = false;
+        };
+
+        struct ContentHash
+        {
+            uint64_t size = 0;
+            int64_t modified = 0;
+            uint64_t hash = 0;
+        };
+
+        static std::string KeyOf(const std::string& path, Kind kind);
+
+        bool HashOf(const std::string& path, uint64_t& hash) const;
+        void LoadHashIndex();
+        void SaveHashIndex();
+
+        void StopWorkers();
+        void WorkerLoop();
+        std::vector<uint8_t> Generate(const Job& job, bool& fromDisk) const;
+        std::vector<uint8_t> RenderTexture(const std::string& path) const;
+        std::vector<uint8_t> RenderWaveform(const std::string& path) const;
+        void Upload(Thumbnail& thumbnail, const std::vector<uint8_t>& pixels);
+
+        std::string cacheFolder;
+        int thumbnailSize = 96;
+        int cellsPerRow = 0;
+
+        std::unordered_map<std::string, Thumbnail> thumbnails;     // Main thread only, keyed by kind and path
+        std::vector<GLuint> atlasPages;
+        size_t usedCells = 0;                                       // Cells handed out across all pages
+
+        mutable std::mutex mutex;                                   // Guards jobs, results, contentHashes, stopping
+        std::condition_variable wake;
+        std::deque<Job> jobs;
+        std::vector<Result> results;
+        mutable std::unordered_map<std::string, ContentHash> contentHashes;  // By path, saved in the cache folder
+        mutable bool hashesChanged = false;
+        size_t inProgress = 0;
+        bool stopping = false;
+        std::vector<std::thread> workers;
+    };
+
+    extern ThumbnailCache GlobalThumbnailCache;     // Global instance of the ThumbnailCache
+}
+#endif // !_THUMBNAIL_CACHE_H_
@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TimelineEvaluator.h
+/// @Brief : Declares TimelineEvaluator, which plays UI transitions without
+///          calling a type-erased TransitionIn / TransitionOut callback per
+///          entity. A transition function name registered as a curve (what
+///          it animates, its easing and its end values) is played as a
+///          track. Tracks are grouped by easing and kept in contiguous
+///          arrays, so one tight loop evaluates every track of an easing.
+///          Easing curves are sampled from tables built once at startup.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _TIMELINE_EVALUATOR_H_
+#define _TIMELINE_EVALUATOR_H_
+#include "pch.h"
+#include "Coordinator.h"
+#include <glm.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework
+{
+    enum class Easing : uint8_t
+    {
+        Linear,
+        InQuad,
+        OutQuad,
+        InOutQuad,
+        OutCubic,
+        OutBack,        // Overshoots the end value, then settles
+        OutElastic,     // Springs around the end value
+        Count
+    };
+
+    /**
+     * @brief Component value a curve animates.
+     */
+    enum class TimelineChannel : uint8_t
+    {
+        Alpha,          // RenderComponent alpha
+        PositionX,      // TransformComponent position
+        PositionY,
+        Scale,          // TransformComponent scale, both axes multiplied from the scale at Play()
+    };
+
+    /**
+     * @brief What a transition function does, as data.
+     */
+    struct TimelineCurve
+    {
+        TimelineChannel channel = TimelineChannel::Alpha;
+        Easing easing = Easing::Linear;
+        float from = 0.0f;
+        float to = 1.0f;
+        bool useTimelinePositions = false;  // Take from / to from the TimelineComponent's startPosition / endPosition
+    };
+
+    /**
+     * @class TimelineEvaluator
+     * @brief Batched transition playback. Game code registers curves for its transition
+     *        names at startup; entities whose transition has a curve are played here, the
+     *        others keep their TimelineComponent callbacks.
+     */
+    class TimelineEvaluator
+    {
+    public:
+        TimelineEvaluator();
+
+        /**
+         * @brief Makes a transition function name play as a curve.
+         */
+        void RegisterCurve(const std::string& functionName, const TimelineCurve& curve) { curves[functionName] = curve; }
+
+        /**
+         * @brief Registers the curves listed in a JSON file ("curves": name, channel, easing,
+         *        from, to, useTimelinePositions). Must run before scenes load, since the
+         *        deserializer binds curve names to callbacks that forward to PlayTimeline().
+         * @return False if the file can't be read or parsed; bad entries are skipped with a warning.
+         */
+        bool LoadCurves(const std::string& filePath);
+
+        /**
+         * @brief Curve registered for a transition function name, nullptr if it has none.
+         */
+        const TimelineCurve* FindCurve(const std::string& functionName) const;
+
+        /**
+         * @brief Plays the entity's transition in (or out) from its TimelineComponent, if its
+         *        function name has a curve. The component is marked Active until the track ends.
+         * @param withDelay False when the caller already waited for TransitionIn/OutDelay.
+         * @return False if the entity has no TimelineComponent or the function has no curve.
+         */
+        bool PlayTimeline(Entity entity, bool transitionIn, bool withDelay = true);
+
+        /**
+         * @brief Whether a track started by PlayTimeline() in that direction is still playing.
+         */
+        bool IsPlayingTimeline(Entity entity, bool transitionIn) const
+        {
+            auto it = timelineTracks.find(entity);
+            return it != timelineTracks.end() && it->second == transitionIn;
+        }
+
+        /**
+         * @brief Plays a curve on an entity, replacing the track it already has.
+         * @param delay Seconds before the curve starts; the start value is held meanwhile.
+         */
+        void Play(Entity entity, const TimelineCurve& curve, float duration, float delay = 0.0f);
+
+        void Stop(Entity entity);
+
+        void Clear();
+
+        /**
+         * @brief Advances every track by dt, then writes the values to the components. Tracks
+         *        that reached their end write their final value and are dropped.
+         */
+        void Update(float dt);
+
+        /**
+         * @brief Advances every track and computes its value, without touching components.
+         */
+        void Advance(float dt);
+
+        /**
+         * @brief Writes the values computed by Advance() and drops finished tracks. Tracks
+         *        started by PlayTimeline() leave their TimelineComponent inactive when they end.
+         */
+        void Apply();
+
+        bool IsPlaying(Entity entity) const { return locations.count(entity) != 0; }
+        size_t size() const { return locations.size(); }
+
+        /**
+         * @brief Value of an easing at t in [0, 1], read from its table.
+         */
+        float Ease(Easing easing, float t) const;
+
+        static constexpr int TableSize = 256;   // Intervals per easing table
+
+    private:
+        // Tracks sharing an easing, one array per field
+        struct Group
+        {
+            std::vector<Entity> entities;
+            std::vector<TimelineChannel> channels;
+            std::vector<float> elapsed;         // Seconds since the curve started, negative during the delay
+            std::vector<float> inverseDuration;
+            std::vector<float> from;
+            std::vector<float> delta;           // to - from
+            std::vector<float> values;          // Written by Advance()
+            std::vector<uint8_t> finished;
+        };
+
+        struct Location
+        {
+            uint8_t easing;
+            uint32_t index;
+        };
+
+        void Remove(Easing easing, uint32_t index);
+
+        std::array<Group, static_cast<size_t>(Easing::Count)> groups;
+        std::array<std::array<float, TableSize + 1>, static_cast<size_t>(Easing::Count)> tables;
+        std::unordered_map<Entity, Location> locations;
+        std::unordered_map<Entity, glm::vec2> baseScales;   // Scale at Play() of Scale tracks
+        std::unordered_map<Entity, bool> timelineTracks;    // Tracks started by PlayTimeline(), true for a transition in
+        std::unordered_map<std::string, TimelineCurve> curves;
+    };
+
+    extern TimelineEvaluator GlobalTimelineEvaluator;   // Global instance of the TimelineEvaluator
+}
+#endif // !_TIMELINE_EVALUATOR_H_
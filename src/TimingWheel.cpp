@@ -0,0 +1,355 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TimingWheel.cpp
+/// @Brief : Implements timer scheduling, cancellation and the cascading of
+///          timers down the wheel levels.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "TimingWheel.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Framework
+{
+    TimingWheel GlobalTimingWheel;
+    TimingWheel GlobalUITimingWheel;
+
+    TimingWheel::TimingWheel()
+    {
+        // Index 0 is never handed out, so a handle built from it can't match a live timer
+        timers.resize(1);
+    }
+
+    uint64_t TimingWheel::TicksFor(float seconds) const
+    {
+        if (seconds <= 0.0f)
+        {
+            return 0;
+        }
+        return static_cast<uint64_t>(std::llround(static_cast<double>(seconds) / tickDuration));
+    }
+
+    /*******************/
+    //   Scheduling    //
+    /*******************/
+
+    TimerHandle TimingWheel::Schedule(Entity entity, TimerKind kind, float delay, float interval, uint32_t data)
+    {
+        uint32_t index;
+        if (!freeTimers.empty())
+        {
+            index = freeTimers.back();
+            freeTimers.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(timers.size());
+            timers.emplace_back();
+        }
+
+        Timer& timer = timers[index];
+        timer.dueTick = currentTick + std::max<uint64_t>(TicksFor(delay), 1);
+        timer.intervalTicks = interval > 0.0f ? std::max<uint64_t>(TicksFor(interval), 1) : 0;
+        timer.sequence = nextSequence++;
+        timer.active = true;
+        timer.event = TimerEvent{ entity, kind, data, (static_cast<uint64_t>(timer.generation) << 32) | index };
+
+        Insert(index);
+        LinkEntity(index);
+        ++activeCount;
+        return timer.event.handle;
+    }
+
+    TimingWheel::Timer* TimingWheel::Resolve(TimerHandle handle)
+    {
+        const uint32_t index = static_cast<uint32_t>(handle & 0xFFFFFFFFu);
+        if (index == 0 || index >= timers.size())
+        {
+            return nullptr;
+        }
+        Timer& timer = timers[index];
+        return timer.active && timer.event.handle == handle ? &timer : nullptr;
+    }
+
+    const TimingWheel::Timer* TimingWheel::Resolve(TimerHandle handle) const
+    {
+        return const_cast<TimingWheel*>(this)->Resolve(handle);
+    }
+
+    bool TimingWheel::Cancel(TimerHandle handle)
+    {
+        Timer* timer = Resolve(handle);
+        if (!timer)
+        {
+            return false;
+        }
+        Release(static_cast<uint32_t>(handle & 0xFFFFFFFFu));
+        return true;
+    }
+
+    void TimingWheel::CancelEntity(Entity entity, TimerKind kind)
+    {
+        auto it = entityTimers.find(entity);
+        uint32_t index = it != entityTimers.end() ? it->second : None;
+        while (index != None)
+        {
+            const uint32_t next = timers[index].entityNext;
+            if (kind == TimerKind::Count || timers[index].event.kind == kind)
+            {
+                Release(index);
+            }
+            index = next;
+        }
+    }
+
+    bool TimingWheel::IsScheduled(Entity entity, TimerKind kind) const
+    {
+        auto it = entityTimers.find(entity);
+        for (uint32_t index = it != entityTimers.end() ? it->second : None; index != None; index = timers[index].entityNext)
+        {
+            if (timers[index].event.kind == kind)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    float TimingWheel::GetRemaining(TimerHandle handle) const
+    {
+        const Timer* timer = Resolve(handle);
+        return timer ? static_cast<float>(timer->dueTick - currentTick) * tickDuration : -1.0f;
+    }
+
+    void TimingWheel::Clear()
+    {
+        // Generations are kept so handles from before the clear stay invalid
+        freeTimers.clear();
+        for (uint32_t index = static_cast<uint32_t>(timers.size()); index-- > 1;)
+        {
+            Timer& timer = timers[index];
+            if (timer.active)
+            {
+                ++timer.generation;
+            }
+            timer = Timer{ TimerEvent{}, 0, 0, 0, timer.generation };
+            freeTimers.push_back(index);
+        }
+        for (auto& level : wheel)
+        {
+            level.fill(SlotList{});
+        }
+        entityTimers.clear();
+        activeCount = 0;
+        remainder = 0.0f;
+    }
+
+    /*******************/
+    //   Lists         //
+    /*******************/
+
+    void TimingWheel::Insert(uint32_t index)
+    {
+        Timer& timer = timers[index];
+
+        // Lowest level whose slots still tell the due tick apart from the current one
+        int level = LevelCount - 1;
+        uint64_t slotTick = (currentTick >> (SlotBits * level)) + SlotCount - 1;  // Farthest top slot, timers beyond it wait there
+        for (int candidate = 0; candidate < LevelCount; ++candidate)
+        {
+            const int shift = SlotBits * candidate;
+            if ((timer.dueTick >> shift) - (currentTick >> shift) < static_cast<uint64_t>(SlotCount))
+            {
+                level = candidate;
+                slotTick = timer.dueTick >> shift;
+                break;
+            }
+        }
+
+        timer.level = static_cast<uint8_t>(level);
+        timer.slot = static_cast<uint8_t>(slotTick & (SlotCount - 1));
+        SlotList& list = wheel[level][timer.slot];
+        timer.prev = None;
+        timer.next = list.head;
+        if (list.head != None)
+        {
+            timers[list.head].prev = index;
+        }
+        list.head = index;
+        timer.linked = true;
+    }
+
+    void TimingWheel::Unlink(uint32_t index)
+    {
+        Timer& timer = timers[index];
+        if (!timer.linked)
+        {
+            return;
+        }
+        if (timer.prev != None)
+        {
+            timers[timer.prev].next = timer.next;
+        }
+        else
+        {
+            wheel[timer.level][timer.slot].head = timer.next;
+        }
+        if (timer.next != None)
+        {
+            timers[timer.next].prev = timer.prev;
+        }
+        timer.prev = timer.next = None;
+        timer.linked = false;
+    }
+
+    void TimingWheel::LinkEntity(uint32_t index)
+    {
+        Timer& timer = timers[index];
+        auto [it, inserted] = entityTimers.try_emplace(timer.event.entity, index);
+        timer.entityPrev = None;
+        timer.entityNext = inserted ? None : it->second;
+        if (!inserted)
+        {
+            timers[it->second].entityPrev = index;
+            it->second = index;
+        }
+    }
+
+    void TimingWheel::UnlinkEntity(uint32_t index)
+    {
+        Timer& timer = timers[index];
+        if (timer.entityPrev != None)
+        {
+            timers[timer.entityPrev].entityNext = timer.entityNext;
+        }
+        else if (timer.entityNext != None)
+        {
+            entityTimers[timer.event.entity] = timer.entityNext;
+        }
+        else
+        {
+            entityTimers.erase(timer.event.entity);
+        }
+        if (timer.entityNext != None)
+        {
+            timers[timer.entityNext].entityPrev = timer.entityPrev;
+        }
+        timer.entityPrev = timer.entityNext = None;
+    }
+
+    void TimingWheel::Release(uint32_t index)
+    {
+        Unlink(index);
+        UnlinkEntity(index);
+        Timer& timer = timers[index];
+        timer.active = false;
+        ++timer.generation;
+        freeTimers.push_back(index);
+        --activeCount;
+    }
+
+    /*******************/
+    //   Stepping      //
+    /*******************/
+
+    template <typename Fire>
+    void TimingWheel::StepWith(Fire&& fire)
+    {
+        ++currentTick;
+
+        // Higher levels first: their timers may land in a lower slot cascaded on this same tick
+        for (int level = LevelCount - 1; level >= 1; --level)
+        {
+            const int shift = SlotBits * level;
+            if ((currentTick & ((uint64_t(1) << shift) - 1)) != 0)
+            {
+                continue;
+            }
+
+            SlotList& list = wheel[level][(currentTick >> shift) & (SlotCount - 1)];
+            uint32_t index = list.head;
+            list.head = None;
+            while (index != None)
+            {
+                const uint32_t next = timers[index].next;
+                timers[index].linked = false;
+                Insert(index);
+                index = next;
+            }
+        }
+
+        // Every timer in the current level 0 slot is due now
+        SlotList& due = wheel[0][currentTick & (SlotCount - 1)];
+        firedScratch.clear();
+        for (uint32_t index = due.head; index != None;)
+        {
+            const uint32_t next = timers[index].next;
+            timers[index].linked = false;
+            timers[index].prev = timers[index].next = None;
+            firedScratch.emplace_back(index, timers[index].generation);
+            index = next;
+        }
+        due.head = None;
+
+        std::sort(firedScratch.begin(), firedScratch.end(), [this](const auto& a, const auto& b)
+            {
+                return timers[a.first].sequence < timers[b.first].sequence;
+            });
+
+        for (size_t i = 0; i < firedScratch.size(); ++i)
+        {
+            const auto [index, generation] = firedScratch[i];
+            Timer& timer = timers[index];
+            if (!timer.active || timer.generation != generation)
+            {
+                continue;   // Cancelled by an earlier handler this step
+            }
+
+            // Copied: the handler may schedule timers and grow the array
+            const TimerEvent event = timer.event;
+            if (timer.intervalTicks > 0)
+            {
+                timer.dueTick += timer.intervalTicks;
+                timer.sequence = nextSequence++;
+                Insert(index);
+            }
+            else
+            {
+                Release(index);
+            }
+            fire(event);
+        }
+    }
+
+    void TimingWheel::Step()
+    {
+        StepWith([this](const TimerEvent& event)
+            {
+                const Handler& handler = handlers[static_cast<size_t>(event.kind)];
+                if (handler)
+                {
+                    handler(event);
+                }
+            });
+    }
+
+    void TimingWheel::Step(std::vector<TimerEvent>& due)
+    {
+        StepWith([&due](const TimerEvent& event) { due.push_back(event); });
+    }
+
+    void TimingWheel::Advance(float dt)
+    {
+        remainder += dt;
+        while (remainder >= tickDuration)
+        {
+            remainder -= tickDuration;
+            Step();
+        }
+    }
+}
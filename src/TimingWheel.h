@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TimingWheel.h
+/// @Brief : Declares TimingWheel, a hierarchical timing wheel for gameplay
+///          timers: spawner intervals, enemy spawns, status effect expiries
+///          and button press cooldowns. Instead of every entity ticking its
+///          own timer each frame, a timer is scheduled once and the wheel
+///          only touches it when it is due, so a step costs O(timers due).
+///          The wheel advances one tick per fixed simulation step, and
+///          timers due on the same tick fire in the order they were
+///          scheduled, so a replay fires the same events in the same order.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _TIMING_WHEEL_H_
+#define _TIMING_WHEEL_H_
+#include "pch.h"
+#include "Coordinator.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Framework
+{
+    enum class TimerKind : uint8_t
+    {
+        Spawn,              // Repeating spawns; SpawnerComponent still accumulates its own interval
+        EnemySpawn,         // EnemyComponent spawnTimer
+        StatusEffectExpiry,
+        ButtonCooldown,     // ButtonComponent pressCooldown
+        Custom,
+        Count
+    };
+
+    using TimerHandle = uint64_t;
+    constexpr TimerHandle InvalidTimer = 0;
+
+    /**
+     * @brief What a timer reports when it fires.
+     */
+    struct TimerEvent
+    {
+        Entity entity = 0;
+        TimerKind kind = TimerKind::Custom;
+        uint32_t data = 0;      // Free for the handler, e.g. the status effect type
+        TimerHandle handle = InvalidTimer;
+    };
+
+    /**
+     * @class TimingWheel
+     * @brief Four levels of 64 slots. Level 0 holds timers due within 64 ticks, each further
+     *        level 64 times further ahead; timers move down a level as their time comes closer.
+     */
+    class TimingWheel
+    {
+    public:
+        using Handler = std::function<void(const TimerEvent&)>;
+
+        TimingWheel();
+
+        /**
+         * @brief Seconds per tick. The FrameScheduler sets it to its fixed step.
+         */
+        void SetTickDuration(float seconds) { tickDuration = seconds > 0.0f ? seconds : tickDuration; }
+        float GetTickDuration() const { return tickDuration; }
+
+        /**
+         * @brief Function called with every due timer of a kind. Timers of a kind without a
+         *        handler fire without effect.
+         */
+        void SetHandler(TimerKind kind, Handler handler) { handlers[static_cast<size_t>(kind)] = std::move(handler); }
+
+        /**
+         * @brief Schedules a timer.
+         * @param delay Seconds until it fires, rounded to whole ticks, at least one.
+         * @param interval Seconds between repeats, 0 for a one-shot timer.
+         */
+        TimerHandle Schedule(Entity entity, TimerKind kind, float delay, float interval = 0.0f, uint32_t data = 0);
+
+        /**
+         * @brief Cancels a timer. Stale or invalid handles are ignored.
+         */
+        bool Cancel(TimerHandle handle);
+
+        /**
+         * @brief Cancels every timer of an entity, of one kind or of all kinds (TimerKind::Count).
+         */
+        void CancelEntity(Entity entity, TimerKind kind = TimerKind::Count);
+
+        /**
+         * @brief Whether the entity has a timer of a kind pending, e.g. a button still cooling down.
+         */
+        bool IsScheduled(Entity entity, TimerKind kind) const;
+
+        /**
+         * @brief Seconds until a timer fires, negative for an invalid handle.
+         */
+        float GetRemaining(TimerHandle handle) const;
+
+        void Clear();
+
+        /**
+         * @brief Advances one tick and fires the timers due, in scheduling order.
+         */
+        void Step();
+
+        /**
+         * @brief Advances the ticks covered by dt seconds; the remainder carries over.
+         */
+        void Advance(float dt);
+
+        /**
+         * @brief Step() without handlers: appends the timers due to due instead of firing them.
+         */
+        void Step(std::vector<TimerEvent>& due);
+
+        uint64_t GetCurrentTick() const { return currentTick; }
+        size_t size() const { return activeCount; }
+
+        static constexpr int SlotBits = 6;
+        static constexpr int SlotCount = 1 << SlotBits;
+        static constexpr int LevelCount = 4;
+
+    private:
+        static constexpr uint32_t None = UINT32_MAX;
+
+        struct Timer
+        {
+            TimerEvent event;
+            uint64_t dueTick = 0;
+            uint64_t intervalTicks = 0;
+            uint64_t sequence = 0;          // Scheduling order, breaks ties between timers due on one tick
+            uint32_t generation = 1;        // Bumped on release so old handles stop matching
+            uint32_t prev = None, next = None;              // Slot list
+            uint32_t entityPrev = None, entityNext = None;  // Entity list
+            uint8_t level = 0, slot = 0;
+            bool linked = false;            // In a wheel slot; not while being fired
+            bool active = false;
+        };
+
+        struct SlotList
+        {
+            uint32_t head = None;
+        };
+
+        uint64_t TicksFor(float seconds) const;
+        void Insert(uint32_t index);
+        void Unlink(uint32_t index);
+        void Release(uint32_t index);
+        void LinkEntity(uint32_t index);
+        void UnlinkEntity(uint32_t index);
+        Timer* Resolve(TimerHandle handle);
+        const Timer* Resolve(TimerHandle handle) const;
+        template <typename Fire>
+        void StepWith(Fire&& fire);
+
+        std::vector<Timer> timers;
+        std::vector<uint32_t> freeTimers;
+        std::array<std::array<SlotList, SlotCount>, LevelCount> wheel;
+        std::unordered_map<Entity, uint32_t> entityTimers;   // First timer of each entity
+        std::array<Handler, static_cast<size_t>(TimerKind::Count)> handlers;
+
+        uint64_t currentTick = 0;
+        uint64_t nextSequence = 0;
+        size_t activeCount = 0;
+        float tickDuration = 1.0f / 60.0f;
+        float remainder = 0.0f;
+        std::vector<std::pair<uint32_t, uint32_t>> firedScratch;   // Index and generation of the timers due this step
+    };
+
+    extern TimingWheel GlobalTimingWheel;   // Global instance of the TimingWheel, stepped by the FrameScheduler
+    extern TimingWheel GlobalUITimingWheel; // Real time wheel for UI timers (button cooldowns), also advanced while paused
+}
+#endif // !_TIMING_WHEEL_H_
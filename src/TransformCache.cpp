@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TransformCache.cpp
+/// @Brief : Implements tracking, change detection and rebuilding of cached
+///          entity transforms.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "TransformCache.h"
+#include "ComponentList.h"
+#include "Metrics.h"
+#include <cmath>
+
+extern Framework::Coordinator ecsInterface;
+
+namespace Framework
+{
+    TransformCache GlobalTransformCache;
+
+    namespace
+    {
+        // Same result as calculate2DTransform: translate, then rotate about z, then scale
+        glm::mat4 BuildModel(glm::vec2 position, float rotationDegrees, glm::vec2 scale)
+        {
+            const float radians = rotationDegrees * 3.14159265358979323846f / 180.0f;
+            const float c = std::cos(radians);
+            const float s = std::sin(radians);
+
+            glm::mat4 model(1.0f);
+            model[0][0] = c * scale.x;
+            model[0][1] = s * scale.x;
+            model[1][0] = -s * scale.y;
+            model[1][1] = c * scale.y;
+            model[3][0] = position.x;
+            model[3][1] = position.y;
+            return model;
+        }
+    }
+
+    void TransformCache::Track(Entity entity)
+    {
+        if (!ecsInterface.HasComponent<TransformComponent>(entity))
+        {
+            return;
+        }
+
+        Source source;
+        source.isStatic = !ecsInterface.HasComponent<MovementComponent>(entity) && ecsInterface.HasComponent<LayerComponent>(entity)
+            && ecsInterface.GetComponent<LayerComponent>(entity).layerID == Layer::Background;
+
+        // Tracking again, e.g. a recycled entity ID, starts over from the current components
+        auto it = indices.find(entity);
+        if (it != indices.end())
+        {
+            sources[it->second] = source;
+            return;
+        }
+
+        indices.emplace(entity, static_cast<uint32_t>(entities.size()));
+        entities.push_back(entity);
+        transforms.emplace_back();
+        sources.push_back(source);
+    }
+
+    void TransformCache::TrackAll()
+    {
+        for (Entity entity : ecsInterface.GetEntities())
+        {
+            Track(entity);
+        }
+    }
+
+    void TransformCache::Untrack(Entity entity)
+    {
+        auto it = indices.find(entity);
+        if (it != indices.end())
+        {
+            Remove(it->second);
+        }
+    }
+
+    void TransformCache::Remove(size_t index)
+    {
+        // Swap with the last entry to keep the arrays dense
+        indices.erase(entities[index]);
+        const size_t last = entities.size() - 1;
+        if (index != last)
+        {
+            entities[index] = entities[last];
+            transforms[index] = transforms[last];
+            sources[index] = sources[last];
+            indices[entities[index]] = static_cast<uint32_t>(index);
+        }
+        entities.pop_back();
+        transforms.pop_back();
+        sources.pop_back();
+    }
+
+    void TransformCache::Clear()
+    {
+        entities.clear();
+        transforms.clear();
+        sources.clear();
+        indices.clear();
+        changed.clear();
+        removed.clear();
+    }
+
+    void TransformCache::ClearChanges()
+    {
+        for (Entity entity : changed)
+        {
+            auto it = indices.find(entity);
+            if (it != indices.end())
+            {
+                sources[it->second].reported = false;
+            }
+        }
+        changed.clear();
+        removed.clear();
+    }
+
+    void TransformCache::MarkDirty(Entity entity)
+    {
+        auto it = indices.find(entity);
+        if (it != indices.end())
+        {
+            sources[it->second].dirty = true;
+        }
+    }
+
+    void TransformCache::MarkAllDirty()
+    {
+        for (Source& source : sources)
+        {
+            source.dirty = true;
+        }
+    }
+
+    void TransformCache::SetStatic(Entity entity, bool isStatic)
+    {
+        auto it = indices.find(entity);
+        if (it != indices.end())
+        {
+            sources[it->second].isStatic = isStatic;
+            sources[it->second].dirty = true;
+        }
+    }
+
+    void TransformCache::Refresh(const ViewportMapping& mapping)
+    {
+        if (!(mapping == currentMapping))
+        {
+            currentMapping = mapping;
+            MarkAllDirty();
+        }
+
+        const glm::vec2 ratio = mapping.viewportSize / mapping.projectionSize;
+        const size_t staticPhase = refreshCount++ % StaticCheckInterval;
+        size_t rebuilt = 0;
+
+        for (size_t i = 0; i < entities.size();)
+        {
+            Source& source = sources[i];
+            if (source.isStatic && !source.dirty && i % StaticCheckInterval != staticPhase)
+            {
+                ++i;
+                continue;
+            }
+
+            if (!ecsInterface.HasComponent<TransformComponent>(entities[i]))
+            {
+                removed.push_back(entities[i]);
+                Remove(i);  // Destroyed, or its transform was removed; the swapped-in entry is visited next
+                continue;
+            }
+
+            const TransformComponent& transform = ecsInterface.GetComponent<TransformComponent>(entities[i]);
+            if (source.dirty || transform.position != source.position || transform.scale != source.scale || transform.rotation != source.rotation)
+            {
+                source.position = transform.position;
+                source.scale = transform.scale;
+                source.rotation = transform.rotation;
+                source.dirty = false;
+                if (!source.reported)
+                {
+                    source.reported = true;
+                    changed.push_back(entities[i]);
+                }
+
+                CachedTransform& cached = transforms[i];
+                const glm::vec2 viewportPosition = transform.position * ratio + mapping.viewportOffset;
+                const glm::vec2 viewportScale = transform.scale * ratio;
+                cached.viewportRect = glm::vec4(viewportPosition, viewportScale);
+                cached.rotation = transform.rotation;
+                cached.model = BuildModel(viewportPosition, transform.rotation, viewportScale);
+                ++rebuilt;
+            }
+            ++i;
+        }
+
+        lastRebuildCount = rebuilt;
+        static Gauge& rebuildGauge = GlobalMetrics.GetGauge("ue_transforms_rebuilt", "Cached transforms rebuilt last frame");
+        rebuildGauge.Set(static_cast<double>(rebuilt));
+    }
+
+    const CachedTransform* TransformCache::Find(Entity entity) const
+    {
+        auto it = indices.find(entity);
+        return it == indices.end() ? nullptr : &transforms[it->second];
+    }
+}
@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : TransformCache.h
+/// @Brief : Declares TransformCache, which keeps the model matrix and the
+///          viewport-space rectangle of every tracked entity in contiguous
+///          arrays and rebuilds them only for entities whose
+///          TransformComponent changed. Writers that know they moved an
+///          entity (undo/redo, the editor, pools) mark it dirty. Other
+///          entities are checked by comparing their position, rotation and
+///          scale with the values the matrix was built from, which is much
+///          cheaper than rebuilding it. Static entities (backgrounds) skip
+///          even that check and are only rebuilt when marked dirty.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _TRANSFORM_CACHE_H_
+#define _TRANSFORM_CACHE_H_
+#include "pch.h"
+#include "Coordinator.h"
+#include <glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @brief Cached results for one entity, laid out for direct upload by the renderers.
+     */
+    struct CachedTransform
+    {
+        glm::mat4 model{ 1.0f };                            // translate * rotate * scale, in viewport space
+        glm::vec4 viewportRect{ 0.0f, 0.0f, 0.0f, 0.0f };  // Viewport position xy, viewport size zw
+        float rotation = 0.0f;                              // Degrees, as stored in TransformComponent
+    };
+
+    /**
+     * @brief How world (projection) coordinates map to the viewport, as the renderers do
+     *        for every object.
+     */
+    struct ViewportMapping
+    {
+        glm::vec2 projectionSize{ 1.0f, 1.0f };
+        glm::vec2 viewportSize{ 1.0f, 1.0f };
+        glm::vec2 viewportOffset{ 0.0f, 0.0f };
+
+        bool operator==(const ViewportMapping& other) const
+        {
+            return projectionSize == other.projectionSize && viewportSize == other.viewportSize && viewportOffset == other.viewportOffset;
+        }
+    };
+
+    /**
+     * @class TransformCache
+     * @brief Dense cache of entity transforms. Index i of GetEntities() and GetTransforms()
+     *        describe the same entity.
+     */
+    class TransformCache
+    {
+    public:
+        static constexpr size_t StaticCheckInterval = 8;   // Refreshes between two checks of a static entity
+
+        /**
+         * @brief Starts caching an entity's transform, or re-reads it if already tracked.
+         *        Entities on the background layer with no MovementComponent are tracked as static.
+         */
+        void Track(Entity entity);
+
+        /**
+         * @brief Tracks every entity that has a TransformComponent, e.g. after a scene load.
+         */
+        void TrackAll();
+
+        void Untrack(Entity entity);
+
+        /**
+         * @brief Forgets every entity. Called when the scene's entities are cleared.
+         */
+        void Clear();
+
+        /**
+         * @brief Forces a rebuild of the entity's transform at the next Refresh().
+         */
+        void MarkDirty(Entity entity);
+
+        void MarkAllDirty();
+
+        /**
+         * @brief Static entities are compared against their TransformComponent only every
+         *        StaticCheckInterval refreshes (a rotating share of them each call), so writes
+         *        that skip MarkDirty still show up a few frames late. Marking them dirty
+         *        rebuilds them at the next Refresh().
+         */
+        void SetStatic(Entity entity, bool isStatic);
+
+        /**
+         * @brief Rebuilds the transforms that changed since the last call. A new viewport
+         *        mapping (window resize) rebuilds everything. Entities that lost their
+         *        TransformComponent are dropped.
+         */
+        void Refresh(const ViewportMapping& mapping);
+
+        /**
+         * @brief Entities whose transform was rebuilt, and entities dropped because they lost
+         *        their TransformComponent, by every Refresh() since the last ClearChanges().
+         *        Lets other caches (the collision broad phase) update only what moved.
+         */
+        const std::vector<Entity>& GetChangedEntities() const { return changed; }
+        const std::vector<Entity>& GetRemovedEntities() const { return removed; }
+        void ClearChanges();
+
+        /**
+         * @brief Cached transform of an entity, nullptr if it is not tracked.
+         */
+        const CachedTransform* Find(Entity entity) const;
+
+        bool IsTracked(Entity entity) const { return indices.count(entity) != 0; }
+        const std::vector<Entity>& GetEntities() const { return entities; }
+        const std::vector<CachedTransform>& GetTransforms() const { return transforms; }
+        size_t GetRebuildCount() const { return lastRebuildCount; }   // Transforms rebuilt by the last Refresh()
+
+    private:
+        // Values the cached transform was built from
+        struct Source
+        {
+            glm::vec2 position{ 0.0f, 0.0f };
+            glm::vec2 scale{ 0.0f, 0.0f };
+            float rotation = 0.0f;
+            bool dirty = true;
+            bool isStatic = false;
+            bool reported = false;  // Already in the changed list
+        };
+
+        void Remove(size_t index);
+
+        std::vector<Entity> entities;
+        std::vector<CachedTransform> transforms;
+        std::vector<Source> sources;
+        std::unordered_map<Entity, uint32_t> indices;
+        std::vector<Entity> changed;
+        std::vector<Entity> removed;
+        ViewportMapping currentMapping;
+        size_t lastRebuildCount = 0;
+        size_t refreshCount = 0;                // Picks the share of static entities checked this call
+    };
+
+    extern TransformCache GlobalTransformCache;     // Global instance of the TransformCache
+}
+#endif // !_TRANSFORM_CACHE_H_
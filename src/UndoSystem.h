@@ -22,8 +22,10 @@
 #include "pch.h"
 #include "ComponentList.h"
 #include <functional>
+#include <type_traits>
 #include <Coordinator.h>
 #include <imgui.h>
+#include "TransformCache.h"
 
 extern Framework::Coordinator ecsInterface;
 
@@ -60,11 +62,13 @@ namespace Framework
         void Undo() override
         {
             mVar = mPrevValue; // Only change the specific variable
+            MarkTransformDirty();
         }
 
         void Redo() override
         {
             mVar = mNewValue; // Only change the specific variable
+            MarkTransformDirty();
         }
 
         void Print() const override
@@ -83,6 +87,15 @@ namespace Framework
         T mPrevValue;                   // Prev value before the change
         T mNewValue;                    // New value after the change
 
+        // Static entities only pick up transform changes that are reported
+        void MarkTransformDirty() const
+        {
+            if (mComponentName == "TransformComponent")
+            {
+                GlobalTransformCache.MarkDirty(mEntity);
+            }
+        }
+
         // Convert value to string
         template <typename U>
         std::string ValueToString(U value) const
@@ -126,6 +139,10 @@ namespace Framework
         void Undo() override
         {
             ecsInterface.AddComponent<T>(mEntity, mRemovedComponent); // Restore the exact component
+            if constexpr (std::is_same_v<T, TransformComponent>)
+            {
+                GlobalTransformCache.Track(mEntity);    // Cache it again, the removal dropped it
+            }
         }
 
         void Redo() override
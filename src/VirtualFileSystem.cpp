@@ -0,0 +1,915 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : VirtualFileSystem.cpp
+/// @Brief : Implements mounts, the path index and the .uepak archive. An
+///          archive is a fixed header, an entry table, a names blob and the
+///          file contents, each 8 byte aligned:
+///            header  : magic, version, entry count, section offsets
+///            entries : data offset, size, name offset, name length
+///            names   : relative paths with forward slashes, not terminated
+///          Like the lexicon pack it is stored in native byte order and is
+///          mapped, never read into memory as a whole.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#include "pch.h"
+#include "VirtualFileSystem.h"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+
+namespace Framework
+{
+    namespace
+    {
+        constexpr uint32_t ArchiveMagic = 0x4B504555;  // "UEPK"
+        constexpr uint32_t ArchiveVersion = 1;
+
+        struct ArchiveHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint64_t entryCount;
+            uint64_t entryOffset;
+            uint64_t namesOffset;
+            uint64_t namesSize;
+        };
+
+        struct ArchiveEntry
+        {
+            uint64_t dataOffset;
+            uint64_t dataSize;
+            uint32_t nameOffset;
+            uint32_t nameLength;
+        };
+
+        uint64_t AlignUp(uint64_t offset)
+        {
+            return (offset + 7) & ~static_cast<uint64_t>(7);
+        }
+
+        void WritePadding(std::ofstream& out, uint64_t& written)
+        {
+            static const char zeros[8] = {};
+            const uint64_t aligned = AlignUp(written);
+            out.write(zeros, static_cast<std::streamsize>(aligned - written));
+            written = aligned;
+        }
+
+        template <typename Buffer>
+        bool ReadDiskFile(const std::string& path, Buffer& contents)
+        {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file.is_open())
+            {
+                return false;
+            }
+            const std::streamoff size = file.tellg();
+            if (size < 0)
+            {
+                return false;
+            }
+            contents.resize(static_cast<size_t>(size));
+            file.seekg(0);
+            file.read(reinterpret_cast<char*>(contents.data()), static_cast<std::streamsize>(size));
+            return static_cast<bool>(file) || size == 0;
+        }
+
+        std::string ParentOf(const std::string& key)
+        {
+            const size_t slash = key.rfind('/');
+            return slash == std::string::npos ? std::string() : key.substr(0, slash);
+        }
+
+        bool EndsWithNoCase(std::string_view text, std::string_view suffix)
+        {
+            if (suffix.size() > text.size())
+            {
+                return false;
+            }
+            const std::string_view tail = text.substr(text.size() - suffix.size());
+            return std::equal(tail.begin(), tail.end(), suffix.begin(), [](char a, char b)
+            {
+                return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+            });
+        }
+    }
+
+    /*****************************************************************************/
+    //   Paths                                                                    //
+    /*****************************************************************************/
+
+    std::string VirtualFileSystem::Normalize(std::string_view path)
+    {
+        std::string result;
+        std::vector<std::string_view> parts;
+        const bool absolute = !path.empty() && (path.front() == '/' || path.front() == '\\');
+
+        size_t start = 0;
+        while (start <= path.size())
+        {
+            size_t end = path.find_first_of("/\\", start);
+            if (end == std::string_view::npos)
+            {
+                end = path.size();
+            }
+            const std::string_view part = path.substr(start, end - start);
+            if (part == "..")
+            {
+                if (!parts.empty() && parts.back() != "..")
+                {
+                    parts.pop_back();
+                }
+                else if (!absolute)
+                {
+                    parts.push_back(part);
+                }
+            }
+            else if (!part.empty() && part != ".")
+            {
+                parts.push_back(part);
+            }
+            start = end + 1;
+        }
+
+        if (absolute)
+        {
+            result.push_back('/');
+        }
+        for (size_t i = 0; i < parts.size(); ++i)
+        {
+            if (i > 0)
+            {
+                result.push_back('/');
+            }
+            result.append(parts[i]);
+        }
+        return result;
+    }
+
+    std::string VirtualFileSystem::Join(std::string_view directory, std::string_view name)
+    {
+        std::string joined(directory);
+        if (!joined.empty() && !name.empty())
+        {
+            joined.push_back('/');
+        }
+        joined.append(name);
+        return Normalize(joined);
+    }
+
+    std::string VirtualFileSystem::FoldKey(std::string_view normalizedPath)
+    {
+        // Windows paths are case-insensitive, so are lookups
+        std::string key(normalizedPath);
+        for (char& c : key)
+        {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+        return key;
+    }
+
+    bool VirtualFileSystem::IsUnder(std::string_view path, std::string_view root)
+    {
+        if (root.empty())
+        {
+            return path.empty() || path.front() != '/';     // An empty root only covers relative paths
+        }
+        return path.size() >= root.size()
+            && EndsWithNoCase(path.substr(0, root.size()), root)
+            && (path.size() == root.size() || path[root.size()] == '/');
+    }
+
+    VirtualFileSystem::PathId VirtualFileSystem::Intern(std::string_view path)
+    {
+        std::unique_lock lock(mutex);
+        return InternLocked(FoldKey(Normalize(path)));
+    }
+
+    const std::string& VirtualFileSystem::GetPath(PathId id) const
+    {
+        static const std::string empty;
+        std::shared_lock lock(mutex);
+        return id < paths.size() ? paths[id] : empty;
+    }
+
+    size_t VirtualFileSystem::GetMountCount() const
+    {
+        std::shared_lock lock(mutex);
+        return mounts.size();
+    }
+
+    VirtualFileSystem::PathId VirtualFileSystem::InternLocked(const std::string& key)
+    {
+        auto [it, inserted] = pathIds.try_emplace(key, static_cast<PathId>(paths.size()));
+        if (inserted)
+        {
+            paths.push_back(key);
+        }
+        return it->second;
+    }
+
+    VirtualFileSystem::PathId VirtualFileSystem::FindLocked(std::string_view path) const
+    {
+        auto it = pathIds.find(FoldKey(Normalize(path)));
+        return it != pathIds.end() ? it->second : InvalidPath;
+    }
+
+    const VirtualFileSystem::Mount* VirtualFileSystem::OwnerLocked(const std::string& normalizedPath) const
+    {
+        for (auto it = mounts.rbegin(); it != mounts.rend(); ++it)
+        {
+            if (IsUnder(normalizedPath, (*it)->virtualRoot))
+            {
+                return it->get();
+            }
+        }
+        return nullptr;
+    }
+
+    const VirtualFileSystem::MountEntry* VirtualFileSystem::ResolveLocked(std::string_view path, const Mount** mount) const
+    {
+        const PathId id = FindLocked(path);
+        auto it = index.find(id);
+        if (it == index.end())
+        {
+            return nullptr;
+        }
+        const Mount& owner = *mounts[it->second.mount];
+        if (mount)
+        {
+            *mount = &owner;
+        }
+        return &owner.entries[it->second.entry];
+    }
+
+    /*****************************************************************************/
+    //   Mounts                                                                   //
+    /*****************************************************************************/
+
+    bool VirtualFileSystem::MountDirectory(const std::string& virtualRoot, const std::string& directory, int priority, bool writable)
+    {
+        std::error_code error;
+        if (!std::filesystem::is_directory(directory, error))
+        {
+            std::cerr << "Error: Cannot mount " << directory << ", not a directory" << std::endl;
+            return false;
+        }
+
+        auto mount = std::make_unique<Mount>();
+        mount->virtualRoot = Normalize(virtualRoot);
+        mount->source = Normalize(directory);
+        mount->priority = priority;
+        mount->writable = writable;
+
+        std::unique_lock lock(mutex);
+        ScanDirectory(*mount);
+        const size_t fileCount = mount->entries.size();
+
+        // Among equal priorities the mount added last wins
+        auto position = std::upper_bound(mounts.begin(), mounts.end(), priority,
+            [](int value, const std::unique_ptr<Mount>& other) { return value < other->priority; });
+        mounts.insert(position, std::move(mount));
+        RebuildIndex();
+
+        std::cout << "Mounted " << directory << " at " << (virtualRoot.empty() ? "/" : virtualRoot)
+            << " (" << fileCount << " files, priority " << priority << ")" << std::endl;
+        return true;
+    }
+
+    bool VirtualFileSystem::MountArchive(const std::string& virtualRoot, const std::string& archivePath, int priority)
+    {
+        auto mount = std::make_unique<Mount>();
+        mount->virtualRoot = Normalize(virtualRoot);
+        mount->source = Normalize(archivePath);
+        mount->priority = priority;
+        mount->archive = std::make_unique<MappedFile>();
+        if (!mount->archive->Open(archivePath))
+        {
+            std::cerr << "Error: Cannot mount archive " << archivePath << std::endl;
+            return false;
+        }
+
+        const uint8_t* base = mount->archive->Data();
+        const size_t fileSize = mount->archive->Size();
+        ArchiveHeader header{};
+        if (fileSize < sizeof(header))
+        {
+            std::cerr << "Error: Archive is truncated: " << archivePath << std::endl;
+            return false;
+        }
+        std::copy_n(base, sizeof(header), reinterpret_cast<uint8_t*>(&header));
+        if (header.magic != ArchiveMagic || header.version != ArchiveVersion
+            || header.entryOffset > fileSize || header.entryCount > (fileSize - header.entryOffset) / sizeof(ArchiveEntry)
+            || header.namesOffset > fileSize || header.namesSize > fileSize - header.namesOffset)
+        {
+            std::cerr << "Error: Archive is invalid or from another version: " << archivePath << std::endl;
+            return false;
+        }
+
+        const char* names = reinterpret_cast<const char*>(base + header.namesOffset);
+        std::unique_lock lock(mutex);
+        mount->entries.reserve(static_cast<size_t>(header.entryCount));
+        for (uint64_t i = 0; i < header.entryCount; ++i)
+        {
+            ArchiveEntry stored{};
+            std::copy_n(base + header.entryOffset + i * sizeof(ArchiveEntry), sizeof(stored), reinterpret_cast<uint8_t*>(&stored));
+            if (stored.dataOffset > fileSize || stored.dataSize > fileSize - stored.dataOffset
+                || stored.nameOffset > header.namesSize || stored.nameLength > header.namesSize - stored.nameOffset)
+            {
+                std::cerr << "Error: Archive entry " << i << " is out of bounds: " << archivePath << std::endl;
+                return false;
+            }
+
+            // Names stay below the mount point: no "..", no absolute paths, nothing that collapses to the root
+            MountEntry entry;
+            entry.relative = Normalize(std::string_view(names + stored.nameOffset, stored.nameLength));
+            if (entry.relative.empty() || entry.relative.front() == '/' || entry.relative == ".."
+                || entry.relative.compare(0, 3, "../") == 0)
+            {
+                std::cerr << "Error: Archive entry " << i << " has an invalid name (" << entry.relative << "): " << archivePath << std::endl;
+                return false;
+            }
+            entry.virtualPath = Join(mount->virtualRoot, entry.relative);
+            entry.id = InternLocked(FoldKey(entry.virtualPath));
+            entry.size = stored.dataSize;
+            entry.offset = stored.dataOffset;
+            AddEntry(*mount, std::move(entry));
+        }
+        const size_t fileCount = mount->entries.size();
+
+        auto position = std::upper_bound(mounts.begin(), mounts.end(), priority,
+            [](int value, const std::unique_ptr<Mount>& other) { return value < other->priority; });
+        mounts.insert(position, std::move(mount));
+        RebuildIndex();
+
+        std::cout << "Mounted archive " << archivePath << " at " << (virtualRoot.empty() ? "/" : virtualRoot)
+            << " (" << fileCount << " files, priority " << priority << ")" << std::endl;
+        return true;
+    }
+
+    void VirtualFileSystem::Unmount(const std::string& source)
+    {
+        const std::string key = FoldKey(Normalize(source));
+        std::unique_lock lock(mutex);
+        mounts.erase(std::remove_if(mounts.begin(), mounts.end(),
+            [&key](const std::unique_ptr<Mount>& mount) { return FoldKey(mount->source) == key; }), mounts.end());
+        RebuildIndex();
+    }
+
+    void VirtualFileSystem::UnmountAll()
+    {
+        std::unique_lock lock(mutex);
+        mounts.clear();
+        index.clear();
+        directories.clear();
+    }
+
+    void VirtualFileSystem::MountDefaults()
+    {
+        std::error_code error;
+        if (std::filesystem::is_regular_file("Assets.uepak", error))
+        {
+            MountArchive("Assets", "Assets.uepak", 0);
+        }
+        if (std::filesystem::is_directory("Assets", error))
+        {
+            MountDirectory("Assets", "Assets", 10, true);
+        }
+        if (std::filesystem::is_directory("Mods", error))
+        {
+            MountDirectory("Assets", "Mods", 100);
+        }
+    }
+
+    void VirtualFileSystem::ScanDirectory(Mount& mount)
+    {
+        std::error_code error;
+        const std::filesystem::path root(mount.source);
+        for (auto it = std::filesystem::recursive_directory_iterator(root, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+        {
+            std::error_code fileError;
+            if (!it->is_regular_file(fileError))
+            {
+                continue;
+            }
+            MountEntry entry;
+            entry.relative = it->path().lexically_relative(root).generic_string();
+            entry.virtualPath = Join(mount.virtualRoot, entry.relative);
+            entry.id = InternLocked(FoldKey(entry.virtualPath));
+            entry.size = it->file_size(fileError);
+            AddEntry(mount, std::move(entry));
+        }
+    }
+
+    bool VirtualFileSystem::AddEntry(Mount& mount, MountEntry entry)
+    {
+        auto [it, inserted] = mount.entryIndex.try_emplace(entry.id, static_cast<uint32_t>(mount.entries.size()));
+        if (inserted)
+        {
+            mount.entries.push_back(std::move(entry));
+        }
+        else
+        {
+            mount.entries[it->second] = std::move(entry);
+        }
+        return inserted;
+    }
+
+    bool VirtualFileSystem::RemoveEntry(Mount& mount, PathId id)
+    {
+        auto it = mount.entryIndex.find(id);
+        if (it == mount.entryIndex.end())
+        {
+            return false;
+        }
+
+        // Swap with the last entry, which changes that entry's slot too
+        const uint32_t slot = it->second;
+        mount.entryIndex.erase(it);
+        if (slot + 1 != mount.entries.size())
+        {
+            mount.entries[slot] = std::move(mount.entries.back());
+            mount.entryIndex[mount.entries[slot].id] = slot;
+        }
+        mount.entries.pop_back();
+        if (slot < mount.entries.size())
+        {
+            ResolveId(mount.entries[slot].id);
+        }
+        ResolveId(id);
+        return true;
+    }
+
+    void VirtualFileSystem::ResolveId(PathId id)
+    {
+        for (size_t m = mounts.size(); m-- > 0;)
+        {
+            auto it = mounts[m]->entryIndex.find(id);
+            if (it != mounts[m]->entryIndex.end())
+            {
+                const bool added = index.find(id) == index.end();
+                index[id] = { static_cast<uint32_t>(m), it->second };
+                if (added)
+                {
+                    directories[InternLocked(ParentOf(paths[id]))].push_back(id);
+                }
+                return;
+            }
+        }
+
+        if (index.erase(id) > 0)
+        {
+            std::vector<PathId>& siblings = directories[InternLocked(ParentOf(paths[id]))];
+            siblings.erase(std::remove(siblings.begin(), siblings.end(), id), siblings.end());
+        }
+    }
+
+    void VirtualFileSystem::RebuildIndex()
+    {
+        // Ascending priority, so higher mounts overwrite what lower ones provide
+        index.clear();
+        directories.clear();
+        for (size_t m = 0; m < mounts.size(); ++m)
+        {
+            const std::vector<MountEntry>& entries = mounts[m]->entries;
+            for (size_t e = 0; e < entries.size(); ++e)
+            {
+                index[entries[e].id] = { static_cast<uint32_t>(m), static_cast<uint32_t>(e) };
+            }
+        }
+        for (const auto& [id, resolved] : index)
+        {
+            directories[InternLocked(ParentOf(paths[id]))].push_back(id);
+        }
+    }
+
+    /*****************************************************************************/
+    //   Queries                                                                  //
+    /*****************************************************************************/
+
+    bool VirtualFileSystem::Exists(std::string_view path) const
+    {
+        std::shared_lock lock(mutex);
+        if (ResolveLocked(path, nullptr))
+        {
+            return true;
+        }
+        const std::string normalized = Normalize(path);
+        if (OwnerLocked(normalized))
+        {
+            return false;   // The index is complete under every mount
+        }
+        std::error_code error;
+        return std::filesystem::exists(normalized, error);
+    }
+
+    bool VirtualFileSystem::Stat(std::string_view path, FileInfo& info) const
+    {
+        std::shared_lock lock(mutex);
+        const Mount* mount = nullptr;
+        if (const MountEntry* entry = ResolveLocked(path, &mount))
+        {
+            info.size = entry->size;
+            info.archived = mount->archive != nullptr;
+            info.mountSource = mount->source;
+            return true;
+        }
+        const std::string normalized = Normalize(path);
+        if (OwnerLocked(normalized))
+        {
+            return false;
+        }
+
+        std::error_code error;
+        const uint64_t size = std::filesystem::file_size(normalized, error);
+        if (error)
+        {
+            return false;
+        }
+        info.size = size;
+        info.archived = false;
+        info.mountSource.clear();
+        return true;
+    }
+
+    bool VirtualFileSystem::ReadFile(std::string_view path, std::string& contents) const
+    {
+        std::shared_lock lock(mutex);
+        const Mount* mount = nullptr;
+        if (const MountEntry* entry = ResolveLocked(path, &mount))
+        {
+            if (mount->archive)
+            {
+                const char* data = reinterpret_cast<const char*>(mount->archive->Data() + entry->offset);
+                contents.assign(data, static_cast<size_t>(entry->size));
+                return true;
+            }
+            return ReadDiskFile(Join(mount->source, entry->relative), contents);
+        }
+        const std::string normalized = Normalize(path);
+        return !OwnerLocked(normalized) && ReadDiskFile(normalized, contents);
+    }
+
+    bool VirtualFileSystem::ReadFile(std::string_view path, std::vector<uint8_t>& contents) const
+    {
+        std::shared_lock lock(mutex);
+        const Mount* mount = nullptr;
+        if (const MountEntry* entry = ResolveLocked(path, &mount))
+        {
+            if (mount->archive)
+            {
+                const uint8_t* data = mount->archive->Data() + entry->offset;
+                contents.assign(data, data + entry->size);
+                return true;
+            }
+            return ReadDiskFile(Join(mount->source, entry->relative), contents);
+        }
+        const std::string normalized = Normalize(path);
+        return !OwnerLocked(normalized) && ReadDiskFile(normalized, contents);
+    }
+
+    std::string VirtualFileSystem::RealPath(std::string_view path) const
+    {
+        std::shared_lock lock(mutex);
+        const Mount* mount = nullptr;
+        if (const MountEntry* entry = ResolveLocked(path, &mount))
+        {
+            return mount->archive ? std::string() : Join(mount->source, entry->relative);
+        }
+        const std::string normalized = Normalize(path);
+        return OwnerLocked(normalized) ? std::string() : normalized;
+    }
+
+    std::vector<std::string> VirtualFileSystem::List(std::string_view directory, std::string_view extension) const
+    {
+        std::vector<std::string> files;
+        const std::string normalized = Normalize(directory);
+        {
+            std::shared_lock lock(mutex);
+            if (OwnerLocked(normalized) || (!normalized.empty() && std::any_of(mounts.begin(), mounts.end(),
+                [&normalized](const std::unique_ptr<Mount>& mount) { return IsUnder(mount->virtualRoot, normalized); })))
+            {
+                auto dir = directories.find(FindLocked(normalized));
+                if (dir != directories.end())
+                {
+                    for (PathId id : dir->second)
+                    {
+                        const Resolved& resolved = index.at(id);
+                        const std::string& virtualPath = mounts[resolved.mount]->entries[resolved.entry].virtualPath;
+                        if (extension.empty() || EndsWithNoCase(virtualPath, extension))
+                        {
+                            files.push_back(virtualPath);
+                        }
+                    }
+                }
+                std::sort(files.begin(), files.end());
+                return files;
+            }
+        }
+
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(normalized, error))
+        {
+            std::error_code fileError;
+            const std::string path = entry.path().generic_string();
+            if (entry.is_regular_file(fileError) && (extension.empty() || EndsWithNoCase(path, extension)))
+            {
+                files.push_back(path);
+            }
+        }
+        std::sort(files.begin(), files.end());
+        return files;
+    }
+
+    /*****************************************************************************/
+    //   Writes                                                                   //
+    /*****************************************************************************/
+
+    std::string VirtualFileSystem::WritePath(std::string_view path)
+    {
+        const std::string normalized = Normalize(path);
+        std::unique_lock lock(mutex);
+
+        Mount* target = nullptr;
+        for (auto it = mounts.rbegin(); it != mounts.rend(); ++it)
+        {
+            if ((*it)->writable && IsUnder(normalized, (*it)->virtualRoot))
+            {
+                target = it->get();
+                break;
+            }
+        }
+
+        std::error_code error;
+        if (!target)
+        {
+            if (OwnerLocked(normalized))
+            {
+                std::cerr << "Error: No writable mount for " << normalized << std::endl;
+                return "";
+            }
+            const std::filesystem::path parent = std::filesystem::path(normalized).parent_path();
+            if (!parent.empty())
+            {
+                std::filesystem::create_directories(parent, error);
+            }
+            return normalized;
+        }
+
+        MountEntry entry;
+        entry.relative = normalized.size() > target->virtualRoot.size() && !target->virtualRoot.empty()
+            ? normalized.substr(target->virtualRoot.size() + 1) : normalized;
+        entry.virtualPath = normalized;
+        entry.id = InternLocked(FoldKey(normalized));
+        const std::string realPath = Join(target->source, entry.relative);
+        entry.size = std::filesystem::file_size(realPath, error);
+        if (error)
+        {
+            entry.size = 0;
+        }
+
+        const std::filesystem::path parent = std::filesystem::path(realPath).parent_path();
+        if (!parent.empty())
+        {
+            std::filesystem::create_directories(parent, error);
+        }
+
+        const PathId id = entry.id;
+        AddEntry(*target, std::move(entry));
+        ResolveId(id);
+        return realPath;
+    }
+
+    bool VirtualFileSystem::WriteFile(std::string_view path, std::string_view contents)
+    {
+        const std::string realPath = WritePath(path);
+        if (realPath.empty())
+        {
+            return false;
+        }
+
+        {
+            std::ofstream out(realPath, std::ios::binary | std::ios::trunc);
+            out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+            if (!out)
+            {
+                std::cerr << "Error: Could not write " << realPath << std::endl;
+                return false;
+            }
+        }
+        Refresh(path);
+        return true;
+    }
+
+    std::string VirtualFileSystem::CopyIn(const std::string& sourceFile, std::string_view virtualDirectory)
+    {
+        const std::string fileName = std::filesystem::path(sourceFile).filename().string();
+        const std::string target = Join(virtualDirectory, fileName);
+        const std::string realPath = WritePath(target);
+        if (realPath.empty())
+        {
+            return "";
+        }
+
+        std::error_code error;
+        if (std::filesystem::equivalent(sourceFile, realPath, error))
+        {
+            return target;  // Already in place
+        }
+        if (!std::filesystem::copy_file(sourceFile, realPath, std::filesystem::copy_options::overwrite_existing, error))
+        {
+            std::cerr << "Error: Could not copy " << sourceFile << " to " << realPath << ": " << error.message() << std::endl;
+            Refresh(target);
+            return "";
+        }
+        Refresh(target);
+        return target;
+    }
+
+    bool VirtualFileSystem::Remove(std::string_view path)
+    {
+        const std::string normalized = Normalize(path);
+        std::unique_lock lock(mutex);
+        const Mount* owner = nullptr;
+        const MountEntry* entry = ResolveLocked(normalized, &owner);
+        std::error_code error;
+        if (!entry)
+        {
+            return !OwnerLocked(normalized) && std::filesystem::remove(normalized, error);
+        }
+        if (owner->archive)
+        {
+            std::cerr << "Error: " << normalized << " is inside archive " << owner->source << " and cannot be removed" << std::endl;
+            return false;
+        }
+
+        // A file of a lower mount may show through afterwards, as overlays intend
+        const bool removed = std::filesystem::remove(Join(owner->source, entry->relative), error);
+        const PathId id = entry->id;
+        for (auto& mount : mounts)
+        {
+            if (mount.get() == owner)
+            {
+                RemoveEntry(*mount, id);
+                break;
+            }
+        }
+        return removed;
+    }
+
+    void VirtualFileSystem::Refresh(std::string_view path)
+    {
+        const std::string normalized = Normalize(path);
+        std::unique_lock lock(mutex);
+        const PathId id = InternLocked(FoldKey(normalized));
+        for (auto& mount : mounts)
+        {
+            if (mount->archive || !IsUnder(normalized, mount->virtualRoot))
+            {
+                continue;
+            }
+
+            MountEntry entry;
+            entry.relative = mount->virtualRoot.empty() ? normalized : normalized.substr(std::min(normalized.size(), mount->virtualRoot.size() + 1));
+            const std::string realPath = Join(mount->source, entry.relative);
+            std::error_code error;
+            if (std::filesystem::is_regular_file(realPath, error))
+            {
+                entry.virtualPath = normalized;
+                entry.id = id;
+                entry.size = std::filesystem::file_size(realPath, error);
+                AddEntry(*mount, std::move(entry));
+            }
+            else
+            {
+                RemoveEntry(*mount, id);
+            }
+        }
+        ResolveId(id);
+    }
+
+    void VirtualFileSystem::Rescan()
+    {
+        std::unique_lock lock(mutex);
+        for (auto& mount : mounts)
+        {
+            if (!mount->archive)
+            {
+                mount->entries.clear();
+                mount->entryIndex.clear();
+                ScanDirectory(*mount);
+            }
+        }
+        RebuildIndex();
+    }
+
+    /*****************************************************************************/
+    //   Archives                                                                 //
+    /*****************************************************************************/
+
+    bool VirtualFileSystem::PackArchive(const std::string& directory, const std::string& archivePath)
+    {
+        struct Source
+        {
+            std::string path;
+            std::string name;
+            uint64_t size;
+        };
+
+        std::error_code error;
+        std::vector<Source> sources;
+        const std::filesystem::path root(directory);
+        for (auto it = std::filesystem::recursive_directory_iterator(root, error); !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error))
+        {
+            std::error_code fileError;
+            if (it->is_regular_file(fileError))
+            {
+                sources.push_back({ it->path().string(), it->path().lexically_relative(root).generic_string(), it->file_size(fileError) });
+            }
+        }
+        if (error)
+        {
+            std::cerr << "Error: Could not scan " << directory << ": " << error.message() << std::endl;
+            return false;
+        }
+        std::sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) { return a.name < b.name; });
+
+        // Every offset is known from the sizes, so contents are streamed straight to the file
+        ArchiveHeader header{};
+        header.magic = ArchiveMagic;
+        header.version = ArchiveVersion;
+        header.entryCount = sources.size();
+        header.entryOffset = AlignUp(sizeof(ArchiveHeader));
+        header.namesOffset = AlignUp(header.entryOffset + sources.size() * sizeof(ArchiveEntry));
+
+        std::string names;
+        std::vector<ArchiveEntry> entries(sources.size());
+        for (size_t i = 0; i < sources.size(); ++i)
+        {
+            entries[i].nameOffset = static_cast<uint32_t>(names.size());
+            entries[i].nameLength = static_cast<uint32_t>(sources[i].name.size());
+            names += sources[i].name;
+        }
+        header.namesSize = names.size();
+        uint64_t dataOffset = AlignUp(header.namesOffset + header.namesSize);
+        for (size_t i = 0; i < sources.size(); ++i)
+        {
+            entries[i].dataOffset = dataOffset;
+            entries[i].dataSize = sources[i].size;
+            dataOffset = AlignUp(dataOffset + sources[i].size);
+        }
+
+        const std::string tempPath = archivePath + ".tmp";
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            uint64_t written = 0;
+            out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            written += sizeof(header);
+            WritePadding(out, written);
+            out.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(ArchiveEntry)));
+            written += entries.size() * sizeof(ArchiveEntry);
+            WritePadding(out, written);
+            out.write(names.data(), static_cast<std::streamsize>(names.size()));
+            written += names.size();
+
+            std::vector<char> contents;
+            for (size_t i = 0; i < sources.size() && out; ++i)
+            {
+                WritePadding(out, written);
+                if (!ReadDiskFile(sources[i].path, contents) || contents.size() != sources[i].size)
+                {
+                    std::cerr << "Error: " << sources[i].path << " changed while packing" << std::endl;
+                    out.setstate(std::ios::failbit);
+                    break;
+                }
+                out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+                written += contents.size();
+            }
+            if (!out)
+            {
+                std::cerr << "Error: Could not write archive: " << tempPath << std::endl;
+                out.close();
+                std::filesystem::remove(tempPath, error);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tempPath, archivePath, error);
+        if (error)
+        {
+            std::cerr << "Error: Could not replace " << archivePath << " (" << error.message() << "), is it mounted?" << std::endl;
+            return false;
+        }
+
+        std::cout << "Archive packed: " << archivePath << " (" << sources.size() << " files, "
+            << dataOffset / 1024 << " KB)" << std::endl;
+        return true;
+    }
+}
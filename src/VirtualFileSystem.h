@@ -0,0 +1,193 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@File  : VirtualFileSystem.h
+/// @Brief : Declares VirtualFileSystem, the single I/O layer asset loaders
+///          read and write through. Virtual paths ("Assets/Images/a.png")
+///          are resolved against mounts, each a loose directory or a packed
+///          .uepak archive placed at a virtual root with a priority, so a
+///          mods folder mounted over Assets/ overrides shipped files without
+///          touching them. Every mount is indexed once when mounted; Exists,
+///          Stat and List are answered from the interned path index and
+///          never ask the operating system. Paths outside every mount go
+///          straight to the disk, so tools and absolute paths keep working.
+///
+///	@Main Author : Edwin Leow (100%)
+/// @Secondary Author : NIL
+///	@Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef _VIRTUAL_FILE_SYSTEM_H_
+#define _VIRTUAL_FILE_SYSTEM_H_
+#include "pch.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Framework
+{
+    /**
+     * @class VirtualFileSystem
+     * @brief Thread-safe: reads may come from worker threads while the main thread mounts
+     *        or writes.
+     */
+    class VirtualFileSystem
+    {
+    public:
+        using PathId = uint32_t;
+        static constexpr PathId InvalidPath = 0xFFFFFFFFu;
+
+        struct FileInfo
+        {
+            uint64_t size = 0;
+            bool archived = false;      // Lives in a packed archive, RealPath() is empty
+            std::string mountSource;    // Directory or archive the file resolves to
+        };
+
+        /**
+         * @brief Forward slashes, "." and "x/.." removed, no trailing slash. Windows and
+         *        hand-written paths ("Assets\\Images\\..") become the same key.
+         */
+        static std::string Normalize(std::string_view path);
+
+        static std::string Join(std::string_view directory, std::string_view name);
+
+        /**
+         * @brief Mounts a loose directory. Writes under the virtual root go to the writable
+         *        mount with the highest priority.
+         * @param priority Higher priorities override lower ones for the same virtual path.
+         */
+        bool MountDirectory(const std::string& virtualRoot, const std::string& directory, int priority, bool writable = false);
+
+        /**
+         * @brief Mounts a .uepak archive written by PackArchive. Read only.
+         */
+        bool MountArchive(const std::string& virtualRoot, const std::string& archivePath, int priority);
+
+        /**
+         * @brief Removes every mount of a directory or archive.
+         */
+        void Unmount(const std::string& source);
+
+        void UnmountAll();
+
+        /**
+         * @brief Standard layout: Assets.uepak (priority 0), loose Assets/ over it (10, writable)
+         *        and Mods/ over both (100). Missing sources are skipped.
+         */
+        void MountDefaults();
+
+        bool Exists(std::string_view path) const;
+        bool Stat(std::string_view path, FileInfo& info) const;
+
+        /**
+         * @brief Reads a whole file.
+         * @return False if the file does not exist or could not be read.
+         */
+        bool ReadFile(std::string_view path, std::string& contents) const;
+        bool ReadFile(std::string_view path, std::vector<uint8_t>& contents) const;
+
+        /**
+         * @brief Disk path of a file for libraries that open files themselves (FMOD, mapped
+         *        containers). Empty if the file only exists in an archive.
+         */
+        std::string RealPath(std::string_view path) const;
+
+        /**
+         * @brief Disk path a write to this virtual path should go to, with its directories
+         *        created. The index is updated as if the file had been written.
+         */
+        std::string WritePath(std::string_view path);
+
+        bool WriteFile(std::string_view path, std::string_view contents);
+
+        /**
+         * @brief Copies a file from anywhere on disk into a virtual directory.
+         * @return Virtual path of the copy, empty on failure.
+         */
+        std::string CopyIn(const std::string& sourceFile, std::string_view virtualDirectory);
+
+        bool Remove(std::string_view path);
+
+        /**
+         * @brief Re-reads one loose file after it changed outside the engine.
+         */
+        void Refresh(std::string_view path);
+
+        /**
+         * @brief Re-indexes every loose directory mount.
+         */
+        void Rescan();
+
+        /**
+         * @brief Files directly inside a virtual directory, optionally only with an extension
+         *        (".json"). Sorted.
+         */
+        std::vector<std::string> List(std::string_view directory, std::string_view extension = {}) const;
+
+        /**
+         * @brief Packs every file under a directory into one archive, paths relative to it.
+         */
+        static bool PackArchive(const std::string& directory, const std::string& archivePath);
+
+        PathId Intern(std::string_view path);
+        const std::string& GetPath(PathId id) const;
+        size_t GetMountCount() const;
+
+    private:
+        struct MountEntry
+        {
+            PathId id = InvalidPath;
+            std::string virtualPath;    // Original case, for listings
+            std::string relative;       // Below the mount source
+            uint64_t size = 0;
+            uint64_t offset = 0;        // Archive only
+        };
+
+        struct Mount
+        {
+            std::string virtualRoot;
+            std::string source;
+            int priority = 0;
+            bool writable = false;
+            std::unique_ptr<MappedFile> archive;    // Null for directories
+            std::vector<MountEntry> entries;
+            std::unordered_map<PathId, uint32_t> entryIndex;
+        };
+
+        struct Resolved
+        {
+            uint32_t mount = 0;
+            uint32_t entry = 0;
+        };
+
+        static std::string FoldKey(std::string_view normalizedPath);
+        static bool IsUnder(std::string_view path, std::string_view root);
+
+        PathId InternLocked(const std::string& key);
+        PathId FindLocked(std::string_view path) const;
+        const Mount* OwnerLocked(const std::string& normalizedPath) const;
+        const MountEntry* ResolveLocked(std::string_view path, const Mount** mount) const;
+        void ScanDirectory(Mount& mount);
+        bool AddEntry(Mount& mount, MountEntry entry);
+        bool RemoveEntry(Mount& mount, PathId id);
+        void ResolveId(PathId id);
+        void RebuildIndex();
+
+        mutable std::shared_mutex mutex;
+        std::vector<std::unique_ptr<Mount>> mounts;             // Sorted by ascending priority
+        std::unordered_map<std::string, PathId> pathIds;        // Folded virtual path -> id
+        std::deque<std::string> paths;                          // id -> folded virtual path, references stay valid
+        std::unordered_map<PathId, Resolved> index;             // Winning mount of every file
+        std::unordered_map<PathId, std::vector<PathId>> directories;
+    };
+
+    extern VirtualFileSystem GlobalVirtualFileSystem;   // Global instance of the VirtualFileSystem
+}
+#endif // !_VIRTUAL_FILE_SYSTEM_H_
@@ -15,6 +15,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "pch.h"
 #include "WindowAsset.h"
+#include "AssetManager.h"
+#include "SpriteBatcher.h"
+#include "TextureImport.h"
+#include "VirtualFileSystem.h"
 
 /**
  * @brief Constructs a Window object and loads window configuration from the specified file.
@@ -39,16 +43,15 @@ Window::~Window() {}
  */
 void Window::Deserialize(const std::string& filePath)
 {
-    std::ifstream file(filePath);
-    if (!file.is_open())
+    std::string contents;
+    if (!Framework::GlobalVirtualFileSystem.ReadFile(filePath, contents))
     {
         std::cerr << "Failed to open file: " << filePath << std::endl;
         return;
     }
 
-    rapidjson::IStreamWrapper isw(file);    // Wrap the input file stream
     rapidjson::Document document;           // Parse the JSON document
-    document.ParseStream(isw);
+    Framework::ParseJson(document, contents);
 
     // Check if the "windows" key exists and is an array
     if (document.HasMember("windows") && document["windows"].IsArray()) 
@@ -76,6 +79,30 @@ void Window::Deserialize(const std::string& filePath)
                 windowConfig.programName = windowObject["program_name"].GetString();
             }
 
+            if (windowObject.HasMember("batched_sprites") && windowObject["batched_sprites"].IsBool())
+            {
+                windowConfig.batchedSprites = windowObject["batched_sprites"].GetBool();
+            }
+            if (windowObject.HasMember("render_thread") && windowObject["render_thread"].IsBool())
+            {
+                windowConfig.renderThread = windowObject["render_thread"].GetBool();
+            }
+            Framework::GlobalSpriteBatcher.SetSceneRendering(windowConfig.batchedSprites);
+            // Only the batcher draws premultiplied sRGB textures; set before any texture is uploaded or compressed
+            Framework::GlobalTextureLayout.premultipliedAlpha = windowConfig.batchedSprites;
+            Framework::GlobalTextureLayout.srgb = windowConfig.batchedSprites;
+            Framework::GlobalSpriteBatcher.SetRenderThread(windowConfig.batchedSprites && windowConfig.renderThread);
+
+            if (windowObject.HasMember("compress_textures") && windowObject["compress_textures"].IsBool())
+            {
+                windowConfig.compressTextures = windowObject["compress_textures"].GetBool();
+            }
+            // Textures upload on first use, so containers built here are picked up by the first scene
+            if (windowConfig.compressTextures)
+            {
+                Framework::GlobalAssetManager.UE_CompressTextures();
+            }
+
             // Output or store window configuration
             //std::cout << "Window X: " << windowConfig.x << "\n";
             //std::cout << "Window Y: " << windowConfig.y << "\n";
@@ -51,11 +51,14 @@ public:
         int x;                      // Width of the window
         int y;                      // Height of the window
         std::string programName;    // Name of the program/Title
+        bool batchedSprites;        // Draw sprite entities with the SpriteBatcher
+        bool renderThread;          // Draw the batched sprites on the render thread
+        bool compressTextures;      // Compress stale textures at startup so they load from their containers
 
         /**
          * @brief Default constructor initializing WindowConfig with default values.
          */
-        WindowConfig() : x(0), y(0), programName("") {}
+        WindowConfig() : x(0), y(0), programName(""), batchedSprites(false), renderThread(false), compressTextures(false) {}
     };
 
     /**
@@ -18,17 +18,19 @@
  ******************************************************************************/
 #include "pch.h"
 #include "lexicon.h"
-#include <fstream>
 #include <iostream>
 #include <sstream>
 #include <algorithm>
 #include "AssetManager.h"
+#include "FileWatcher.h"
+#include "JsonSerialize.h"
+#include "Metrics.h"
+#include "VirtualFileSystem.h"
 
 namespace Framework {
 
     // Static singleton instance initialization
     std::unique_ptr<Framework::Lexicon> Framework::Lexicon::instance = nullptr;
-    const std::vector<std::string>& prefixes = GlobalAssetManager.GetPrefixAssets();
 
     std::string trim(const std::string& str) {
         // Find the first non-space character
@@ -66,8 +68,61 @@ namespace Framework {
             node = node->children[c];
         }
 
-        node->isEndOfWord = true;
-        words.insert(word); // 
+        if (!node->isEndOfWord) {
+            node->isEndOfWord = true;
+            ++wordCount;
+            wordListDirty = true;
+            wordIndexDirty = true;
+        }
+    }
+
+    void Trie::collectWords(const TrieNode* node, std::string& word, FrontCodedWordList::Builder& builder) {
+        if (node->isEndOfWord) {
+            builder.Add(word);
+        }
+
+        // Visit children in byte order so the words come out sorted
+        std::vector<char> keys;
+        keys.reserve(node->children.size());
+        for (const auto& pair : node->children) {
+            keys.push_back(pair.first);
+        }
+        std::sort(keys.begin(), keys.end(), [](char a, char b) {
+            return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+            });
+
+        for (char c : keys) {
+            word.push_back(c);
+            collectWords(node->children.at(c), word, builder);
+            word.pop_back();
+        }
+    }
+
+    const FrontCodedWordList& Trie::getAllWords() const {
+        if (wordListDirty) {
+            FrontCodedWordList::Builder builder;
+            std::string word;
+            collectWords(root, word, builder);
+            wordList = builder.Finish();
+            wordListDirty = false;
+        }
+        return wordList;
+    }
+
+    bool Trie::contains(const std::string& word) const {
+        if (wordIndexDirty) {
+            finalize();
+        }
+        return wordIndex.Contains(word);
+    }
+
+    void Trie::finalize() const {
+        if (wordIndexDirty) {
+            if (!wordIndex.Build(getAllWords())) {
+                std::cerr << "Error: Could not build the word index!" << std::endl;
+            }
+            wordIndexDirty = false;
+        }
     }
 
     void Trie::clear(TrieNode* node)
@@ -157,6 +212,20 @@ namespace Framework {
             instance = std::make_unique<Lexicon>(wordFilename, prefixFilename, nsfwFilename);
             std::cout << "System: Lexicon Initialized" << std::endl;
 
+            std::vector<std::string> available;
+            if (instance->LoadLocaleManifest())
+            {
+                available = instance->GetAvailableLocales();
+            }
+            if (!available.empty())
+            {
+                const bool hasEnglish = std::find(available.begin(), available.end(), "en") != available.end();
+                if (instance->SetLocale(hasEnglish ? "en" : available.front(), true))
+                {
+                    return;
+                }
+            }
+
             GlobalAssetManager.UE_LoadDictionary(wordFilename);
             GlobalAssetManager.UE_LoadPrefixes(prefixFilename);
             GlobalAssetManager.UE_LoadNSFW(nsfwFilename);
@@ -168,13 +237,193 @@ namespace Framework {
         std::cout << "Lexicon system initialized." << std::endl;
     }
 
-    // ISystem Update method (no real use in this case)
+    // ISystem Update method, swaps in a locale once its background load finished
     void Lexicon::Update(float deltaTime) {
         (void)deltaTime;  // Suppress unused parameter warning
-        // No periodic updates needed for the Lexicon system
+
+        if (pendingLocale.valid() && pendingLocale.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+        {
+            ApplyLocale(pendingLocale.get());
+            if (!queuedLocale.empty())
+            {
+                StartLocaleLoad(queuedLocale);
+                queuedLocale.clear();
+            }
+        }
+    }
+
+    /*******************/
+    //   Locales       //
+    /*******************/
+
+    bool Lexicon::LoadLocaleManifest(const std::string& manifestPath)
+    {
+        std::string contents;
+        if (!GlobalVirtualFileSystem.ReadFile(manifestPath, contents))
+        {
+            std::cerr << "Error: Could not open locale manifest: " << manifestPath << std::endl;
+            return false;
+        }
+
+        rapidjson::Document document;
+        ParseJson(document, contents);
+        if (document.HasParseError() || !document.HasMember("locales") || !document["locales"].IsArray())
+        {
+            std::cerr << "Error: Invalid locale manifest: " << manifestPath << std::endl;
+            return false;
+        }
+
+        for (const rapidjson::Value& entry : document["locales"].GetArray())
+        {
+            if (!entry.IsObject() || !entry.HasMember("code") || !entry.HasMember("dictionary") || !entry.HasMember("prefixes")
+                || !entry.HasMember("nsfw") || !entry.HasMember("pack"))
+            {
+                std::cerr << "Warning: Skipping incomplete locale entry in " << manifestPath << std::endl;
+                continue;
+            }
+
+            LocaleInfo info;
+            info.code = entry["code"].GetString();
+            info.sources.dictionary = entry["dictionary"].GetString();
+            info.sources.prefixes = entry["prefixes"].GetString();
+            info.sources.nsfw = entry["nsfw"].GetString();
+            info.packPath = entry["pack"].GetString();
+            locales[info.code] = std::move(info);
+        }
+        return !locales.empty();
+    }
+
+    std::vector<std::string> Lexicon::GetAvailableLocales() const
+    {
+        std::vector<std::string> codes;
+        for (const auto& [code, info] : locales)
+        {
+            codes.push_back(code);
+        }
+        std::sort(codes.begin(), codes.end());
+        return codes;
+    }
+
+    bool Lexicon::SetLocale(const std::string& code, bool wait)
+    {
+        if (locales.empty())
+        {
+            LoadLocaleManifest();
+        }
+        auto it = locales.find(code);
+        if (it == locales.end())
+        {
+            std::cerr << "Error: Unknown locale: " << code << std::endl;
+            return false;
+        }
+
+        if (wait)
+        {
+            if (pendingLocale.valid())
+            {
+                pendingLocale.wait();   // Let the older load finish first so it cannot overwrite this one
+                ApplyLocale(pendingLocale.get());
+            }
+            queuedLocale.clear();
+
+            std::unique_ptr<LoadedLocale> loaded = LoadLocale(it->second);
+            const bool loadedOk = loaded != nullptr;
+            ApplyLocale(std::move(loaded));
+            return loadedOk;
+        }
+
+        if (pendingLocale.valid())
+        {
+            queuedLocale = code;    // Replacing the future would block until the running load ends
+            return true;
+        }
+        StartLocaleLoad(code);
+        return true;
+    }
+
+    void Lexicon::ReloadLocale()
+    {
+        if (!locale.empty())
+        {
+            // Windows will not rename over a mapped file, so let go of it while the pack is rebuilt.
+            // Nothing else holds the words, so the rebuild cannot run in the background.
+            pack.reset();
+            if (!SetLocale(locale, true))
+            {
+                pack = LexiconPack::Open(locales.at(locale).packPath);
+            }
+        }
+    }
+
+    void Lexicon::StartLocaleLoad(const std::string& code)
+    {
+        const LocaleInfo info = locales.at(code);
+        pendingLocale = std::async(std::launch::async, [info]() { return LoadLocale(info); });
+    }
+
+    std::unique_ptr<Lexicon::LoadedLocale> Lexicon::LoadLocale(const LocaleInfo& info)
+    {
+        std::string packPath = info.packPath;
+        if (LexiconPack::IsStale(info.sources, packPath))
+        {
+            packPath = LexiconPack::Compile(info.sources, packPath);
+            if (packPath.empty())
+            {
+                return nullptr;
+            }
+        }
+
+        auto loaded = std::make_unique<LoadedLocale>();
+        loaded->pack = LexiconPack::Open(packPath);
+        if (!loaded->pack)
+        {
+            return nullptr;
+        }
+        loaded->code = info.code;
+        loaded->sources = info.sources;
+        loaded->anagrams.Build(loaded->pack->GetDictionary());
+        return loaded;
+    }
+
+    void Lexicon::ApplyLocale(std::unique_ptr<LoadedLocale> loaded)
+    {
+        if (!loaded)
+        {
+            std::cerr << "Error: Locale failed to load, keeping " << (locale.empty() ? "the current word lists" : locale) << std::endl;
+            return;
+        }
+
+        // The old pack is unmapped here, nothing else holds its views
+        pack = std::move(loaded->pack);
+        locale = loaded->code;
+        usingPack = true;
+
+        // AssetManager's lists now read the pack, so the word lists loaded from JSON are dropped
+        Trie emptyTrie;
+        Trie emptyNSFW;
+        GlobalAssetManager.UE_SetLexiconSources(loaded->sources.dictionary, loaded->sources.prefixes, loaded->sources.nsfw);
+        GlobalAssetManager.UE_ReplaceDictionary(emptyTrie, std::move(loaded->anagrams));
+        GlobalAssetManager.UE_ReplacePrefixes({});
+        GlobalAssetManager.UE_ReplaceNSFW(emptyNSFW);
+        GlobalFileWatcher.RebuildPathMap();
+
+        GlobalMetrics.GetGauge("ue_lexicon_mapped_bytes", "Size of the mapped lexicon pack").Set(static_cast<double>(pack->MappedSize()));
+        std::cout << "Locale " << locale << " active: " << pack->GetDictionary().size() << " words, "
+            << pack->MappedSize() / 1024 << " KB mapped." << std::endl;
+    }
+
+    const FrontCodedWordList& Lexicon::GetWords() const
+    {
+        return pack ? pack->GetDictionary() : trie.getAllWords();
+    }
+
+    const FrontCodedWordList& Lexicon::GetNSFWWords() const
+    {
+        return pack ? pack->GetNSFW() : nsfwTrie.getAllWords();
     }
 
     std::string Lexicon::getRandomPrefix() {
+        const FrontCodedWordList& prefixes = GlobalAssetManager.GetPrefixAssets();  // The pack's list when one is loaded
         if (prefixes.empty()) {
             std::cerr << "Error: No prefixes loaded!" << std::endl;
             return "";
@@ -184,40 +433,29 @@ namespace Framework {
     }
 
     bool Lexicon::CheckPrefixHasMinimumWords(const std::string& prefix, int MinAmount) {
-        const auto& wordSet = trie.getAllWords(); // Get reference to stored words
+        const auto& wordList = GetWords(); // Sorted list of stored words
 
-        if (wordSet.empty()) {
+        if (wordList.empty()) {
             std::cerr << "Error: No words available in the Trie!" << std::endl;
             return false;
         }
 
-        int count = 0;
-
-        // Efficient word count with early exit
-        for (const std::string& word : wordSet) {
-            if (word.find(prefix) == 0) { //  Efficient prefix check
-                count++;
-                if (count >= MinAmount) return true; //  Early exit when condition met
-            }
-        }
-
-        return false; //  Not enough words found
+        // Words sharing the prefix are contiguous, so counting them is two binary searches
+        return wordList.CountWithPrefix(prefix) >= static_cast<size_t>(std::max(MinAmount, 0));
     }
 
     std::string Lexicon::GeneratePrefixFromRandomWord(int length, bool Randomize) {
-        const auto& wordSet = trie.getAllWords();
+        const auto& wordList = GetWords();
 
-        if (wordSet.empty()) {
+        if (wordList.empty()) {
             std::cerr << "Error: No words available in the Trie!" << std::endl;
             return "";
         }
 
         std::string randomPrefix;
         do {
-            // **Random selection using iterator (O(1) instead of O(n))**
-            auto it = wordSet.begin();
-            std::advance(it, rand() % wordSet.size());
-            std::string randomWord = *it;
+            // Random access decodes a single bucket of the list
+            std::string randomWord = wordList[rand() % wordList.size()];
 
             if (randomWord.length() < 2) continue; // Ensure word is long enough
 
@@ -235,20 +473,19 @@ namespace Framework {
         std::string normalizedWord = trim(userWord); // Trim spaces
         std::transform(normalizedWord.begin(), normalizedWord.end(), normalizedWord.begin(), ::tolower);
 
-        if (trie.search(normalizedWord)) {
-           // std::cout << "Word found in Trie: " << normalizedWord << std::endl;
-            return true;
-        }
-        else {
-            //std::cout << "Word not found in Trie: " << normalizedWord << std::endl;
-            return false;
+        if (pack) {
+            return pack->ContainsWord(normalizedWord); // Same lookup, tables read from the mapped pack
         }
+        return trie.contains(normalizedWord); // Perfect hash lookup instead of a trie walk
     }
 
     bool Lexicon::isNsfwWord(const std::string& word) {
         std::string normalizedWord = trim(word); // Trim spaces
         std::transform(normalizedWord.begin(), normalizedWord.end(), normalizedWord.begin(), ::tolower); // Normalize to lowercase
-        return nsfwTrie.search(normalizedWord); // Search in NSFW Trie
+        if (pack) {
+            return pack->IsNSFW(normalizedWord);
+        }
+        return nsfwTrie.contains(normalizedWord); // Perfect hash lookup in the NSFW set
     }
 
     size_t Lexicon::countLetters(const std::string& word) {
@@ -11,6 +11,8 @@
  *   NSFW word lists.
  * * The system also provides utility functions for word validation, prefix checking,
  *   and random prefix generation.
+ * * Per-locale word lists are served from memory mapped lexicon packs; switching
+ *   locale loads the new pack in the background and swaps it in on Update.
  *
  * \author Keegan Lim, Dylan, Edwin
  * \copyright 2024, Digipen Institute of Technology
@@ -21,6 +23,13 @@
 #define LEXICON_H
 
 #include "System.h"  // Assuming System.h defines ISystem
+#include "FrontCodedWordList.h"
+#include "PerfectHashIndex.h"
+#include "AnagramIndex.h"
+#include "LexiconPack.h"
+#include <atomic>
+#include <future>
+#include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -52,14 +61,38 @@ namespace Framework
         bool search(const std::string& word);
         bool startsWith(const std::string& prefix);
 
-        // **Optimized retrieval: Return reference to word set (O(1) access)**
-        const std::unordered_set<std::string>& getAllWords() const { return words; }
+        // Exchange contents with another trie, used to swap in a trie built off the main thread
+        void swap(Trie& other) noexcept
+        {
+            std::swap(root, other.root);
+            std::swap(wordCount, other.wordCount);
+            std::swap(wordList, other.wordList);
+            std::swap(wordListDirty, other.wordListDirty);
+            std::swap(wordIndex, other.wordIndex);
+            std::swap(wordIndexDirty, other.wordIndexDirty);
+        }
+
+        // Sorted, front coded list of every word, rebuilt from the trie after inserts
+        const FrontCodedWordList& getAllWords() const;
+
+        // Exact membership through the perfect hash index, one hash and one fingerprint compare
+        bool contains(const std::string& word) const;
+
+        // Builds the word list and membership index now instead of on first use
+        void finalize() const;
+
+        size_t size() const { return wordCount; }
 
     private:
         TrieNode* root;
-        std::unordered_set<std::string> words; // **Use unordered_set instead of vector**
+        size_t wordCount = 0;
+        mutable FrontCodedWordList wordList;    // Words are only kept as trie paths, this is derived from them
+        mutable bool wordListDirty = false;
+        mutable PerfectHashIndex wordIndex;     // Built from the word list
+        mutable bool wordIndexDirty = false;
 
         void clear(TrieNode* node);
+        static void collectWords(const TrieNode* node, std::string& word, FrontCodedWordList::Builder& builder);
     };
 
 
@@ -76,7 +109,8 @@ namespace Framework
         // Static method to access the singleton instance of Lexicon
         static Lexicon* GetInstance();
 
-        // Initialize the singleton instance (only called once)
+        // Initialize the singleton instance (only called once). Loads the first locale of the
+        // locale manifest ("en" if listed), or the given word lists if there is none
         static void Initialize(const std::string& wordFilename, const std::string& prefixFilename, const std::string& nsfwFilename);
 
         // ISystem overrides
@@ -99,8 +133,45 @@ namespace Framework
 
         bool CheckPrefixHasMinimumWords(const std::string& prefix, int MinAmount);
 
+        /**
+         * @brief Reads the locale list (code plus dictionary, prefix, NSFW and pack paths).
+         *        Called on the first SetLocale if it was not called before.
+         */
+        bool LoadLocaleManifest(const std::string& manifestPath = "Assets/JsonData/LocaleAsset.json");
+
+        /**
+         * @brief Switches the word lists to another locale. The pack is compiled if needed and
+         *        mapped on a worker thread, then swapped in by Update; until then the current
+         *        locale stays in use.
+         * @param wait Load on the calling thread and swap in immediately (startup).
+         * @return False if the locale is unknown or, when waiting, failed to load.
+         */
+        bool SetLocale(const std::string& code, bool wait = false);
+
+        /**
+         * @brief Reloads the active locale, recompiling its pack if a source list changed.
+         *        The pack is unmapped first so it can be replaced, so this blocks until the
+         *        new one is mapped; the old pack is mapped again if that fails.
+         */
+        void ReloadLocale();
+
+        const std::string& GetLocale() const { return locale; }
+        bool IsLocaleLoading() const { return pendingLocale.valid(); }
+        bool UsesLocalePack() const { return usingPack; }   // Safe to call from worker threads
+        std::vector<std::string> GetAvailableLocales() const;
+
+        // Sorted dictionary of the active locale, or of the trie when no pack is loaded
+        const FrontCodedWordList& GetWords() const;
+
+        // Sorted NSFW list of the active locale, or of the NSFW trie when no pack is loaded
+        const FrontCodedWordList& GetNSFWWords() const;
+
+        // Active pack, nullptr while the word lists come from the tries. Main thread only.
+        const LexiconPack* GetPack() const { return pack.get(); }
+
         Trie& GetTrie() { return trie; }    // Read-Write Access
         Trie& GetNSFW() { return nsfwTrie; }
+        AnagramIndex& GetAnagramIndex() { return anagramIndex; }   // Bonus word modes: anagrams and sub-words
 
         Trie nsfwTrie;  // Trie to store NSFW words
 
@@ -111,7 +182,35 @@ namespace Framework
         Lexicon(const std::string& wordFilename, const std::string& prefixFilename, const std::string& nsfwFilename);
 
     private:
+        struct LocaleInfo
+        {
+            std::string code;
+            LexiconPack::Sources sources;
+            std::string packPath;
+        };
+
+        struct LoadedLocale
+        {
+            std::string code;
+            LexiconPack::Sources sources;
+            std::shared_ptr<LexiconPack> pack;
+            AnagramIndex anagrams;
+        };
+
+        // Compiles (if stale) and maps a pack and builds its anagram index, runs on a worker
+        static std::unique_ptr<LoadedLocale> LoadLocale(const LocaleInfo& info);
+        void StartLocaleLoad(const std::string& code);
+        void ApplyLocale(std::unique_ptr<LoadedLocale> loaded);
+
         Trie trie;                          // Trie to store words
+        AnagramIndex anagramIndex;          // Built from the trie's word list whenever the dictionary loads
+
+        std::unordered_map<std::string, LocaleInfo> locales;
+        std::string locale;                                         // Active locale code, empty before the first pack
+        std::shared_ptr<LexiconPack> pack;                          // Active pack, answers lookups before the tries
+        std::future<std::unique_ptr<LoadedLocale>> pendingLocale;   // Load in flight
+        std::string queuedLocale;                                   // Requested while another load was in flight
+        std::atomic<bool> usingPack{ false };
     };
 
 }  // namespace Framework
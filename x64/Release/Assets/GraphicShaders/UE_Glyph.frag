@@ -0,0 +1,29 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file UE_Glyph.frag
+/// 
+/// @brief Fragment shader for batched text glyphs. Glyph textures hold
+///        coverage in the red channel, drawn with UE_Sprite.vert
+///	
+///	@Authors: Edwin Leow
+///	Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#version 450 core
+
+layout(location = 0) in vec2 vTexCoord;
+layout(location = 1) in vec4 vColor;
+
+layout(location = 0) out vec4 fFragColor;
+
+uniform sampler2D uTexture;
+
+// True when the sprites are blended with (ONE, ONE_MINUS_SRC_ALPHA)
+uniform bool premultipliedAlpha;
+
+void main()
+{
+    float alpha = vColor.a * texture(uTexture, vTexCoord).r;
+    fFragColor = premultipliedAlpha ? vec4(vColor.rgb * alpha, alpha) : vec4(vColor.rgb, alpha);
+}
@@ -0,0 +1,31 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file UE_Sprite.frag
+/// 
+/// @brief Fragment shader for batched sprites
+///	
+///	@Authors: Edwin Leow
+///	Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#version 450 core
+
+layout(location = 0) in vec2 vTexCoord;
+layout(location = 1) in vec4 vColor;
+
+layout(location = 0) out vec4 fFragColor;
+
+uniform sampler2D uTexture;
+
+// False for sprites drawn with texture 0, which use only the tint
+uniform bool useTexture;
+
+// True when textures are stored with premultiplied alpha and blended with (ONE, ONE_MINUS_SRC_ALPHA)
+uniform bool premultipliedAlpha;
+
+void main()
+{
+    vec4 tint = premultipliedAlpha ? vec4(vColor.rgb * vColor.a, vColor.a) : vColor;
+    fFragColor = useTexture ? texture(uTexture, vTexCoord) * tint : tint;
+}
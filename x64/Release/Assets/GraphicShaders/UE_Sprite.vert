@@ -0,0 +1,38 @@
+///////////////////////////////////////////////////////////////////////////////
+///
+///	@file UE_Sprite.vert
+/// 
+/// @brief Vertex shader for batched sprites. One unit quad is drawn per
+///        instance; position, scale, rotation, UV rectangle and tint come
+///        from the per-instance attributes uploaded by the SpriteBatcher.
+///	
+///	@Authors: Edwin Leow
+///	Copyright 2025, Digipen Institute of Technology
+///
+///////////////////////////////////////////////////////////////////////////////
+
+#version 450 core
+
+layout(location = 0) in vec2 position;          // Unit quad corner
+layout(location = 1) in vec2 texCoord;          // Quad texture coordinates
+layout(location = 2) in vec4 iPositionScale;    // Instance position xy, scale zw
+layout(location = 3) in vec4 iUVRect;           // Instance UV offset xy, size zw
+layout(location = 4) in vec4 iColor;            // Instance tint rgb, alpha
+layout(location = 5) in float iRotation;        // Instance rotation in degrees
+
+uniform mat4 viewProjection;
+
+layout(location = 0) out vec2 vTexCoord;
+layout(location = 1) out vec4 vColor;
+
+void main()
+{
+    float angle = radians(iRotation);
+    vec2 scaled = position * iPositionScale.zw;
+    vec2 rotated = vec2(scaled.x * cos(angle) - scaled.y * sin(angle),
+                        scaled.x * sin(angle) + scaled.y * cos(angle));
+
+    gl_Position = viewProjection * vec4(rotated + iPositionScale.xy, 0.0, 1.0);
+    vTexCoord = iUVRect.xy + texCoord * iUVRect.zw;
+    vColor = iColor;
+}